@@ -0,0 +1,194 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/io/binary_writer.h>
+#include <rttr/io/binary_reader.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_object_count = 1000;
+
+struct bench_io_particle
+{
+    int                 id = 0;
+    double              mass = 1.0;
+    float               x = 0.0f;
+    float               y = 0.0f;
+    float               z = 0.0f;
+    bool                active = true;
+    std::string         name = "particle";
+    std::vector<float>  history = std::vector<float>(16, 0.5f);
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<bench_io_particle>("bench_io_particle")
+        .property("id",      &bench_io_particle::id)
+        .property("mass",    &bench_io_particle::mass)
+        .property("x",       &bench_io_particle::x)
+        .property("y",       &bench_io_particle::y)
+        .property("z",       &bench_io_particle::z)
+        .property("active",  &bench_io_particle::active)
+        .property("name",    &bench_io_particle::name)
+        .property("history", &bench_io_particle::history)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_binary_io_property_loop()
+{
+    return nonius::benchmark("property::get_value()", [](nonius::chronometer meter)
+    {
+        std::vector<bench_io_particle> objects(g_object_count);
+        const auto props = rttr::type::get<bench_io_particle>().get_properties();
+        std::vector<rttr::variant> values;
+        values.reserve(g_object_count * props.size());
+        meter.measure([&]()
+        {
+            values.clear();
+            for (const auto& obj : objects)
+            {
+                for (const auto& prop : props)
+                    values.push_back(prop.get_value(obj));
+            }
+            return values.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_binary_io_write()
+{
+    return nonius::benchmark("io::binary_writer", [](nonius::chronometer meter)
+    {
+        std::vector<bench_io_particle> objects(g_object_count);
+        std::vector<char> buffer;
+        meter.measure([&]()
+        {
+            buffer.clear();
+            rttr::io::binary_writer writer(buffer);
+            for (const auto& obj : objects)
+                writer.write(obj);
+            return buffer.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_binary_io_property_set_loop()
+{
+    return nonius::benchmark("property::set_value()", [](nonius::chronometer meter)
+    {
+        std::vector<bench_io_particle> objects(g_object_count);
+        const auto props = rttr::type::get<bench_io_particle>().get_properties();
+        std::vector<rttr::variant> values;
+        for (const auto& prop : props)
+            values.push_back(prop.get_value(objects.front()));
+        meter.measure([&]()
+        {
+            for (auto& obj : objects)
+            {
+                std::size_t index = 0;
+                for (const auto& prop : props)
+                    prop.set_value(obj, values[index++]);
+            }
+            return objects.back().id;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_binary_io_read()
+{
+    return nonius::benchmark("io::binary_reader", [](nonius::chronometer meter)
+    {
+        std::vector<bench_io_particle> objects(g_object_count);
+        std::vector<char> buffer;
+        {
+            rttr::io::binary_writer writer(buffer);
+            for (const auto& obj : objects)
+                writer.write(obj);
+        }
+        meter.measure([&]()
+        {
+            rttr::io::binary_reader reader(buffer.data(), buffer.size());
+            for (auto& obj : objects)
+                reader.read(obj);
+            return objects.back().id;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_binary_io()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::io binary serialization throughput";
+    cfg.samples = 10;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_binary_io.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("write", "Serializes 1000 objects with eight properties each");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_binary_io_property_loop(),
+                                               bench_binary_io_write()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("read", "Deserializes 1000 objects with eight properties each");
+
+    nonius::benchmark benchmarks_group_2[] = { bench_binary_io_property_set_loop(),
+                                               bench_binary_io_read()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.generate_report();
+}
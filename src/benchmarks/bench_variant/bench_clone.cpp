@@ -0,0 +1,141 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_clone_object_count = 1000;
+
+struct bench_clone_transform
+{
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+};
+
+struct bench_clone_entity
+{
+    int                     id = 0;
+    double                  health = 100.0;
+    bool                    visible = true;
+    std::string             name = "entity";
+    std::vector<int>        inventory = std::vector<int>(16, 7);
+    bench_clone_transform   transform;
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<bench_clone_transform>("bench_clone_transform")
+        .property("x", &bench_clone_transform::x)
+        .property("y", &bench_clone_transform::y)
+        .property("z", &bench_clone_transform::z)
+        ;
+
+    rttr::registration::class_<bench_clone_entity>("bench_clone_entity")
+        .property("id",        &bench_clone_entity::id)
+        .property("health",    &bench_clone_entity::health)
+        .property("visible",   &bench_clone_entity::visible)
+        .property("name",      &bench_clone_entity::name)
+        .property("inventory", &bench_clone_entity::inventory)
+        .property("transform", &bench_clone_entity::transform)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_clone_property_loop()
+{
+    return nonius::benchmark("property::get_value() + set_value()", [](nonius::chronometer meter)
+    {
+        std::vector<bench_clone_entity> source(g_clone_object_count);
+        std::vector<bench_clone_entity> target(g_clone_object_count);
+        const auto props = rttr::type::get<bench_clone_entity>().get_properties();
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+            {
+                for (const auto& prop : props)
+                    prop.set_value(target[i], prop.get_value(source[i]));
+            }
+            return target.back().id;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_clone_into()
+{
+    return nonius::benchmark("type::clone_into()", [](nonius::chronometer meter)
+    {
+        std::vector<bench_clone_entity> source(g_clone_object_count);
+        std::vector<bench_clone_entity> target(g_clone_object_count);
+        const rttr::type t = rttr::type::get<bench_clone_entity>();
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+                t.clone_into(source[i], target[i]);
+            return target.back().id;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_clone()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::type::clone_into() throughput";
+    cfg.samples = 10;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_clone.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("clone", "Copies 1000 objects with six properties each, one of them a nested class");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_clone_property_loop(),
+                                               bench_clone_into()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.generate_report();
+}
@@ -28,5 +28,10 @@
 set(HEADER_FILES version.rc.in)
 
 set(SOURCE_FILES main.cpp
+                 bench_binary_io.cpp
+                 bench_clone.cpp
+                 bench_variant_array_view.cpp
                  bench_variant_conversion.cpp
-                 bench_variant_create.cpp)
+                 bench_variant_create.cpp
+                 bench_variant_hash.cpp
+                 bench_variant_sort.cpp)
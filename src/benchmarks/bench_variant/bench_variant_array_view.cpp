@@ -0,0 +1,216 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <list>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_value_count = 2000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Array_Type>
+static nonius::benchmark bench_array_view_index()
+{
+    return nonius::benchmark("index", [](nonius::chronometer meter)
+    {
+        Array_Type arr(g_value_count, 1);
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            int sum = 0;
+            const std::size_t size = view.get_size();
+            for (std::size_t i = 0; i < size; ++i)
+                sum += view.get_value(i).get_value<int>();
+            return sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Array_Type>
+static nonius::benchmark bench_array_view_iterator()
+{
+    return nonius::benchmark("const_iterator", [](nonius::chronometer meter)
+    {
+        Array_Type arr(g_value_count, 1);
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            int sum = 0;
+            for (const auto& ref : view)
+                sum += ref.get_value<int>();
+            return sum;
+        });
+    });
+}
+
+static nonius::benchmark bench_array_view_insert_value()
+{
+    return nonius::benchmark("insert_value", [](nonius::chronometer meter)
+    {
+        const std::vector<int> source(g_value_count, 1);
+        std::vector<int> arr;
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            view.set_size(0);
+            for (std::size_t i = 0; i < source.size(); ++i)
+                view.insert_value(view.get_size(), source[i]);
+            return arr.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_array_view_append_range()
+{
+    return nonius::benchmark("append_range", [](nonius::chronometer meter)
+    {
+        const std::vector<int> source(g_value_count, 1);
+        std::vector<int> arr;
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            view.set_size(0);
+            view.append_range(source.data(), source.size());
+            return arr.size();
+        });
+    });
+}
+
+static nonius::benchmark bench_array_view_to_double()
+{
+    return nonius::benchmark("get_value().to_double()", [](nonius::chronometer meter)
+    {
+        std::vector<int32_t> arr(g_value_count, 1);
+        std::vector<double> result(g_value_count);
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            const std::size_t size = view.get_size();
+            for (std::size_t i = 0; i < size; ++i)
+                result[i] = view.get_value(i).to_double();
+            return result.back();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_array_view_copy_to()
+{
+    return nonius::benchmark("copy_to()", [](nonius::chronometer meter)
+    {
+        std::vector<int32_t> arr(g_value_count, 1);
+        std::vector<double> result(g_value_count);
+        rttr::variant var = &arr;
+        rttr::variant_array_view view = var.create_array_view();
+        meter.measure([&]()
+        {
+            view.copy_to(result.data(), result.size());
+            return result.back();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_array_view()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant_array_view traversal, bulk insertion and conversion";
+    cfg.samples = 10;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_array_view.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("std::vector<int>", "Sums up 2000 elements of a <code>std::vector&lt;int&gt;</code>");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_array_view_index<std::vector<int>>(),
+                                               bench_array_view_iterator<std::vector<int>>()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("std::list<int>", "Sums up 2000 elements of a <code>std::list&lt;int&gt;</code>");
+
+    nonius::benchmark benchmarks_group_2[] = { bench_array_view_index<std::list<int>>(),
+                                               bench_array_view_iterator<std::list<int>>()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("append", "Appends 2000 elements to a <code>std::vector&lt;int&gt;</code>");
+
+    nonius::benchmark benchmarks_group_3[] = { bench_array_view_insert_value(),
+                                               bench_array_view_append_range()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("convert", "Converts 2000 elements of a <code>std::vector&lt;int32_t&gt;</code> to <code>double</code>");
+
+    nonius::benchmark benchmarks_group_4[] = { bench_array_view_to_double(),
+                                               bench_array_view_copy_to()
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    //////////////////////////////////
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,9 @@
 #include <nonius/html_group_reporter.h>
 
 #include <locale>
+#include <sstream>
+#include <iomanip>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +178,23 @@ nonius::benchmark bench_native_float_to_string()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_stringstream_float_to_string()
+{
+    return nonius::benchmark("std::stringstream", [](nonius::chronometer meter)
+    {
+        float var = setup_float();
+        std::string result;
+        meter.measure([&]()
+        {
+            std::stringstream stream;
+            stream << std::setprecision(std::numeric_limits<float>::max_digits10) << var;
+            result = stream.str();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_float_to_string()
 {
     return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
@@ -239,6 +259,23 @@ nonius::benchmark bench_native_double_to_string()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_stringstream_double_to_string()
+{
+    return nonius::benchmark("std::stringstream", [](nonius::chronometer meter)
+    {
+        double var = setup_double();
+        std::string result;
+        meter.measure([&]()
+        {
+            std::stringstream stream;
+            stream << std::setprecision(std::numeric_limits<double>::max_digits10) << var;
+            result = stream.str();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_double_to_string()
 {
     return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
@@ -393,18 +430,19 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("float to string", "Converts a floating point number to a <code>std::string</code>:<br><pre>rttr::variant var = 123.12345f;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_3[] = { bench_native_string_to_float(),
-                                               bench_variant_string_to_float()
+    nonius::benchmark benchmarks_group_3[] = { bench_native_float_to_string(),
+                                               bench_stringstream_float_to_string(),
+                                               bench_variant_float_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float().");
+    reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float();</pre>");
 
-    nonius::benchmark benchmarks_group_4[] = { bench_native_float_to_string(),
-                                               bench_variant_float_to_string()
+    nonius::benchmark benchmarks_group_4[] = { bench_native_string_to_float(),
+                                               bench_variant_string_to_float()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
@@ -413,8 +451,9 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("double to string", "Converts a double number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_5[] = { bench_native_string_to_double(),
-                                               bench_variant_string_to_double()
+    nonius::benchmark benchmarks_group_5[] = { bench_native_double_to_string(),
+                                               bench_stringstream_double_to_string(),
+                                               bench_variant_double_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
@@ -423,28 +462,28 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to double", "Converts a <code>std::string</code> to a double number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_double();</pre>");
 
-    nonius::benchmark benchmarks_group_6[] = { bench_native_double_to_string(),
-                                               bench_variant_double_to_string()
+    nonius::benchmark benchmarks_group_6[] = { bench_native_string_to_double(),
+                                               bench_variant_string_to_double()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("bool to string", "Converts a bool number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
+    reporter.set_current_group_name("bool to string", "Converts a bool to a <code>std::string</code>:<br><pre>rttr::variant var = true;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_7[] = { bench_native_string_to_bool(),
-                                               bench_variant_string_to_bool()
+    nonius::benchmark benchmarks_group_7[] = { bench_native_bool_to_string(),
+                                               bench_variant_bool_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to bool", "Converts a <code>std::string</code> to a bool number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_bool();</pre>");
+    reporter.set_current_group_name("string to bool", "Converts a <code>std::string</code> to a bool:<br><pre>rttr::variant var = std::string(\"1\");\nvar.to_bool();</pre>");
 
-    nonius::benchmark benchmarks_group_8[] = { bench_native_bool_to_string(),
-                                               bench_variant_bool_to_string()
+    nonius::benchmark benchmarks_group_8[] = { bench_native_string_to_bool(),
+                                               bench_variant_string_to_bool()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
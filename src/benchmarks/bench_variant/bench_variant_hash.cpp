@@ -0,0 +1,161 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <map>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_key_count = 1000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_int_keys()
+{
+    std::vector<rttr::variant> keys;
+    for (int i = 0; i < g_key_count; ++i)
+        keys.emplace_back(i * 7);
+
+    return keys;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_string_keys()
+{
+    std::vector<rttr::variant> keys;
+    for (int i = 0; i < g_key_count; ++i)
+        keys.emplace_back(std::string("key_") + std::to_string(i * 7));
+
+    return keys;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_mixed_keys()
+{
+    std::vector<rttr::variant> keys;
+    for (int i = 0; i < g_key_count; ++i)
+    {
+        if (i % 2)
+            keys.emplace_back(std::string("key_") + std::to_string(i * 7));
+        else
+            keys.emplace_back(static_cast<double>(i) + 0.5);
+    }
+
+    return keys;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Map>
+static nonius::benchmark bench_lookup(std::string name, std::vector<rttr::variant>(*setup_keys)())
+{
+    return nonius::benchmark(name, [setup_keys](nonius::chronometer meter)
+    {
+        const std::vector<rttr::variant> keys = setup_keys();
+        Map map;
+        int value = 0;
+        for (const auto& key : keys)
+            map.emplace(key, value++);
+
+        std::size_t index = 0;
+        int result = 0;
+        meter.measure([&]()
+        {
+            auto itr = map.find(keys[index]);
+            result += itr->second;
+            index = (index + 1) % keys.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+using ordered_map = std::map<rttr::variant, int>;
+using hash_map = std::unordered_map<rttr::variant, int, std::hash<rttr::variant>, rttr::variant_key_equal>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_hash()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant as key";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_hash.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("int keys", "Lookup of one of 1000 integer keys:<br><pre>map.find(rttr::variant(42));</pre>");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_lookup<ordered_map>("std::map", setup_int_keys),
+                                               bench_lookup<hash_map>("std::unordered_map", setup_int_keys)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("string keys", "Lookup of one of 1000 <code>std::string</code> keys:<br><pre>map.find(rttr::variant(std::string(\"key_42\")));</pre>");
+
+    nonius::benchmark benchmarks_group_2[] = { bench_lookup<ordered_map>("std::map", setup_string_keys),
+                                               bench_lookup<hash_map>("std::unordered_map", setup_string_keys)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("mixed keys", "Lookup of one of 1000 keys, half of them <code>double</code>, half of them <code>std::string</code>:<br><pre>map.find(rttr::variant(42.5));</pre>");
+
+    nonius::benchmark benchmarks_group_3[] = { bench_lookup<ordered_map>("std::map", setup_mixed_keys),
+                                               bench_lookup<hash_map>("std::unordered_map", setup_mixed_keys)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    //////////////////////////////////
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
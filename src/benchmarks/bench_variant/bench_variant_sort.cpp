@@ -0,0 +1,168 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_value_count = 10000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_int_values()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist;
+    std::vector<rttr::variant> values;
+    for (int i = 0; i < g_value_count; ++i)
+        values.emplace_back(dist(gen));
+
+    return values;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_mixed_arithmetic_values()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist;
+    std::vector<rttr::variant> values;
+    for (int i = 0; i < g_value_count; ++i)
+    {
+        if (i % 2)
+            values.emplace_back(dist(gen));
+        else
+            values.emplace_back(dist(gen) / 3.0);
+    }
+
+    return values;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<rttr::variant> setup_string_values()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist;
+    std::vector<rttr::variant> values;
+    for (int i = 0; i < g_value_count; ++i)
+        values.emplace_back(std::to_string(dist(gen)));
+
+    return values;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_std_sort(std::vector<rttr::variant>(*setup_values)())
+{
+    return nonius::benchmark("std::sort", [setup_values](nonius::chronometer meter)
+    {
+        const std::vector<rttr::variant> values = setup_values();
+        std::vector<std::vector<rttr::variant>> data(meter.runs(), values);
+        meter.measure([&](int i)
+        {
+            std::sort(data[i].begin(), data[i].end());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_sort_variants(std::vector<rttr::variant>(*setup_values)())
+{
+    return nonius::benchmark("rttr::sort_variants", [setup_values](nonius::chronometer meter)
+    {
+        const std::vector<rttr::variant> values = setup_values();
+        std::vector<std::vector<rttr::variant>> data(meter.runs(), values);
+        meter.measure([&](int i)
+        {
+            rttr::sort_variants(data[i]);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_sort()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant sorting";
+    cfg.samples = 10;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_sort.html");
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("int", "Sorts 10000 variants containing an <code>int</code>");
+
+    nonius::benchmark benchmarks_group_1[] = { bench_std_sort(setup_int_values),
+                                               bench_sort_variants(setup_int_values)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("int and double", "Sorts 10000 variants, half of them <code>int</code>, half of them <code>double</code>");
+
+    nonius::benchmark benchmarks_group_2[] = { bench_std_sort(setup_mixed_arithmetic_values),
+                                               bench_sort_variants(setup_mixed_arithmetic_values)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("string", "Sorts 10000 variants containing a <code>std::string</code>");
+
+    nonius::benchmark benchmarks_group_3[] = { bench_std_sort(setup_string_values),
+                                               bench_sort_variants(setup_string_values)
+                                             };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    //////////////////////////////////
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,11 @@
 
 extern void bench_variant_create();
 extern void bench_variant_conversion();
+extern void bench_variant_hash();
+extern void bench_variant_sort();
+extern void bench_variant_array_view();
+extern void bench_binary_io();
+extern void bench_clone();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +39,11 @@ int main(int argc, char** argv)
 {
     bench_variant_create();
     bench_variant_conversion();
+    bench_variant_hash();
+    bench_variant_sort();
+    bench_variant_array_view();
+    bench_binary_io();
+    bench_clone();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,26 @@ struct invalid_array_type {};
  * 5. `static bool insert_value(array_type& arr, const T& value, std::size_t index);`
  * 6. `static bool remove_value(array_type& arr, std::size_t index);`
  *
+ * Optionally, when the elements are stored contiguously in memory, provide:
+ * 7. `static const T* get_data(const array_type& arr);`
+ * 8. `static T* get_data(array_type& arr);`
+ *
+ * Then \ref variant_array_view::is_contiguous() will return `true` and
+ * \ref variant_array_view::get_data() gives direct access to the elements.
+ *
+ * Node based containers, where the access by index is not constant in time, should provide an iterator interface.
+ * Then \ref variant_array_view::const_iterator "iterating" over the array will use these functions instead of an index:
+ * 1. `using iterator = ...;` and `using const_iterator = ...;` (both have to be bidirectional iterators)
+ * 2. `static const_iterator begin(const array_type& arr);` and `static iterator begin(array_type& arr);`
+ * 3. `static const_iterator end(const array_type& arr);` and `static iterator end(array_type& arr);`
+ * 4. `static const T& get_value(const const_iterator& itr);` and `static T& get_value(const iterator& itr);`
+ * 5. `static iterator insert_value(array_type& arr, const T& value, const iterator& itr);`
+ * 6. `static iterator remove_value(array_type& arr, const iterator& itr);`
+ *
+ * Dynamic arrays, which can preallocate their storage, should provide
+ * `static bool reserve(array_type& arr, std::size_t new_capacity);`.
+ * It will be used by \ref variant_array_view::reserve() and before a range of elements is appended.
+ *
  *
  * Following code example for `std::vector<T>` illustrates how to add a specialization:
  *
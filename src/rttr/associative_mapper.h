@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ASSOCIATIVE_MAPPER_H_
+#define RTTR_ASSOCIATIVE_MAPPER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+struct invalid_associative_type {};
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref associative_mapper class is a class template to access different associative containers via one common interface.
+ *
+ * This class will be only used **internally** by RTTR via the \ref variant_associative_view class to get access to elements
+ * of an associative container. In order to use your own custom associative container, you have to provide a specialization of this class.
+ *
+ * Out of the box, RTTR has specialization for following types:
+ * - \p `std::map<Key, T>`
+ * - \p `std::multimap<Key, T>`
+ * - \p `std::unordered_map<Key, T>`
+ * - \p `std::unordered_multimap<Key, T>`
+ * - \p `std::set<Key>`
+ * - \p `std::multiset<Key>`
+ * - \p `std::unordered_set<Key>`
+ * - \p `std::unordered_multiset<Key>`
+ *
+ * Custom associative types
+ * ------------------------
+ * For a specialization of the class \ref rttr::associative_mapper<T> "associative_mapper<T>" you have to provide following nested alias templates:
+ * 1. `using container_t = T;`
+ * 2. `using key_t = ...;`
+ * 3. `using value_t = ...;` (`void` for containers, which store only keys, like a `std::set<Key>`)
+ * 4. `using itr_t = ...;` and `using const_itr_t = ...;` (both have to be at least forward iterators)
+ *
+ * and following member functions:
+ * 1. `static const key_t& get_key(const const_itr_t& itr);`
+ * 2. `static value_t& get_value(const itr_t& itr);` and `static const value_t& get_value(const const_itr_t& itr);` (not for key-only containers)
+ * 3. `static itr_t begin(container_t& container);` and `static const_itr_t begin(const container_t& container);`
+ * 4. `static itr_t end(container_t& container);` and `static const_itr_t end(const container_t& container);`
+ * 5. `static itr_t find(container_t& container, const key_t& key);` and `static const_itr_t find(const container_t& container, const key_t& key);`
+ * 6. `static std::size_t get_size(const container_t& container);`
+ * 7. `static void clear(container_t& container);`
+ * 8. `static std::size_t erase(container_t& container, const key_t& key);`
+ * 9. `static std::pair<itr_t, bool> insert_key(container_t& container, const key_t& key);` (only for key-only containers)
+ * 10. `static std::pair<itr_t, bool> insert_key_value(container_t& container, const key_t& key, const value_t& value);` (not for key-only containers)
+ * 11. `static void insert_range(container_t& container, const container_t& other);`
+ *
+ * Following code example for `std::map<Key, T>` illustrates how to add a specialization:
+ *
+ * \code{.cpp}
+ *  namespace rttr
+ *  {
+ *  template<typename Key, typename T>
+ *  struct associative_mapper<std::map<Key, T>>
+ *  {
+ *      using container_t   = std::map<Key, T>;
+ *      using key_t         = Key;
+ *      using value_t       = T;
+ *      using itr_t         = typename container_t::iterator;
+ *      using const_itr_t   = typename container_t::const_iterator;
+ *
+ *      static const key_t& get_key(const const_itr_t& itr)     { return itr->first; }
+ *      static value_t& get_value(const itr_t& itr)             { return itr->second; }
+ *      static const value_t& get_value(const const_itr_t& itr) { return itr->second; }
+ *
+ *      static itr_t begin(container_t& container)              { return container.begin(); }
+ *      static const_itr_t begin(const container_t& container)  { return container.begin(); }
+ *      static itr_t end(container_t& container)                { return container.end(); }
+ *      static const_itr_t end(const container_t& container)    { return container.end(); }
+ *
+ *      static itr_t find(container_t& container, const key_t& key)             { return container.find(key); }
+ *      static const_itr_t find(const container_t& container, const key_t& key) { return container.find(key); }
+ *
+ *      static std::size_t get_size(const container_t& container)              { return container.size(); }
+ *      static void clear(container_t& container)                               { container.clear(); }
+ *      static std::size_t erase(container_t& container, const key_t& key)     { return container.erase(key); }
+ *
+ *      static std::pair<itr_t, bool> insert_key_value(container_t& container, const key_t& key, const value_t& value)
+ *      {
+ *          return container.insert(std::make_pair(key, value));
+ *      }
+ *
+ *      static void insert_range(container_t& container, const container_t& other)
+ *      {
+ *          container.insert(other.begin(), other.end());
+ *      }
+ *  };
+ *  } // end namespace rttr
+ * \endcode
+ *
+ * \remark
+ * Make sure you put your specialization inside the namespace `rttr`.
+ * The best place for this code, is below the declaration of your custom associative type.
+ * When this is not possible, include your specialization code before registering your types to RTTR.
+ *
+ */
+template <typename T>
+struct associative_mapper
+{
+#ifndef DOXYGEN
+    using no_associative_type = detail::invalid_associative_type;
+#endif
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#include "rttr/detail/associative/associative_mapper_impl.h"
+
+#endif // RTTR_ASSOCIATIVE_MAPPER_H_
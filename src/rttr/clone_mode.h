@@ -0,0 +1,63 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_CLONE_MODE_H_
+#define RTTR_CLONE_MODE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+
+/*!
+ * The \ref clone_mode enum selects, how \ref type::clone() and \ref type::clone_into() treat properties,
+ * which hold their value via a `std::shared_ptr`.
+ *
+ * \see \ref type::clone(), \ref type::clone_into()
+ */
+enum class clone_mode
+{
+    /*!
+     * The shared pointer is copied; the clone shares the pointed-to object with the source.
+     */
+    share_pointees,
+
+    /*!
+     * The pointed-to object is cloned too. Every object is cloned only once, so properties, which share
+     * an object in the source, share its clone in the target; this holds also for cycles.
+     *
+     * An object is only cloned, when its class registered a default constructor, which creates
+     * the same `std::shared_ptr` type as the property holds (see \ref policy::ctor::as_std_shared_ptr);
+     * otherwise it is shared.
+     */
+    clone_shared_pointees
+};
+
+} // end namespace rttr
+
+#endif // RTTR_CLONE_MODE_H_
@@ -45,6 +45,12 @@ constructor create_item(const constructor_wrapper_base* wrapper)
     return constructor(wrapper);
 }
 
+template<>
+const constructor_wrapper_base* get_wrapper(const constructor& item)
+{
+    return item.m_wrapper;
+}
+
 } // end namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -132,6 +138,16 @@ variant constructor::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant constructor::get_metadata(const metadata_key& key) const
+{
+    if (is_valid())
+        return m_wrapper->get_metadata(key);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant constructor::invoke() const
 {
     if (is_valid())
@@ -214,6 +230,118 @@ variant constructor::invoke_variadic(std::vector<argument> args) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant constructor::invoke_at(void* storage) const
+{
+    if (is_valid())
+        return m_wrapper->invoke_at(storage, nullptr, 0);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1 };
+        return m_wrapper->invoke_at(storage, args, 1);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1, argument arg2) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1, arg2 };
+        return m_wrapper->invoke_at(storage, args, 2);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1, arg2, arg3 };
+        return m_wrapper->invoke_at(storage, args, 3);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1, arg2, arg3, arg4 };
+        return m_wrapper->invoke_at(storage, args, 4);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                              argument arg5) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1, arg2, arg3, arg4, arg5 };
+        return m_wrapper->invoke_at(storage, args, 5);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                              argument arg5, argument arg6) const
+{
+    if (is_valid())
+    {
+        const argument args[] = { arg1, arg2, arg3, arg4, arg5, arg6 };
+        return m_wrapper->invoke_at(storage, args, 6);
+    }
+    else
+    {
+        return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_variadic_at(void* storage, std::vector<argument> args) const
+{
+    if (is_valid())
+        return m_wrapper->invoke_at(storage, args.data(), args.size());
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool constructor::operator==(const constructor& other) const
 {
     return (m_wrapper == other.m_wrapper);
@@ -34,6 +34,7 @@
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/metadata_key.h"
 
 #include <string>
 #include <vector>
@@ -153,6 +154,19 @@ class RTTR_API constructor
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned key \p key.
+         *
+         * In contrast to \ref get_metadata(const variant&) const "get_metadata(const variant&)",
+         * only the integer ids of the keys are compared.
+         *
+         * \remark When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const metadata_key& key) const;
+
         /*!
          * \brief Invokes the constructor of type returned by \ref get_instanciated_type().
          *        The instance will always be created on the heap and will be returned as variant object.
@@ -245,6 +259,127 @@ class RTTR_API constructor
          */
         variant invoke_variadic(std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1, argument arg2) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1, argument arg2, argument arg3) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                          argument arg5) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. The registered policy is not used.
+         *
+         * The memory has to provide at least \ref type::get_sizeof() bytes and has to be aligned to \ref type::get_alignof().
+         * The created object has to be destroyed with \ref destructor::invoke_at().
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         */
+        variant invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                          argument arg5, argument arg6) const;
+
+        /*!
+         * \brief Invokes the constructor of type \ref get_declaring_type() in the memory at \p storage,
+         *        which is owned by the caller. Use this method when you need to instantiate a constructor with more then 6 parameters.
+         *
+         * \remark Returns an invalid \ref variant object (see \ref variant::is_valid), when the arguments does
+         *         not match the parameters of the underlying constructor, when \p storage is not suitable aligned
+         *         or when the constructor was registered with a function.
+         *
+         * \return A pointer to the new object, i.e. \p storage.
+         *
+         * \see invoke_at()
+         */
+        variant invoke_variadic_at(void* storage, std::vector<argument> args) const;
+
         /*!
          * \brief Returns true if this constructor is the same like the \p other.
          *
@@ -265,6 +400,8 @@ class RTTR_API constructor
 
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
+        template<typename T>
+        friend const detail::class_item_to_wrapper_t<T>* detail::get_wrapper(const T& item);
 
     private:
         const detail::constructor_wrapper_base* m_wrapper;
@@ -88,6 +88,16 @@ bool destructor::invoke(variant& obj) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool destructor::invoke_at(void* storage) const
+{
+    if (is_valid())
+        return m_wrapper->invoke_at(storage);
+    else
+        return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool destructor::operator==(const destructor& other) const
 {
     return (m_wrapper == other.m_wrapper);
@@ -101,6 +101,17 @@ class RTTR_API destructor
          */
         bool invoke(variant& obj) const;
 
+        /*!
+         * \brief Destroys the object at the address \p storage, without releasing its memory.
+         *
+         * This is the counterpart to \ref constructor::invoke_at(); the object has to be of type
+         * \ref get_destructed_type() "get_destructed_type().get_raw_type()" and was created in the memory
+         * owned by the caller. Afterwards the memory can be reused, e.g. by a pool or an arena.
+         *
+         * \return True if the destructor of the object could be invoked, otherwise false.
+         */
+        bool invoke_at(void* storage) const;
+
         /*!
          * \brief Returns true if this destructor is the same like the \p other.
          *
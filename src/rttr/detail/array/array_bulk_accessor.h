@@ -0,0 +1,209 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARRAY_BULK_ACCESSOR_H_
+#define RTTR_ARRAY_BULK_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/detail/array/array_accessor.h"
+#include "rttr/array_mapper.h"
+
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Implements the bulk operations (reserve, append and assign a range of elements)
+ * of an array with the type \p Arr (which might be const) for \ref variant_array_view.
+ *
+ * The source range is copied into the last elements of the resized array:
+ * - contiguous arrays of trivially copyable elements are filled with one `memcpy`,
+ * - other contiguous arrays and arrays with an iterator interface are filled element by element,
+ * - all remaining arrays are filled via their index.
+ *
+ * The source range must not refer to the elements of the target array itself.
+ */
+template<typename Arr>
+struct array_bulk_accessor
+{
+    using array_type    = remove_cv_t<Arr>;
+    using sub_type      = typename array_mapper<array_type>::sub_type;
+    using is_read_only  = std::is_const<Arr>;
+    using is_memcpy_able = is_trivially_copyable<sub_type>;
+    // raw arrays cannot be move assigned, these will be always copied
+    using is_move_able  = std::integral_constant<bool, !std::is_array<sub_type>::value>;
+
+    static bool reserve(Arr& arr, std::size_t new_capacity)
+    {
+        return reserve(arr, new_capacity, is_read_only());
+    }
+
+    static bool append(Arr& arr, const sub_type* data, std::size_t count, bool move)
+    {
+        return append(arr, data, count, move, is_read_only());
+    }
+
+    static bool assign(Arr& arr, const sub_type* data, std::size_t count, bool move)
+    {
+        return assign(arr, data, count, move, is_read_only());
+    }
+
+    private:
+        static bool reserve(Arr&, std::size_t, std::true_type) { return false; }
+        static bool append(Arr&, const sub_type*, std::size_t, bool, std::true_type) { return false; }
+        static bool assign(Arr&, const sub_type*, std::size_t, bool, std::true_type) { return false; }
+
+        static bool reserve(Arr& arr, std::size_t new_capacity, std::false_type)
+        {
+            return reserve_impl(arr, new_capacity, has_array_reserve_func<array_type>());
+        }
+
+        static bool reserve_impl(Arr& arr, std::size_t new_capacity, std::true_type)
+        {
+            return array_mapper<array_type>::reserve(arr, new_capacity);
+        }
+
+        // there is nothing to preallocate, e.g. for a std::list<T>
+        static bool reserve_impl(Arr&, std::size_t, std::false_type)
+        {
+            return array_mapper<array_type>::is_dynamic();
+        }
+
+        static bool append(Arr& arr, const sub_type* data, std::size_t count, bool move, std::false_type)
+        {
+            if (!array_mapper<array_type>::is_dynamic())
+                return false;
+
+            if (count == 0)
+                return true;
+
+            if (!array_mapper<array_type>::set_size(arr, array_mapper<array_type>::get_size(arr) + count))
+                return false;
+
+            copy_to_back(arr, data, count, move, has_array_data_func<array_type>(), has_array_iterator_func<array_type>());
+            return true;
+        }
+
+        static bool assign(Arr& arr, const sub_type* data, std::size_t count, bool move, std::false_type)
+        {
+            if (array_mapper<array_type>::is_dynamic())
+            {
+                if (!array_mapper<array_type>::set_size(arr, count))
+                    return false;
+            }
+            else if (array_mapper<array_type>::get_size(arr) != count)
+            {
+                return false;
+            }
+
+            if (count > 0)
+                copy_to_back(arr, data, count, move, has_array_data_func<array_type>(), has_array_iterator_func<array_type>());
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // contiguous storage
+
+        template<typename Has_Iterator>
+        static void copy_to_back(Arr& arr, const sub_type* data, std::size_t count, bool move, std::true_type, Has_Iterator)
+        {
+            sub_type* target = array_mapper<array_type>::get_data(arr) + (array_mapper<array_type>::get_size(arr) - count);
+            copy_elements(target, data, count, move, is_memcpy_able());
+        }
+
+        static void copy_elements(sub_type* target, const sub_type* data, std::size_t count, bool, std::true_type)
+        {
+            std::memcpy(static_cast<void*>(target), static_cast<const void*>(data), count * sizeof(sub_type));
+        }
+
+        static void copy_elements(sub_type* target, const sub_type* data, std::size_t count, bool move, std::false_type)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                copy_element(target[i], data[i], move);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // node based storage, the new elements are located before the end iterator
+
+        static void copy_to_back(Arr& arr, const sub_type* data, std::size_t count, bool move, std::false_type, std::true_type)
+        {
+            auto itr = array_mapper<array_type>::end(arr);
+            std::advance(itr, -static_cast<std::ptrdiff_t>(count));
+            for (std::size_t i = 0; i < count; ++i, ++itr)
+                copy_element(array_mapper<array_type>::get_value(itr), data[i], move);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////
+        // index based storage, e.g. std::vector<bool>
+
+        static void copy_to_back(Arr& arr, const sub_type* data, std::size_t count, bool, std::false_type, std::false_type)
+        {
+            const std::size_t offset = array_mapper<array_type>::get_size(arr) - count;
+            for (std::size_t i = 0; i < count; ++i)
+                set_value_to_array<array_type>(arr, data[i], offset + i);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////
+
+        static void copy_element(sub_type& target, const sub_type& value, bool move)
+        {
+            if (move)
+                move_element(target, value, is_move_able());
+            else
+                set_value_to_array(target, value);
+        }
+
+        // the source range was handed over as movable, so casting away the const is fine
+        static void move_element(sub_type& target, const sub_type& value, std::true_type)
+        {
+            target = std::move(const_cast<sub_type&>(value));
+        }
+
+        static void move_element(sub_type& target, const sub_type& value, std::false_type)
+        {
+            set_value_to_array(target, value);
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_BULK_ACCESSOR_H_
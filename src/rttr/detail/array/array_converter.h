@@ -0,0 +1,166 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARRAY_CONVERTER_H_
+#define RTTR_ARRAY_CONVERTER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+#include "rttr/detail/variant/variant_data_converter.h"
+#include "rttr/array_mapper.h"
+
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// is_number_kind<T>::value is true, when T is one of the arithmetic types with a build in conversion,
+// see basic_type_kind
+
+template<typename T>
+using is_number_kind = std::integral_constant<bool, std::is_same<T, bool>::value     || std::is_same<T, char>::value      ||
+                                                    std::is_same<T, int8_t>::value   || std::is_same<T, int16_t>::value   ||
+                                                    std::is_same<T, int32_t>::value  || std::is_same<T, int64_t>::value   ||
+                                                    std::is_same<T, uint8_t>::value  || std::is_same<T, uint16_t>::value  ||
+                                                    std::is_same<T, uint32_t>::value || std::is_same<T, uint64_t>::value  ||
+                                                    std::is_same<T, float>::value    || std::is_same<T, double>::value>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Converts a range of elements of the first dimension of the array \p Arr into a buffer of another arithmetic type.
+ *
+ * The element type is dispatched at compile time and the target type once per call,
+ * so the conversion of every element is an inlined call of \ref convert_from<T>::to().
+ * The loops do not branch on a failed conversion, which allows the compiler to vectorize the widening conversions.
+ * When the element type is equal to the target type and the array is contiguous, the elements are copied with `memcpy`.
+ *
+ * Only arrays, whose element type is an \ref is_number_kind "arithmetic type", are handled.
+ */
+template<typename Arr>
+struct array_converter
+{
+    using array_type = remove_cv_t<Arr>;
+    using sub_type   = typename array_mapper<array_type>::sub_type;
+
+    static bool convert(const Arr& arr, const type& target_type, void* out, std::size_t offset, std::size_t count)
+    {
+        return convert(arr, target_type, out, offset, count, is_number_kind<sub_type>());
+    }
+
+    private:
+        static bool convert(const Arr&, const type&, void*, std::size_t, std::size_t, std::false_type)
+        {
+            return false;
+        }
+
+        static bool convert(const Arr& arr, const type& target_type, void* out, std::size_t offset, std::size_t count, std::true_type)
+        {
+            if (offset + count > array_mapper<array_type>::get_size(arr))
+                return false;
+
+            switch (variant_conversion_table::get_kind(target_type))
+            {
+                case basic_type_kind::BOOL:     return convert_range(arr, static_cast<bool*>(out), offset, count);
+                case basic_type_kind::CHAR:     return convert_range(arr, static_cast<char*>(out), offset, count);
+                case basic_type_kind::INT8:     return convert_range(arr, static_cast<int8_t*>(out), offset, count);
+                case basic_type_kind::INT16:    return convert_range(arr, static_cast<int16_t*>(out), offset, count);
+                case basic_type_kind::INT32:    return convert_range(arr, static_cast<int32_t*>(out), offset, count);
+                case basic_type_kind::INT64:    return convert_range(arr, static_cast<int64_t*>(out), offset, count);
+                case basic_type_kind::UINT8:    return convert_range(arr, static_cast<uint8_t*>(out), offset, count);
+                case basic_type_kind::UINT16:   return convert_range(arr, static_cast<uint16_t*>(out), offset, count);
+                case basic_type_kind::UINT32:   return convert_range(arr, static_cast<uint32_t*>(out), offset, count);
+                case basic_type_kind::UINT64:   return convert_range(arr, static_cast<uint64_t*>(out), offset, count);
+                case basic_type_kind::FLOAT:    return convert_range(arr, static_cast<float*>(out), offset, count);
+                case basic_type_kind::DOUBLE:   return convert_range(arr, static_cast<double*>(out), offset, count);
+                default:                        return false;
+            }
+        }
+
+        template<typename T>
+        static bool convert_range(const Arr& arr, T* out, std::size_t offset, std::size_t count)
+        {
+            return convert_range(arr, out, offset, count, has_array_data_func<array_type>(), has_array_iterator_func<array_type>());
+        }
+
+        template<typename T, typename Has_Iterator>
+        static bool convert_range(const Arr& arr, T* out, std::size_t offset, std::size_t count, std::true_type, Has_Iterator)
+        {
+            return convert_elements(array_mapper<array_type>::get_data(arr) + offset, out, count);
+        }
+
+        template<typename T>
+        static bool convert_range(const Arr& arr, T* out, std::size_t offset, std::size_t count, std::false_type, std::true_type)
+        {
+            auto itr = array_mapper<array_type>::begin(arr);
+            std::advance(itr, offset);
+            return convert_elements(itr, out, count);
+        }
+
+        // e.g. std::vector<bool>, its elements are only accessible via a proxy object
+        template<typename T>
+        static bool convert_range(const Arr& arr, T* out, std::size_t offset, std::size_t count, std::false_type, std::false_type)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i < count; ++i)
+                result &= convert_from<sub_type>::to(static_cast<sub_type>(array_mapper<array_type>::get_value(arr, offset + i)), out[i]);
+
+            return result;
+        }
+
+        template<typename Itr, typename T>
+        static bool convert_elements(Itr itr, T* out, std::size_t count)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i < count; ++i, ++itr)
+                result &= convert_from<sub_type>::to(*itr, out[i]);
+
+            return result;
+        }
+
+        static bool convert_elements(const sub_type* data, sub_type* out, std::size_t count)
+        {
+            std::memcpy(out, data, count * sizeof(sub_type));
+            return true;
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_CONVERTER_H_
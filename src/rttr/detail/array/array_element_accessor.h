@@ -0,0 +1,158 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARRAY_ELEMENT_ACCESSOR_H_
+#define RTTR_ARRAY_ELEMENT_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/array/array_accessor.h"
+#include "rttr/detail/array/array_iterator_accessor.h"
+#include "rttr/array_mapper.h"
+
+#include <type_traits>
+#include <cstddef>
+#include <array>
+
+namespace rttr
+{
+class variant_ref;
+class argument;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// array_fixed_size<T>::value
+//
+// array_fixed_size<int[4]>::value                  => 4
+// array_fixed_size<std::array<int, 4>>::value      => 4
+// array_fixed_size<std::vector<int>>::value        => 0, the size is only known at runtime
+
+template<typename T>
+struct array_fixed_size : std::integral_constant<std::size_t, 0> {};
+
+template<typename T, std::size_t N>
+struct array_fixed_size<T[N]> : std::integral_constant<std::size_t, N> {};
+
+template<typename T, std::size_t N>
+struct array_fixed_size<std::array<T, N>> : std::integral_constant<std::size_t, N> {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the fixed size of every dimension of the array type \p T;
+ * the size of a dimension, which can only be determined at runtime, is reported as `0`.
+ */
+template<typename T, std::size_t Rank = rank<T>::value>
+struct array_fixed_shape
+{
+    using sub_type = typename array_mapper<T>::sub_type;
+
+    static std::size_t get_fixed_size(std::size_t dim)
+    {
+        return (dim == 0 ? array_fixed_size<T>::value : array_fixed_shape<sub_type>::get_fixed_size(dim - 1));
+    }
+};
+
+template<typename T>
+struct array_fixed_shape<T, 0>
+{
+    static std::size_t get_fixed_size(std::size_t) { return 0; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Accesses the innermost element of the nested array \p Arr (which might be const)
+ * with one index per dimension, without creating any temporary index list.
+ *
+ * Every index is checked against the size of its dimension.
+ */
+template<typename Arr, std::size_t Rank = rank<remove_cv_t<Arr>>::value>
+struct array_element_accessor
+{
+    using array_type = remove_cv_t<Arr>;
+    using sub_array  = remove_reference_t<decltype(array_mapper<array_type>::get_value(std::declval<Arr&>(), 0))>;
+
+    static bool get_value(Arr& arr, const std::size_t* indices, variant_ref& value)
+    {
+        if (indices[0] >= array_mapper<array_type>::get_size(arr))
+            return false;
+
+        return array_element_accessor<sub_array>::get_value(array_mapper<array_type>::get_value(arr, indices[0]), indices + 1, value);
+    }
+
+    static bool set_value(Arr& arr, const std::size_t* indices, argument& arg)
+    {
+        if (indices[0] >= array_mapper<array_type>::get_size(arr))
+            return false;
+
+        return array_element_accessor<sub_array>::set_value(array_mapper<array_type>::get_value(arr, indices[0]), indices + 1, arg);
+    }
+};
+
+template<typename Arr>
+struct array_element_accessor<Arr, 1>
+{
+    using array_type    = remove_cv_t<Arr>;
+    using sub_type      = typename array_mapper<array_type>::sub_type;
+    using is_read_only  = std::is_const<Arr>;
+
+    static bool get_value(Arr& arr, const std::size_t* indices, variant_ref& value)
+    {
+        if (indices[0] >= array_mapper<array_type>::get_size(arr))
+            return false;
+
+        array_iterator_accessor_base<Arr, std::size_t>::create_ref(array_mapper<array_type>::get_value(arr, indices[0]), value);
+        return true;
+    }
+
+    static bool set_value(Arr& arr, const std::size_t* indices, argument& arg)
+    {
+        return set_value(arr, indices, arg, is_read_only());
+    }
+
+    private:
+        static bool set_value(Arr& arr, const std::size_t* indices, argument& arg, std::false_type)
+        {
+            if (indices[0] >= array_mapper<array_type>::get_size(arr) || !arg.is_type<sub_type>())
+                return false;
+
+            return set_value_to_array<array_type>(arr, arg.get_value<sub_type>(), indices[0]);
+        }
+
+        static bool set_value(Arr&, const std::size_t*, argument&, std::true_type) { return false; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_ELEMENT_ACCESSOR_H_
@@ -0,0 +1,215 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ARRAY_ITERATOR_ACCESSOR_H_
+#define RTTR_ARRAY_ITERATOR_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/misc/iterator_storage.h"
+#include "rttr/detail/array/array_accessor.h"
+#include "rttr/array_mapper.h"
+
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+
+namespace rttr
+{
+class variant_ref;
+class argument;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Implements the traversal of an array with the type \p Arr (which might be const) for \ref variant_array_view::const_iterator.
+ *
+ * When the \ref array_mapper of the array provides an iterator interface (see \ref has_array_iterator_func),
+ * the iterators of the container are used, otherwise the elements are accessed via an index.
+ */
+template<typename Arr, typename Has_Iterator = has_array_iterator_func<Arr>>
+struct array_iterator_accessor;
+
+template<typename Arr, typename Itr>
+struct array_iterator_accessor_base
+{
+    using array_type = remove_cv_t<Arr>;
+    using sub_type   = typename array_mapper<array_type>::sub_type;
+    using storage    = iterator_storage<Itr>;
+
+    static void advance(iterator_data& itr, bool forward)
+    {
+        if (forward)
+            ++storage::get(itr);
+        else
+            --storage::get(itr);
+    }
+
+    static bool equal(const iterator_data& lhs, const iterator_data& rhs)
+    {
+        return (storage::get(lhs) == storage::get(rhs));
+    }
+
+    template<typename T>
+    static void create_ref(T& value, variant_ref& ref)
+    {
+        ref = variant_ref(value);
+    }
+
+    // e.g. the proxy object of std::vector<bool>, then the value has to be copied
+    template<typename T>
+    static void create_ref(T&& value, variant_ref& ref)
+    {
+        ref = variant_ref(variant(static_cast<sub_type>(value)));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Arr>
+struct array_iterator_accessor<Arr, std::false_type> : array_iterator_accessor_base<Arr, std::size_t>
+{
+    using base      = array_iterator_accessor_base<Arr, std::size_t>;
+    using storage   = typename base::storage;
+    using array_type = typename base::array_type;
+
+    static void create(iterator_data& itr, Arr& arr, bool at_end)
+    {
+        storage::create(itr, at_end ? array_mapper<array_type>::get_size(arr) : 0);
+    }
+
+    static void create_at(iterator_data& itr, Arr& arr, std::size_t index)
+    {
+        storage::create(itr, index);
+    }
+
+    static void get_value(const iterator_data& itr, Arr& arr, variant_ref& value)
+    {
+        base::create_ref(array_mapper<array_type>::get_value(arr, storage::get(itr)), value);
+    }
+
+    static bool set_value(iterator_data& itr, Arr& arr, argument& arg)
+    {
+        return array_accessor<array_type>::set_value(arr, arg, storage::get(itr));
+    }
+
+    // the index refers afterwards to the inserted element
+    static bool insert_value(iterator_data& itr, Arr& arr, argument& arg)
+    {
+        return array_accessor<array_type>::insert_value(arr, arg, storage::get(itr));
+    }
+
+    // the index refers afterwards to the element after the removed one
+    static bool remove_value(iterator_data& itr, Arr& arr)
+    {
+        return array_accessor<array_type>::remove_value(arr, storage::get(itr));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Arr>
+struct array_iterator_accessor<Arr, std::true_type>
+:   array_iterator_accessor_base<Arr, decltype(array_mapper<remove_cv_t<Arr>>::begin(std::declval<Arr&>()))>
+{
+    using itr_t         = decltype(array_mapper<remove_cv_t<Arr>>::begin(std::declval<Arr&>()));
+    using base          = array_iterator_accessor_base<Arr, itr_t>;
+    using storage       = typename base::storage;
+    using array_type    = typename base::array_type;
+    using sub_type      = typename base::sub_type;
+    using is_read_only  = std::is_const<Arr>;
+
+    static void create(iterator_data& itr, Arr& arr, bool at_end)
+    {
+        storage::create(itr, at_end ? array_mapper<array_type>::end(arr) : array_mapper<array_type>::begin(arr));
+    }
+
+    static void create_at(iterator_data& itr, Arr& arr, std::size_t index)
+    {
+        auto pos = array_mapper<array_type>::begin(arr);
+        std::advance(pos, index);
+        storage::create(itr, pos);
+    }
+
+    static void get_value(const iterator_data& itr, Arr& arr, variant_ref& value)
+    {
+        base::create_ref(array_mapper<array_type>::get_value(storage::get(itr)), value);
+    }
+
+    static bool set_value(iterator_data& itr, Arr& arr, argument& arg)
+    {
+        return set_value(itr, arr, arg, is_read_only());
+    }
+
+    static bool insert_value(iterator_data& itr, Arr& arr, argument& arg)
+    {
+        return insert_value(itr, arr, arg, is_read_only());
+    }
+
+    static bool remove_value(iterator_data& itr, Arr& arr)
+    {
+        return remove_value(itr, arr, is_read_only());
+    }
+
+    private:
+        static bool set_value(iterator_data& itr, Arr& arr, argument& arg, std::false_type)
+        {
+            if (!arg.is_type<sub_type>())
+                return false;
+
+            return set_value_to_array(array_mapper<array_type>::get_value(storage::get(itr)), arg.get_value<sub_type>());
+        }
+
+        static bool insert_value(iterator_data& itr, Arr& arr, argument& arg, std::false_type)
+        {
+            if (!arg.is_type<sub_type>())
+                return false;
+
+            storage::get(itr) = array_mapper<array_type>::insert_value(arr, arg.get_value<sub_type>(), storage::get(itr));
+            return true;
+        }
+
+        static bool remove_value(iterator_data& itr, Arr& arr, std::false_type)
+        {
+            storage::get(itr) = array_mapper<array_type>::remove_value(arr, storage::get(itr));
+            return true;
+        }
+
+        static bool set_value(iterator_data&, Arr&, argument&, std::true_type) { return false; }
+        static bool insert_value(iterator_data&, Arr&, argument&, std::true_type) { return false; }
+        static bool remove_value(iterator_data&, Arr&, std::true_type) { return false; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_ITERATOR_ACCESSOR_H_
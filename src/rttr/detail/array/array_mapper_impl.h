@@ -71,6 +71,16 @@ struct array_mapper<T[N]>
         return arr[index];
     }
 
+    static const T* get_data(const T (& arr)[N])
+    {
+        return arr;
+    }
+
+    static T* get_data(T (& arr)[N])
+    {
+        return arr;
+    }
+
     static bool insert_value(T (&)[N], const T&, std::size_t)
     {
       return false;
@@ -116,6 +126,16 @@ struct array_mapper<std::array<T, N> >
         return arr[index];
     }
 
+    static const T* get_data(const std::array<T, N>& arr)
+    {
+        return arr.data();
+    }
+
+    static T* get_data(std::array<T, N>& arr)
+    {
+        return arr.data();
+    }
+
     static bool insert_value(std::array<T, N>&, const T&, std::size_t)
     {
       return false;
@@ -161,6 +181,22 @@ struct array_mapper<std::array<T, N> >
         return arr[index];
     }
 
+    static const T* get_data(const std::vector<T>& arr)
+    {
+        return arr.data();
+    }
+
+    static T* get_data(std::vector<T>& arr)
+    {
+        return arr.data();
+    }
+
+    static bool reserve(std::vector<T>& arr, std::size_t new_capacity)
+    {
+        arr.reserve(new_capacity);
+        return true;
+    }
+
     static bool insert_value(std::vector<T>& arr, const T& value, std::size_t index)
     {
         arr.insert(arr.begin() + index, value);
@@ -209,6 +245,12 @@ struct array_mapper<std::array<T, N> >
         return arr[index];
     }
 
+    static bool reserve(std::vector<bool>& arr, std::size_t new_capacity)
+    {
+        arr.reserve(new_capacity);
+        return true;
+    }
+
     static bool insert_value(std::vector<bool>& arr, const bool& value, std::size_t index)
     {
         arr.insert(arr.begin() + index, value);
@@ -275,6 +317,51 @@ struct array_mapper<std::array<T, N> >
         arr.erase(it);
         return true;
     }
+
+    // iterator interface, used by variant_array_view::const_iterator
+
+    using iterator          = typename std::list<T>::iterator;
+    using const_iterator    = typename std::list<T>::const_iterator;
+
+    static const_iterator begin(const std::list<T>& arr)
+    {
+        return arr.begin();
+    }
+
+    static iterator begin(std::list<T>& arr)
+    {
+        return arr.begin();
+    }
+
+    static const_iterator end(const std::list<T>& arr)
+    {
+        return arr.end();
+    }
+
+    static iterator end(std::list<T>& arr)
+    {
+        return arr.end();
+    }
+
+    static const T& get_value(const const_iterator& itr)
+    {
+        return *itr;
+    }
+
+    static T& get_value(const iterator& itr)
+    {
+        return *itr;
+    }
+
+    static iterator insert_value(std::list<T>& arr, const T& value, const iterator& itr)
+    {
+        return arr.insert(itr, value);
+    }
+
+    static iterator remove_value(std::list<T>& arr, const iterator& itr)
+    {
+        return arr.erase(itr);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////
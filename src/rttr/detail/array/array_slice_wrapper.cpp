@@ -0,0 +1,395 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/array/array_slice_wrapper.h"
+
+#include "rttr/variant.h"
+#include "rttr/argument.h"
+#include "rttr/type.h"
+
+#include <algorithm>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_slice_wrapper::array_slice_wrapper(std::unique_ptr<array_wrapper_base> array, std::size_t begin, std::size_t end)
+:   m_array(std::move(array)),
+    m_begin(begin),
+    m_size(end - begin),
+    m_manager(m_array->create_iterator_at(m_begin_itr, begin))
+{
+    if (m_manager)
+        m_array->create_iterator_at(m_end_itr, end);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_slice_wrapper::array_slice_wrapper(const array_slice_wrapper& other)
+:   m_array(other.m_array->clone()),
+    m_begin(other.m_begin),
+    m_size(other.m_size),
+    m_manager(other.m_manager)
+{
+    if (m_manager)
+    {
+        m_manager->copy(other.m_begin_itr, m_begin_itr);
+        m_manager->copy(other.m_end_itr, m_end_itr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_slice_wrapper::~array_slice_wrapper()
+{
+    if (m_manager)
+    {
+        m_manager->destroy(m_begin_itr);
+        m_manager->destroy(m_end_itr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::is_valid() const                      { return m_array->is_valid(); }
+bool array_slice_wrapper::is_dynamic() const                    { return false; }
+std::size_t array_slice_wrapper::get_rank() const               { return m_array->get_rank(); }
+type array_slice_wrapper::get_rank_type(std::size_t index) const { return m_array->get_rank_type(index); }
+type array_slice_wrapper::get_type() const                      { return m_array->get_type(); }
+bool array_slice_wrapper::is_raw_array() const                  { return m_array->is_raw_array(); }
+
+bool array_slice_wrapper::is_contiguous() const                 { return m_array->is_contiguous(); }
+type array_slice_wrapper::get_element_type() const              { return m_array->get_element_type(); }
+std::size_t array_slice_wrapper::get_stride() const             { return m_array->get_stride(); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* array_slice_wrapper::get_data() const
+{
+    if (void* data = m_array->get_data())
+        return static_cast<char*>(data) + m_begin * m_array->get_stride();
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::convert_to(const type& target_type, void* out, std::size_t offset, std::size_t count) const
+{
+    if (offset + count > m_size)
+        return false;
+
+    return m_array->convert_to(target_type, out, m_begin + offset, count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t array_slice_wrapper::get_fixed_size(std::size_t dim) const
+{
+    // the first dimension of a slice has never the size of its type
+    return (dim == 0 ? 0 : m_array->get_fixed_size(dim));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F>
+bool array_slice_wrapper::with_array_indices(const std::size_t* indices, const F& func) const
+{
+    if (indices[0] >= m_size)
+        return false;
+
+    // avoid an allocation for the common ranks
+    const std::size_t rank = get_rank();
+    std::size_t buffer[8];
+    std::vector<std::size_t> large_buffer;
+    std::size_t* array_indices = buffer;
+    if (rank > 8)
+    {
+        large_buffer.resize(rank);
+        array_indices = large_buffer.data();
+    }
+
+    std::copy(indices, indices + rank, array_indices);
+    array_indices[0] += m_begin;
+    return func(array_indices);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::get_element(const std::size_t* indices, variant_ref& value) const
+{
+    return with_array_indices(indices, [&](const std::size_t* array_indices)
+    {
+        return m_array->get_element(array_indices, value);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_element(const std::size_t* indices, argument& arg)
+{
+    return with_array_indices(indices, [&](const std::size_t* array_indices)
+    {
+        return m_array->set_element(array_indices, arg);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::size_t> array_slice_wrapper::to_array_indices(const std::vector<std::size_t>& index_list) const
+{
+    std::vector<std::size_t> result(index_list);
+    result[0] += m_begin;
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t array_slice_wrapper::get_size() const
+{
+    return m_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t array_slice_wrapper::get_size(std::size_t index_1) const
+{
+    return (index_1 < m_size ? m_array->get_size(m_begin + index_1) : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t array_slice_wrapper::get_size(std::size_t index_1, std::size_t index_2) const
+{
+    return (index_1 < m_size ? m_array->get_size(m_begin + index_1, index_2) : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t array_slice_wrapper::get_size_variadic(const std::vector<std::size_t>& index_list) const
+{
+    if (index_list.empty())
+        return m_size;
+
+    return (index_list[0] < m_size ? m_array->get_size_variadic(to_array_indices(index_list)) : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_size(std::size_t new_size, std::size_t index_1)
+{
+    return (index_1 < m_size && m_array->set_size(new_size, m_begin + index_1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_size(std::size_t new_size, std::size_t index_1, std::size_t index_2)
+{
+    return (index_1 < m_size && m_array->set_size(new_size, m_begin + index_1, index_2));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list)
+{
+    if (index_list.empty() || index_list[0] >= m_size)
+        return false;
+
+    return m_array->set_size_variadic(new_size, to_array_indices(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_value(std::size_t index_1, argument& arg)
+{
+    return (index_1 < m_size && m_array->set_value(m_begin + index_1, arg));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_value(std::size_t index_1, std::size_t index_2, argument& arg)
+{
+    return (index_1 < m_size && m_array->set_value(m_begin + index_1, index_2, arg));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg)
+{
+    return (index_1 < m_size && m_array->set_value(m_begin + index_1, index_2, index_3, arg));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_value_variadic(const std::vector<std::size_t>& index_list, argument& arg)
+{
+    if (index_list.empty() || index_list[0] >= m_size)
+        return false;
+
+    return m_array->set_value_variadic(to_array_indices(index_list), arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant array_slice_wrapper::get_value(std::size_t index_1) const
+{
+    return (index_1 < m_size ? m_array->get_value(m_begin + index_1) : variant());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant array_slice_wrapper::get_value(std::size_t index_1, std::size_t index_2) const
+{
+    return (index_1 < m_size ? m_array->get_value(m_begin + index_1, index_2) : variant());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant array_slice_wrapper::get_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) const
+{
+    return (index_1 < m_size ? m_array->get_value(m_begin + index_1, index_2, index_3) : variant());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant array_slice_wrapper::get_value_variadic(const std::vector<std::size_t>& index_list) const
+{
+    if (index_list.empty() || index_list[0] >= m_size)
+        return variant();
+
+    return m_array->get_value_variadic(to_array_indices(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::insert_value(std::size_t index_1, std::size_t index_2, argument& arg)
+{
+    return (index_1 < m_size && m_array->insert_value(m_begin + index_1, index_2, arg));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::insert_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg)
+{
+    return (index_1 < m_size && m_array->insert_value(m_begin + index_1, index_2, index_3, arg));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::insert_value_variadic(const std::vector<std::size_t>& index_list, argument& arg)
+{
+    // the size of the first dimension is fixed
+    if (index_list.size() < 2 || index_list[0] >= m_size)
+        return false;
+
+    return m_array->insert_value_variadic(to_array_indices(index_list), arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::remove_value(std::size_t index_1, std::size_t index_2)
+{
+    return (index_1 < m_size && m_array->remove_value(m_begin + index_1, index_2));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::remove_value(std::size_t index_1, std::size_t index_2, std::size_t index_3)
+{
+    return (index_1 < m_size && m_array->remove_value(m_begin + index_1, index_2, index_3));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::remove_value_variadic(const std::vector<std::size_t>& index_list)
+{
+    if (index_list.size() < 2 || index_list[0] >= m_size)
+        return false;
+
+    return m_array->remove_value_variadic(to_array_indices(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const iterator_manager* array_slice_wrapper::create_iterator(iterator_data& itr, bool at_end) const
+{
+    if (m_manager)
+        m_manager->copy(at_end ? m_end_itr : m_begin_itr, itr);
+
+    return m_manager;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const iterator_manager* array_slice_wrapper::create_iterator_at(iterator_data& itr, std::size_t index) const
+{
+    return m_array->create_iterator_at(itr, m_begin + index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void array_slice_wrapper::advance_iterator(iterator_data& itr, bool forward) const
+{
+    m_array->advance_iterator(itr, forward);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const
+{
+    return m_array->equal_iterator(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void array_slice_wrapper::get_value(const iterator_data& itr, variant_ref& value) const
+{
+    m_array->get_value(itr, value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool array_slice_wrapper::set_value(iterator_data& itr, argument& arg)
+{
+    return m_array->set_value(itr, arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<array_wrapper_base> array_slice_wrapper::clone() const
+{
+    return std::unique_ptr<array_wrapper_base>(new array_slice_wrapper(*this));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,139 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ARRAY_SLICE_WRAPPER_H_
+#define RTTR_ARRAY_SLICE_WRAPPER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant.h"
+#include "rttr/detail/array/array_wrapper_base.h"
+#include "rttr/detail/misc/iterator_storage.h"
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Refers to the elements [begin, end) of the first dimension of another array wrapper,
+ * the elements are not copied; see \ref variant_array_view::slice().
+ *
+ * The slice stores the positions of its first and its past-the-end element as iterators of the underlying array,
+ * so node based containers are traversed without stepping over the preceding elements again.
+ * Its size is fixed, but the values and the nested dimensions of its elements can be changed.
+ */
+class array_slice_wrapper : public array_wrapper_base
+{
+    public:
+        array_slice_wrapper(std::unique_ptr<array_wrapper_base> array, std::size_t begin, std::size_t end);
+        ~array_slice_wrapper();
+
+        bool        is_valid() const;
+        bool        is_dynamic() const;
+        std::size_t get_rank() const;
+        type        get_rank_type(std::size_t index) const;
+        type        get_type() const;
+        bool        is_raw_array() const;
+
+        bool        is_contiguous() const;
+        type        get_element_type() const;
+        std::size_t get_stride() const;
+        void*       get_data() const;
+
+        bool        convert_to(const type& target_type, void* out, std::size_t offset, std::size_t count) const;
+
+        std::size_t get_fixed_size(std::size_t dim) const;
+        bool get_element(const std::size_t* indices, variant_ref& value) const;
+        bool set_element(const std::size_t* indices, argument& arg);
+
+        std::size_t get_size() const;
+        std::size_t get_size(std::size_t index_1) const;
+        std::size_t get_size(std::size_t index_1, std::size_t index_2) const;
+        std::size_t get_size_variadic(const std::vector<std::size_t>& index_list) const;
+
+        bool set_size(std::size_t new_size, std::size_t index_1);
+        bool set_size(std::size_t new_size, std::size_t index_1, std::size_t index_2);
+        bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list);
+
+        bool set_value(std::size_t index_1, argument& arg);
+        bool set_value(std::size_t index_1, std::size_t index_2, argument& arg);
+        bool set_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg);
+        bool set_value_variadic(const std::vector<std::size_t>& index_list, argument& arg);
+
+        variant get_value(std::size_t index_1) const;
+        variant get_value(std::size_t index_1, std::size_t index_2) const;
+        variant get_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) const;
+        variant get_value_variadic(const std::vector<std::size_t>& index_list) const;
+
+        bool insert_value(std::size_t index_1, std::size_t index_2, argument& arg);
+        bool insert_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg);
+        bool insert_value_variadic(const std::vector<std::size_t>& index_list, argument& arg);
+
+        bool remove_value(std::size_t index_1, std::size_t index_2);
+        bool remove_value(std::size_t index_1, std::size_t index_2, std::size_t index_3);
+        bool remove_value_variadic(const std::vector<std::size_t>& index_list);
+
+        const iterator_manager* create_iterator(iterator_data& itr, bool at_end) const;
+        const iterator_manager* create_iterator_at(iterator_data& itr, std::size_t index) const;
+        void advance_iterator(iterator_data& itr, bool forward) const;
+        bool equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const;
+        void get_value(const iterator_data& itr, variant_ref& value) const;
+        bool set_value(iterator_data& itr, argument& arg);
+
+        std::unique_ptr<array_wrapper_base> clone() const;
+
+    private:
+        array_slice_wrapper(const array_slice_wrapper& other);
+        array_slice_wrapper& operator=(const array_slice_wrapper&) = delete;
+
+        std::vector<std::size_t> to_array_indices(const std::vector<std::size_t>& index_list) const;
+
+        template<typename F>
+        bool with_array_indices(const std::size_t* indices, const F& func) const;
+
+    private:
+        std::unique_ptr<array_wrapper_base> m_array;
+        std::size_t                         m_begin;
+        std::size_t                         m_size;
+        const iterator_manager*             m_manager;
+        iterator_data                       m_begin_itr;
+        iterator_data                       m_end_itr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_SLICE_WRAPPER_H_
@@ -32,6 +32,10 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/array/array_wrapper_base.h"
 #include "rttr/detail/array/array_accessor.h"
+#include "rttr/detail/array/array_iterator_accessor.h"
+#include "rttr/detail/array/array_bulk_accessor.h"
+#include "rttr/detail/array/array_element_accessor.h"
+#include "rttr/detail/array/array_converter.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/array_mapper.h"
 #include "rttr/wrapper_mapper.h"
@@ -54,6 +58,10 @@ template<typename T, typename Array_Address>
 class array_wrapper : public array_wrapper_base
 {
     using Array_Type = typename detail::raw_type<Array_Address>::type;
+    using itr_accessor = array_iterator_accessor<remove_reference_t<decltype(*std::declval<Array_Address&>())>>;
+    using bulk_accessor = array_bulk_accessor<remove_reference_t<decltype(*std::declval<Array_Address&>())>>;
+    using element_accessor = array_element_accessor<remove_reference_t<decltype(*std::declval<Array_Address&>())>>;
+    using sub_type = typename array_mapper<Array_Type>::sub_type;
     public:
         array_wrapper(const Array_Address& address)
         :   m_address_data(address)
@@ -74,6 +82,35 @@ class array_wrapper : public array_wrapper_base
 
         /////////////////////////////////////////////////////////////////////////////////////////
 
+        bool is_contiguous()                  const { return has_array_data_func<Array_Type>::value; }
+        type get_element_type()               const { return type::get<sub_type>(); }
+        std::size_t get_stride()              const { return (is_contiguous() ? sizeof(sub_type) : 0); }
+        void* get_data()                      const { return get_data_impl(has_array_data_func<Array_Type>()); }
+
+        bool convert_to(const type& target_type, void* out, std::size_t offset, std::size_t count) const
+        {
+            return array_converter<Array_Type>::convert(*m_address_data, target_type, out, offset, count);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t get_fixed_size(std::size_t dim) const
+        {
+            return array_fixed_shape<Array_Type>::get_fixed_size(dim);
+        }
+
+        bool get_element(const std::size_t* indices, variant_ref& value) const
+        {
+            return element_accessor::get_value(*m_address_data, indices, value);
+        }
+
+        bool set_element(const std::size_t* indices, argument& arg)
+        {
+            return element_accessor::set_value(*m_address_data, indices, arg);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
         std::size_t get_size() const
         {
             return array_accessor<Array_Type>::get_size(*m_address_data);
@@ -112,6 +149,29 @@ class array_wrapper : public array_wrapper_base
 
         /////////////////////////////////////////////////////////////////////////////////////////
 
+        bool reserve(std::size_t new_capacity)
+        {
+            return bulk_accessor::reserve(*m_address_data, new_capacity);
+        }
+
+        bool append_range(const void* data, std::size_t count, const type& element_type, bool move)
+        {
+            if (element_type != get_element_type() || (data == nullptr && count > 0))
+                return false;
+
+            return bulk_accessor::append(*m_address_data, static_cast<const sub_type*>(data), count, move);
+        }
+
+        bool assign(const void* data, std::size_t count, const type& element_type, bool move)
+        {
+            if (element_type != get_element_type() || (data == nullptr && count > 0))
+                return false;
+
+            return bulk_accessor::assign(*m_address_data, static_cast<const sub_type*>(data), count, move);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
         bool set_value(argument& arg)
         {
             return array_accessor<Array_Type>::set_value(*m_address_data, arg);
@@ -201,11 +261,68 @@ class array_wrapper : public array_wrapper_base
             return array_accessor<Array_Type>::remove_value(*m_address_data, index_list);
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        const iterator_manager* create_iterator(iterator_data& itr, bool at_end) const
+        {
+            itr_accessor::create(itr, *m_address_data, at_end);
+            return itr_accessor::storage::get_manager();
+        }
+
+        const iterator_manager* create_iterator_at(iterator_data& itr, std::size_t index) const
+        {
+            itr_accessor::create_at(itr, *m_address_data, index);
+            return itr_accessor::storage::get_manager();
+        }
+
+        void advance_iterator(iterator_data& itr, bool forward) const
+        {
+            itr_accessor::advance(itr, forward);
+        }
+
+        bool equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const
+        {
+            return itr_accessor::equal(lhs, rhs);
+        }
+
+        void get_value(const iterator_data& itr, variant_ref& value) const
+        {
+            itr_accessor::get_value(itr, *m_address_data, value);
+        }
+
+        bool set_value(iterator_data& itr, argument& arg)
+        {
+            return itr_accessor::set_value(itr, *m_address_data, arg);
+        }
+
+        bool insert_value(iterator_data& itr, argument& arg)
+        {
+            return itr_accessor::insert_value(itr, *m_address_data, arg);
+        }
+
+        bool remove_value(iterator_data& itr)
+        {
+            return itr_accessor::remove_value(itr, *m_address_data);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
         std::unique_ptr<array_wrapper_base> clone() const
         {
             return detail::make_unique<array_wrapper<T, Array_Address>>(m_address_data);
         }
 
+    private:
+        void* get_data_impl(std::true_type) const
+        {
+            return const_cast<void*>(static_cast<const void*>(array_mapper<Array_Type>::get_data(*m_address_data)));
+        }
+
+        void* get_data_impl(std::false_type) const
+        {
+            return nullptr;
+        }
+
     private:
         Array_Address m_address_data;
 };
@@ -29,6 +29,7 @@
 #define RTTR_ARRAY_WRAPPER_BASE_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/iterator_storage.h"
 
 #include <vector>
 #include <cstddef>
@@ -39,6 +40,7 @@ class type;
 class variant;
 class instance;
 class argument;
+class variant_ref;
 
 namespace detail
 {
@@ -55,6 +57,17 @@ class RTTR_API array_wrapper_base
         virtual type        get_type() const    { return get_invalid_type(); }
         virtual bool        is_raw_array() const { return false; }
 
+        virtual bool        is_contiguous() const       { return false; }
+        virtual type        get_element_type() const    { return get_invalid_type(); }
+        virtual std::size_t get_stride() const          { return 0; }
+        virtual void*       get_data() const            { return nullptr; }
+
+        virtual bool        convert_to(const type& target_type, void* out, std::size_t offset, std::size_t count) const { return false; }
+
+        virtual std::size_t get_fixed_size(std::size_t dim) const { return 0; }
+        virtual bool get_element(const std::size_t* indices, variant_ref& value) const { return false; }
+        virtual bool set_element(const std::size_t* indices, argument& arg) { return false; }
+
         virtual std::size_t get_size() const    { return 0; }
         virtual std::size_t get_size(std::size_t index_1) const { return 0; }
         virtual std::size_t get_size(std::size_t index_1, std::size_t index_2) const { return 0; }
@@ -65,6 +78,10 @@ class RTTR_API array_wrapper_base
         virtual bool set_size(std::size_t new_size, std::size_t index_1, std::size_t index_2) { return false; }
         virtual bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list) { return false; }
 
+        virtual bool reserve(std::size_t new_capacity) { return false; }
+        virtual bool append_range(const void* data, std::size_t count, const type& element_type, bool move) { return false; }
+        virtual bool assign(const void* data, std::size_t count, const type& element_type, bool move) { return false; }
+
         virtual bool set_value(argument& arg) { return false; }
         virtual bool set_value(std::size_t index_1, argument& arg) { return false; }
         virtual bool set_value(std::size_t index_1, std::size_t index_2, argument& arg) { return false; }
@@ -86,6 +103,15 @@ class RTTR_API array_wrapper_base
         virtual bool remove_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) { return false; }
         virtual bool remove_value_variadic(const std::vector<std::size_t>& index_list) { return false; }
 
+        virtual const iterator_manager* create_iterator(iterator_data& itr, bool at_end) const { return nullptr; }
+        virtual const iterator_manager* create_iterator_at(iterator_data& itr, std::size_t index) const { return nullptr; }
+        virtual void advance_iterator(iterator_data& itr, bool forward) const {}
+        virtual bool equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const { return true; }
+        virtual void get_value(const iterator_data& itr, variant_ref& value) const {}
+        virtual bool set_value(iterator_data& itr, argument& arg) { return false; }
+        virtual bool insert_value(iterator_data& itr, argument& arg) { return false; }
+        virtual bool remove_value(iterator_data& itr) { return false; }
+
         virtual std::unique_ptr<array_wrapper_base> clone() const { return detail::make_unique<array_wrapper_base>(); }
 };
 
@@ -0,0 +1,245 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ASSOCIATIVE_MAPPER_IMPL_H_
+#define RTTR_ASSOCIATIVE_MAPPER_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <utility>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rttr
+{
+namespace detail
+{
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Itr>
+RTTR_INLINE std::pair<Itr, bool> make_insert_result(const std::pair<Itr, bool>& result)
+{
+    return result;
+}
+
+// the multi containers return only the iterator, because inserting will always succeed
+template<typename Itr>
+RTTR_INLINE std::pair<Itr, bool> make_insert_result(const Itr& result)
+{
+    return std::make_pair(result, true);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct associative_container_base
+{
+    using container_t   = T;
+    using key_t         = typename T::key_type;
+    using itr_t         = typename T::iterator;
+    using const_itr_t   = typename T::const_iterator;
+
+    static itr_t begin(container_t& container)
+    {
+        return container.begin();
+    }
+
+    static const_itr_t begin(const container_t& container)
+    {
+        return container.begin();
+    }
+
+    static itr_t end(container_t& container)
+    {
+        return container.end();
+    }
+
+    static const_itr_t end(const container_t& container)
+    {
+        return container.end();
+    }
+
+    static itr_t find(container_t& container, const key_t& key)
+    {
+        return container.find(key);
+    }
+
+    static const_itr_t find(const container_t& container, const key_t& key)
+    {
+        return container.find(key);
+    }
+
+    static std::size_t get_size(const container_t& container)
+    {
+        return container.size();
+    }
+
+    static void clear(container_t& container)
+    {
+        container.clear();
+    }
+
+    static std::size_t erase(container_t& container, const key_t& key)
+    {
+        return container.erase(key);
+    }
+
+    static void insert_range(container_t& container, const container_t& other)
+    {
+        container.insert(other.begin(), other.end());
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct associative_container_key_base : associative_container_base<T>
+{
+    using base          = associative_container_base<T>;
+    using key_t         = typename base::key_t;
+    using value_t       = void;
+    using itr_t         = typename base::itr_t;
+    using const_itr_t   = typename base::const_itr_t;
+
+    static const key_t& get_key(const const_itr_t& itr)
+    {
+        return *itr;
+    }
+
+    static std::pair<itr_t, bool> insert_key(T& container, const key_t& key)
+    {
+        return make_insert_result(container.insert(key));
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct associative_container_map_base : associative_container_base<T>
+{
+    using base          = associative_container_base<T>;
+    using key_t         = typename base::key_t;
+    using value_t       = typename T::mapped_type;
+    using itr_t         = typename base::itr_t;
+    using const_itr_t   = typename base::const_itr_t;
+
+    static const key_t& get_key(const const_itr_t& itr)
+    {
+        return itr->first;
+    }
+
+    static value_t& get_value(const itr_t& itr)
+    {
+        return itr->second;
+    }
+
+    static const value_t& get_value(const const_itr_t& itr)
+    {
+        return itr->second;
+    }
+
+    static std::pair<itr_t, bool> insert_key_value(T& container, const key_t& key, const value_t& value)
+    {
+        return make_insert_result(container.insert(std::make_pair(key, value)));
+    }
+};
+
+} // end namespace detail
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T, typename Compare, typename Allocator>
+struct associative_mapper<std::map<K, T, Compare, Allocator>>
+:   detail::associative_container_map_base<std::map<K, T, Compare, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T, typename Compare, typename Allocator>
+struct associative_mapper<std::multimap<K, T, Compare, Allocator>>
+:   detail::associative_container_map_base<std::multimap<K, T, Compare, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct associative_mapper<std::unordered_map<K, T, Hash, KeyEqual, Allocator>>
+:   detail::associative_container_map_base<std::unordered_map<K, T, Hash, KeyEqual, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct associative_mapper<std::unordered_multimap<K, T, Hash, KeyEqual, Allocator>>
+:   detail::associative_container_map_base<std::unordered_multimap<K, T, Hash, KeyEqual, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename Compare, typename Allocator>
+struct associative_mapper<std::set<K, Compare, Allocator>>
+:   detail::associative_container_key_base<std::set<K, Compare, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename Compare, typename Allocator>
+struct associative_mapper<std::multiset<K, Compare, Allocator>>
+:   detail::associative_container_key_base<std::multiset<K, Compare, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename Hash, typename KeyEqual, typename Allocator>
+struct associative_mapper<std::unordered_set<K, Hash, KeyEqual, Allocator>>
+:   detail::associative_container_key_base<std::unordered_set<K, Hash, KeyEqual, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename Hash, typename KeyEqual, typename Allocator>
+struct associative_mapper<std::unordered_multiset<K, Hash, KeyEqual, Allocator>>
+:   detail::associative_container_key_base<std::unordered_multiset<K, Hash, KeyEqual, Allocator>>
+{
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_ASSOCIATIVE_MAPPER_IMPL_H_
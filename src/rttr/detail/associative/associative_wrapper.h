@@ -0,0 +1,245 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ASSOCIATIVE_WRAPPER_H_
+#define RTTR_ASSOCIATIVE_WRAPPER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/misc/iterator_storage.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/detail/associative/associative_wrapper_base.h"
+#include "rttr/associative_mapper.h"
+#include "rttr/wrapper_mapper.h"
+
+#include <type_traits>
+#include <cstddef>
+
+namespace rttr
+{
+class argument;
+class variant_ref;
+
+namespace detail
+{
+
+template<typename T, typename Container_Address = wrapper_address_return_type_t<T>>
+class associative_wrapper;
+
+
+template<typename T, typename Container_Address>
+class associative_wrapper : public associative_wrapper_base
+{
+    // the container type might be const, then it cannot be modified
+    using Container     = remove_reference_t<decltype(*std::declval<Container_Address&>())>;
+    using Container_Type = typename detail::raw_type<Container_Address>::type;
+    using mapper        = associative_mapper<Container_Type>;
+    using key_t         = typename mapper::key_t;
+    using value_t       = typename mapper::value_t;
+    using itr_t         = decltype(mapper::begin(std::declval<Container&>()));
+    using storage       = iterator_storage<itr_t>;
+    using is_key_only   = std::is_void<value_t>;
+    using is_read_only  = std::is_const<Container>;
+
+    public:
+        associative_wrapper(const Container_Address& address)
+        :   m_address_data(address)
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        bool is_valid()                       const { return true; }
+        type get_type()                       const { return type::get<Container_Type>(); }
+        type get_key_type()                   const { return type::get<key_t>(); }
+        type get_value_type()                 const { return get_value_type_impl(is_key_only()); }
+        bool is_key_only_type()               const { return is_key_only::value; }
+        std::size_t get_size()                const { return mapper::get_size(*m_address_data); }
+
+        bool clear()
+        {
+            return clear_impl(is_read_only());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        const iterator_manager* create_iterator(iterator_data& itr, bool at_end) const
+        {
+            storage::create(itr, at_end ? mapper::end(*m_address_data) : mapper::begin(*m_address_data));
+            return storage::get_manager();
+        }
+
+        void advance_iterator(iterator_data& itr) const
+        {
+            ++storage::get(itr);
+        }
+
+        bool equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const
+        {
+            return (storage::get(lhs) == storage::get(rhs));
+        }
+
+        void get_key(const iterator_data& itr, variant_ref& key) const
+        {
+            key = variant_ref(mapper::get_key(storage::get(itr)));
+        }
+
+        void get_value(const iterator_data& itr, variant_ref& value) const
+        {
+            get_value_impl(itr, value, is_key_only());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        const iterator_manager* find(iterator_data& itr, argument& key) const
+        {
+            if (key.is_type<key_t>())
+                storage::create(itr, mapper::find(*m_address_data, key.get_value<key_t>()));
+            else
+                storage::create(itr, mapper::end(*m_address_data));
+
+            return storage::get_manager();
+        }
+
+        const iterator_manager* insert(iterator_data& itr, argument& key, bool& success)
+        {
+            success = false;
+            if (!insert_key_impl(itr, key, success, std::integral_constant<bool, is_key_only::value && !is_read_only::value>()))
+                storage::create(itr, mapper::end(*m_address_data));
+
+            return storage::get_manager();
+        }
+
+        const iterator_manager* insert(iterator_data& itr, argument& key, argument& value, bool& success)
+        {
+            success = false;
+            if (!insert_key_value_impl(itr, key, value, success, std::integral_constant<bool, !is_key_only::value && !is_read_only::value>()))
+                storage::create(itr, mapper::end(*m_address_data));
+
+            return storage::get_manager();
+        }
+
+        std::size_t erase(argument& key)
+        {
+            return erase_impl(key, is_read_only());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        const void* get_container() const
+        {
+            return static_cast<const void*>(&*m_address_data);
+        }
+
+        bool insert_range(const associative_wrapper_base& other)
+        {
+            return insert_range_impl(other, is_read_only());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<associative_wrapper_base> clone() const
+        {
+            return detail::make_unique<associative_wrapper<T, Container_Address>>(m_address_data);
+        }
+
+    private:
+        static type get_value_type_impl(std::false_type) { return type::get<value_t>(); }
+        static type get_value_type_impl(std::true_type) { return get_invalid_type(); }
+
+        void get_value_impl(const iterator_data& itr, variant_ref& value, std::false_type) const
+        {
+            value = variant_ref(mapper::get_value(storage::get(itr)));
+        }
+
+        void get_value_impl(const iterator_data& itr, variant_ref& value, std::true_type) const
+        {
+        }
+
+        bool clear_impl(std::false_type)
+        {
+            mapper::clear(*m_address_data);
+            return true;
+        }
+
+        bool clear_impl(std::true_type) { return false; }
+
+        bool insert_key_impl(iterator_data& itr, argument& key, bool& success, std::true_type)
+        {
+            if (!key.is_type<key_t>())
+                return false;
+
+            auto result = mapper::insert_key(*m_address_data, key.get_value<key_t>());
+            storage::create(itr, result.first);
+            success = result.second;
+            return true;
+        }
+
+        bool insert_key_impl(iterator_data&, argument&, bool&, std::false_type) { return false; }
+
+        bool insert_key_value_impl(iterator_data& itr, argument& key, argument& value, bool& success, std::true_type)
+        {
+            if (!key.is_type<key_t>() || !value.is_type<value_t>())
+                return false;
+
+            auto result = mapper::insert_key_value(*m_address_data, key.get_value<key_t>(), value.get_value<value_t>());
+            storage::create(itr, result.first);
+            success = result.second;
+            return true;
+        }
+
+        bool insert_key_value_impl(iterator_data&, argument&, argument&, bool&, std::false_type) { return false; }
+
+        std::size_t erase_impl(argument& key, std::false_type)
+        {
+            if (!key.is_type<key_t>())
+                return 0;
+
+            return mapper::erase(*m_address_data, key.get_value<key_t>());
+        }
+
+        std::size_t erase_impl(argument&, std::true_type) { return 0; }
+
+        bool insert_range_impl(const associative_wrapper_base& other, std::false_type)
+        {
+            if (other.get_type() != get_type())
+                return false;
+
+            mapper::insert_range(*m_address_data, *static_cast<const Container_Type*>(other.get_container()));
+            return true;
+        }
+
+        bool insert_range_impl(const associative_wrapper_base&, std::true_type) { return false; }
+
+    private:
+        Container_Address m_address_data;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ASSOCIATIVE_WRAPPER_H_
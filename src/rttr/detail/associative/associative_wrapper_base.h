@@ -0,0 +1,80 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ASSOCIATIVE_WRAPPER_BASE_H_
+#define RTTR_ASSOCIATIVE_WRAPPER_BASE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/iterator_storage.h"
+#include "rttr/detail/misc/utility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace rttr
+{
+class type;
+class argument;
+class variant_ref;
+
+namespace detail
+{
+
+class RTTR_API associative_wrapper_base
+{
+    public:
+        associative_wrapper_base() {}
+        virtual ~associative_wrapper_base() {};
+        virtual bool        is_valid() const            { return false; }
+        virtual type        get_type() const            { return get_invalid_type(); }
+        virtual type        get_key_type() const        { return get_invalid_type(); }
+        virtual type        get_value_type() const      { return get_invalid_type(); }
+        virtual bool        is_key_only_type() const    { return false; }
+        virtual std::size_t get_size() const            { return 0; }
+        virtual bool        clear()                     { return false; }
+
+        virtual const iterator_manager* create_iterator(iterator_data& itr, bool at_end) const { return nullptr; }
+        virtual void advance_iterator(iterator_data& itr) const {}
+        virtual bool equal_iterator(const iterator_data& lhs, const iterator_data& rhs) const { return true; }
+        virtual void get_key(const iterator_data& itr, variant_ref& key) const {}
+        virtual void get_value(const iterator_data& itr, variant_ref& value) const {}
+
+        virtual const iterator_manager* find(iterator_data& itr, argument& key) const { return nullptr; }
+        virtual const iterator_manager* insert(iterator_data& itr, argument& key, bool& success) { return nullptr; }
+        virtual const iterator_manager* insert(iterator_data& itr, argument& key, argument& value, bool& success) { return nullptr; }
+        virtual std::size_t erase(argument& key) { return 0; }
+
+        virtual const void* get_container() const { return nullptr; }
+        virtual bool insert_range(const associative_wrapper_base& other) { return false; }
+
+        virtual std::unique_ptr<associative_wrapper_base> clone() const { return detail::make_unique<associative_wrapper_base>(); }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ASSOCIATIVE_WRAPPER_BASE_H_
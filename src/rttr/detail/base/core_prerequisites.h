@@ -149,6 +149,9 @@ namespace rttr
 #   if RTTR_COMP_VER <= 190023026
 #       define RTTR_NO_CXX11_NOEXCEPT
 #   endif
+#   if RTTR_COMP_VER < 1900
+#       define RTTR_NO_CXX11_THREAD_LOCAL
+#   endif
 #   if !defined(__cpp_constexpr) || (__cpp_constexpr < 201304)
 #       define RTTR_NO_CXX11_CONSTEXPR
 #       define RTTR_NO_CXX14_CONSTEXPR
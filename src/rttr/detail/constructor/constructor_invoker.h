@@ -31,6 +31,12 @@
 #include "rttr/detail/misc/function_traits.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/policies/ctor_policies.h"
+#include "rttr/argument.h"
+#include "rttr/object_pool.h"
+
+#include <new>
+#include <tuple>
+#include <cstdint>
 
 namespace rttr
 {
@@ -41,6 +47,12 @@ struct ctor_type { };
 
 struct ctor_func_type { };
 
+/*!
+ * Internal policy to construct an object into memory provided by the caller.
+ * It is not part of the \ref constructor_policy_list, because the caller owns the memory, independent of the registered policy.
+ */
+struct placement_new { };
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Ctor_Type, typename Policy, typename Accessor, typename Arg_Indexer>
@@ -57,14 +69,35 @@ struct constructor_invoker<ctor_type, as_raw_pointer, type_list<Class_Type, Ctor
     static RTTR_FORCE_INLINE variant invoke(TArgs&&...args)
     {
         if (check_all_true(args. template is_type<Ctor_Args>()...))
+        {
+            if (object_allocator* allocator = type::get<Class_Type>().get_allocator())
+            {
+                void* storage = allocator->allocate(sizeof(Class_Type), alignof(Class_Type));
+                return (storage ? variant(::new (storage) Class_Type(args. template get_value<Ctor_Args>()...)) : variant());
+            }
+
             return variant(new Class_Type(args. template get_value<Ctor_Args>()...));
+        }
         else
+        {
             return variant();
+        }
     }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * The objects are created like with \ref as_raw_pointer; the allocator of the type is created on registration.
+ */
+template<typename Class_Type, typename...Ctor_Args, std::size_t... Arg_Count>
+struct constructor_invoker<ctor_type, as_pooled, type_list<Class_Type, Ctor_Args...>, index_sequence<Arg_Count...>>
+:   constructor_invoker<ctor_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence<Arg_Count...>>
+{
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename Class_Type, typename...Ctor_Args, std::size_t... Arg_Count>
 struct constructor_invoker<ctor_type, as_object, type_list<Class_Type, Ctor_Args...>, index_sequence<Arg_Count...>>
 {
@@ -100,6 +133,72 @@ struct constructor_invoker<ctor_type, as_std_shared_ptr, type_list<Class_Type, C
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename Class_Type, typename...Ctor_Args, std::size_t... Arg_Index>
+struct constructor_invoker<ctor_type, placement_new, type_list<Class_Type, Ctor_Args...>, index_sequence<Arg_Index...>>
+{
+    using return_type = add_pointer_t<Class_Type>;
+
+    template<typename... TArgs>
+    static RTTR_FORCE_INLINE variant invoke(void* storage, TArgs&&...args)
+    {
+        if (!storage || (reinterpret_cast<std::uintptr_t>(storage) % alignof(Class_Type)) != 0)
+            return variant();
+
+        if (check_all_true(args. template is_type<Ctor_Args>()...))
+            return variant(::new (storage) Class_Type(args. template get_value<Ctor_Args>()...));
+        else
+            return variant();
+    }
+
+    /*!
+     * Invokes the constructor with the arguments \p args; \p arg_count has to match the number of constructor parameters.
+     */
+    static RTTR_INLINE variant invoke_with_args(void* storage, const argument* args, std::size_t arg_count)
+    {
+        if (arg_count == sizeof...(Ctor_Args))
+            return invoke(storage, args[Arg_Index]...);
+        else
+            return variant();
+    }
+
+    /*!
+     * Invokes the constructor with the arguments \p args, the missing trailing arguments are taken from \p def_args.
+     */
+    template<typename... Def_Types>
+    static RTTR_INLINE variant invoke_with_args(void* storage, const argument* args, std::size_t arg_count,
+                                               const std::tuple<Def_Types...>& def_args)
+    {
+        if (arg_count > sizeof...(Ctor_Args) || arg_count + sizeof...(Def_Types) < sizeof...(Ctor_Args))
+            return variant();
+
+        return invoke(storage, get_arg_or_default<Arg_Index>(args, arg_count, def_args)...);
+    }
+
+private:
+    template<std::size_t Index, typename... Def_Types>
+    static RTTR_INLINE argument get_arg_or_default(const argument* args, std::size_t arg_count,
+                                                   const std::tuple<Def_Types...>& def_args)
+    {
+        using has_default = std::integral_constant<bool, (Index + sizeof...(Def_Types) >= sizeof...(Ctor_Args))>;
+        return (Index < arg_count) ? args[Index] : get_default_arg<Index>(def_args, has_default());
+    }
+
+    template<std::size_t Index, typename... Def_Types>
+    static RTTR_INLINE argument get_default_arg(const std::tuple<Def_Types...>& def_args, std::true_type)
+    {
+        return argument(std::get<Index + sizeof...(Def_Types) - sizeof...(Ctor_Args)>(def_args));
+    }
+
+    template<std::size_t Index, typename... Def_Types>
+    static RTTR_INLINE argument get_default_arg(const std::tuple<Def_Types...>&, std::false_type)
+    {
+        // not reachable, the argument count was checked before
+        return argument();
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
 
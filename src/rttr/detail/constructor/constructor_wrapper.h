@@ -75,6 +75,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using placement_invoker = constructor_invoker<ctor_type, placement_new, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -103,6 +104,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
                                                                                                        m_param_info_list.size()); }
 
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         template<typename... TArgs>
         static RTTR_FORCE_INLINE
@@ -164,6 +166,11 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
 
+        variant invoke_at(void* storage, const argument* args, std::size_t arg_count) const
+        {
+            return placement_invoker::invoke_with_args(storage, args, arg_count);
+        }
+
     private:
         parameter_infos<Param_Args...> m_param_infos;
         std::array<parameter_info, sizeof...(Param_Args)> m_param_info_list;
@@ -202,6 +209,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
                                                                                                        m_param_info_list.size()); }
 
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -253,6 +261,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using placement_invoker = constructor_invoker<ctor_type, placement_new, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -278,6 +287,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         template<typename... TArgs>
         static RTTR_FORCE_INLINE
@@ -338,6 +348,11 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         {
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
+
+        variant invoke_at(void* storage, const argument* args, std::size_t arg_count) const
+        {
+            return placement_invoker::invoke_with_args(storage, args, arg_count);
+        }
 };
 
 
@@ -370,6 +385,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         std::vector<bool> get_is_const()                    const { return method_accessor<F, Policy>::get_is_const();      }
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
+#include "rttr/variant.h"
 
 using namespace std;
 
@@ -67,6 +68,13 @@ string_view constructor_wrapper_base::get_signature() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant constructor_wrapper_base::invoke_at(void* storage, const argument* args, std::size_t arg_count) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void constructor_wrapper_base::create_signature_string()
 {
     if (!m_signature.empty())
@@ -67,6 +67,7 @@ class RTTR_API constructor_wrapper_base
         virtual std::vector<bool> get_is_const() const = 0;
         virtual array_range<parameter_info> get_parameter_infos() const = 0;
         virtual variant get_metadata(const variant& key) const = 0;
+        virtual variant get_metadata(const metadata_key& key) const = 0;
 
         virtual variant invoke() const = 0;
         virtual variant invoke(argument& arg1) const = 0;
@@ -79,6 +80,9 @@ class RTTR_API constructor_wrapper_base
                                argument& arg5, argument& arg6) const = 0;
 
         virtual variant invoke_variadic(std::vector<argument>& args) const = 0;
+
+        //! Constructs the object into \p storage; constructors, which are created via a function, cannot do this.
+        virtual variant invoke_at(void* storage, const argument* args, std::size_t arg_count) const;
     protected:
         void init();
     private:
@@ -62,6 +62,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
         using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+        using placement_invoker = constructor_invoker<ctor_type, placement_new, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
         using instanciated_type = typename invoker_class::return_type;
         using invoke_with_defaults = invoke_defaults_helper<invoker_class, type_list<Ctor_Args...>>;
 
@@ -93,6 +94,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(m_param_info_list.data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -132,6 +134,11 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
                 return variant();
         }
 
+        variant invoke_at(void* storage, const argument* args, std::size_t arg_count) const
+        {
+            return placement_invoker::invoke_with_args(storage, args, arg_count, m_def_args.m_args);
+        }
+
     private:
         default_args<Def_Args...> m_def_args;
         parameter_infos<Param_Args...> m_param_infos;
@@ -174,6 +181,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(m_param_info_list.data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -227,6 +235,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
         using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+        using placement_invoker = constructor_invoker<ctor_type, placement_new, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
         using instanciated_type = typename invoker_class::return_type;
         using invoke_with_defaults = invoke_defaults_helper<invoker_class, type_list<Ctor_Args...>>;
 
@@ -255,6 +264,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -294,6 +304,11 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
                 return variant();
         }
 
+        variant invoke_at(void* storage, const argument* args, std::size_t arg_count) const
+        {
+            return placement_invoker::invoke_with_args(storage, args, arg_count, m_def_args.m_args);
+        }
+
     private:
         default_args<Def_Args...> m_def_args;
 };
@@ -331,6 +346,7 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         std::vector<bool> get_is_const()                    const { return method_accessor<F, Policy>::get_is_const();          }
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>();                       }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke() const
         {
@@ -25,311 +25,996 @@
 *                                                                                   *
 *************************************************************************************/
 
+
 #include "rttr/detail/conversion/std_conversion_functions.h"
 
 #include "rttr/detail/conversion/number_conversion.h"
 
-#include <sstream>
-#include <locale>
 #include <limits>
-#include <algorithm>
-#include <climits>
-#include <iomanip>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cfloat>
+#include <clocale>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#   include <locale.h>
+#   include <stdlib.h>
+#elif RTTR_PLATFORM == RTTR_PLATFORM_APPLE
+#   include <xlocale.h>
+#else
+#   include <locale.h>
+#   include <stdlib.h>
+#endif
 
 namespace rttr
 {
 namespace detail
 {
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The conversion functions in this file do not use iostreams, exceptions or the global locale.
+// Floating point numbers are printed with the Grisu2 algorithm of Florian Loitsch
+// ("Printing Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010),
+// which creates the shortest decimal representation that converts back to the same binary value.
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-std::string to_string_impl(T value, bool* ok)
+static const char g_digit_pairs[201] = "00010203040506070809"
+                                       "10111213141516171819"
+                                       "20212223242526272829"
+                                       "30313233343536373839"
+                                       "40414243444546474849"
+                                       "50515253545556575859"
+                                       "60616263646566676869"
+                                       "70717273747576777879"
+                                       "80818283848586878889"
+                                       "90919293949596979899";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the decimal digits of \p value backwards, starting at \p buffer_end.
+ *
+ * \return The position of the first written character.
+ */
+static RTTR_INLINE char* write_unsigned_backwards(unsigned long long value, char* buffer_end)
 {
-    try
+    char* itr = buffer_end;
+    while (value >= 100)
+    {
+        const auto index = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+        *--itr = g_digit_pairs[index + 1];
+        *--itr = g_digit_pairs[index];
+    }
+
+    if (value >= 10)
     {
-        std::string text = std::to_string(value);
-        if (ok)
-            *ok = true;
-        return text;
+        const auto index = static_cast<std::size_t>(value) * 2;
+        *--itr = g_digit_pairs[index + 1];
+        *--itr = g_digit_pairs[index];
     }
-    catch (...)
+    else
     {
-        if (ok)
-            *ok = false;
-        return std::string();
+        *--itr = static_cast<char>('0' + value);
     }
+
+    return itr;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(int value, bool* ok)
+template<typename T>
+static RTTR_INLINE std::string unsigned_to_string(T value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    char buffer[std::numeric_limits<unsigned long long>::digits10 + 1];
+    char* const buffer_end = buffer + sizeof(buffer);
+    char* first = write_unsigned_backwards(value, buffer_end);
+
+    if (ok)
+        *ok = true;
+
+    return std::string(first, buffer_end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(long value, bool* ok)
+template<typename T>
+static RTTR_INLINE std::string signed_to_string(T value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    char buffer[std::numeric_limits<unsigned long long>::digits10 + 2];
+    char* const buffer_end = buffer + sizeof(buffer);
+    // negate in the unsigned domain, so that the minimum value does not overflow
+    const unsigned long long abs_value = (value < 0) ? 0ull - static_cast<unsigned long long>(value)
+                                                     : static_cast<unsigned long long>(value);
+    char* first = write_unsigned_backwards(abs_value, buffer_end);
+    if (value < 0)
+        *--first = '-';
+
+    if (ok)
+        *ok = true;
+
+    return std::string(first, buffer_end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(long long value, bool* ok)
+/*!
+ * A floating point number with a 64 bit significand and a binary exponent; value = f * 2^e.
+ */
+struct diy_fp
 {
-    return to_string_impl(value, ok);
-}
+    uint64_t    f;
+    int         e;
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(unsigned value, bool* ok)
+static RTTR_INLINE diy_fp diy_fp_sub(const diy_fp& x, const diy_fp& y)
 {
-    return to_string_impl(value, ok);
+    return diy_fp{x.f - y.f, x.e};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(unsigned long value, bool* ok)
+/*!
+ * Returns the upper 64 bit of the 128 bit product x.f * y.f (rounded) with the adjusted exponent.
+ */
+static RTTR_INLINE diy_fp diy_fp_mul(const diy_fp& x, const diy_fp& y)
 {
-    return to_string_impl(value, ok);
+    const uint64_t u_lo = x.f & 0xFFFFFFFFu;
+    const uint64_t u_hi = x.f >> 32u;
+    const uint64_t v_lo = y.f & 0xFFFFFFFFu;
+    const uint64_t v_hi = y.f >> 32u;
+
+    const uint64_t p0 = u_lo * v_lo;
+    const uint64_t p1 = u_lo * v_hi;
+    const uint64_t p2 = u_hi * v_lo;
+    const uint64_t p3 = u_hi * v_hi;
+
+    uint64_t q = (p0 >> 32u) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+    q += uint64_t{1} << 31u; // round
+
+    return diy_fp{p3 + (p1 >> 32u) + (p2 >> 32u) + (q >> 32u), x.e + y.e + 64};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(unsigned long long value, bool* ok)
+static RTTR_INLINE diy_fp diy_fp_normalize(diy_fp x)
 {
-    return to_string_impl(value, ok);
+    while ((x.f >> 63u) == 0)
+    {
+        x.f <<= 1u;
+        x.e--;
+    }
+    return x;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(float value, bool* ok)
+static RTTR_INLINE diy_fp diy_fp_normalize_to(const diy_fp& x, int target_exponent)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<float>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    return diy_fp{x.f << (x.e - target_exponent), target_exponent};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(double value, bool* ok)
+/*!
+ * The normalized value \p w and its normalized boundaries \p minus and \p plus;
+ * every number inside (minus, plus) will be read back as the same floating point number.
+ */
+struct fp_boundaries
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    diy_fp w;
+    diy_fp minus;
+    diy_fp plus;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Bits_Type>
+static RTTR_INLINE fp_boundaries compute_boundaries(T value)
+{
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE-754 floating point numbers are supported.");
+    static_assert(sizeof(T) == sizeof(Bits_Type), "Invalid bit representation type.");
+
+    const int precision     = std::numeric_limits<T>::digits; // including the hidden bit
+    const int bias          = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    const int min_exponent  = 1 - bias;
+    const uint64_t hidden_bit = uint64_t{1} << (precision - 1);
+
+    Bits_Type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint64_t biased_exponent  = static_cast<uint64_t>(bits) >> (precision - 1);
+    const uint64_t fraction         = static_cast<uint64_t>(bits) & (hidden_bit - 1);
+
+    const diy_fp v = (biased_exponent == 0) ? diy_fp{fraction, min_exponent}
+                                            : diy_fp{fraction + hidden_bit, static_cast<int>(biased_exponent) - bias};
+
+    // the distance to the lower neighbor is only half as big, when the significand is a power of two
+    const bool lower_boundary_is_closer = (fraction == 0 && biased_exponent > 1);
+    const diy_fp m_plus  = diy_fp{2 * v.f + 1, v.e - 1};
+    const diy_fp m_minus = lower_boundary_is_closer ? diy_fp{4 * v.f - 1, v.e - 2}
+                                                    : diy_fp{2 * v.f - 1, v.e - 1};
+
+    const diy_fp w_plus = diy_fp_normalize(m_plus);
+    return fp_boundaries{diy_fp_normalize(v), diy_fp_normalize_to(m_minus, w_plus.e), w_plus};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+struct cached_power
+{
+    uint64_t    f;
+    int         e;
+    int         k;
+};
+
+// normalized powers of ten: 10^k ~= f * 2^e, for k = -300, -292, ..., 324
+static const int g_cached_powers_min_dec_exp    = -300;
+static const int g_cached_powers_dec_step       = 8;
+static const cached_power g_cached_powers[] =
+{
+    { 0xAB70FE17C79AC6CAull, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+    { 0xBE5691EF416BD60Cull, -1007, -284 },
+    { 0x8DD01FAD907FFC3Cull,  -980, -276 },
+    { 0xD3515C2831559A83ull,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ull,  -927, -260 },
+    { 0xEA9C227723EE8BCBull,  -901, -252 },
+    { 0xAECC49914078536Dull,  -874, -244 },
+    { 0x823C12795DB6CE57ull,  -847, -236 },
+    { 0xC21094364DFB5637ull,  -821, -228 },
+    { 0x9096EA6F3848984Full,  -794, -220 },
+    { 0xD77485CB25823AC7ull,  -768, -212 },
+    { 0xA086CFCD97BF97F4ull,  -741, -204 },
+    { 0xEF340A98172AACE5ull,  -715, -196 },
+    { 0xB23867FB2A35B28Eull,  -688, -188 },
+    { 0x84C8D4DFD2C63F3Bull,  -661, -180 },
+    { 0xC5DD44271AD3CDBAull,  -635, -172 },
+    { 0x936B9FCEBB25C996ull,  -608, -164 },
+    { 0xDBAC6C247D62A584ull,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ull,  -555, -148 },
+    { 0xF3E2F893DEC3F126ull,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ull,  -502, -132 },
+    { 0x87625F056C7C4A8Bull,  -475, -124 },
+    { 0xC9BCFF6034C13053ull,  -449, -116 },
+    { 0x964E858C91BA2655ull,  -422, -108 },
+    { 0xDFF9772470297EBDull,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88Full,  -369,  -92 },
+    { 0xF8A95FCF88747D94ull,  -343,  -84 },
+    { 0xB94470938FA89BCFull,  -316,  -76 },
+    { 0x8A08F0F8BF0F156Bull,  -289,  -68 },
+    { 0xCDB02555653131B6ull,  -263,  -60 },
+    { 0x993FE2C6D07B7FACull,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ull,  -210,  -44 },
+    { 0xAA242499697392D3ull,  -183,  -36 },
+    { 0xFD87B5F28300CA0Eull,  -157,  -28 },
+    { 0xBCE5086492111AEBull,  -130,  -20 },
+    { 0x8CBCCC096F5088CCull,  -103,  -12 },
+    { 0xD1B71758E219652Cull,   -77,   -4 },
+    { 0x9C40000000000000ull,   -50,    4 },
+    { 0xE8D4A51000000000ull,   -24,   12 },
+    { 0xAD78EBC5AC620000ull,     3,   20 },
+    { 0x813F3978F8940984ull,    30,   28 },
+    { 0xC097CE7BC90715B3ull,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ull,    83,   44 },
+    { 0xD5D238A4ABE98068ull,   109,   52 },
+    { 0x9F4F2726179A2245ull,   136,   60 },
+    { 0xED63A231D4C4FB27ull,   162,   68 },
+    { 0xB0DE65388CC8ADA8ull,   189,   76 },
+    { 0x83C7088E1AAB65DBull,   216,   84 },
+    { 0xC45D1DF942711D9Aull,   242,   92 },
+    { 0x924D692CA61BE758ull,   269,  100 },
+    { 0xDA01EE641A708DEAull,   295,  108 },
+    { 0xA26DA3999AEF774Aull,   322,  116 },
+    { 0xF209787BB47D6B85ull,   348,  124 },
+    { 0xB454E4A179DD1877ull,   375,  132 },
+    { 0x865B86925B9BC5C2ull,   402,  140 },
+    { 0xC83553C5C8965D3Dull,   428,  148 },
+    { 0x952AB45CFA97A0B3ull,   455,  156 },
+    { 0xDE469FBD99A05FE3ull,   481,  164 },
+    { 0xA59BC234DB398C25ull,   508,  172 },
+    { 0xF6C69A72A3989F5Cull,   534,  180 },
+    { 0xB7DCBF5354E9BECEull,   561,  188 },
+    { 0x88FCF317F22241E2ull,   588,  196 },
+    { 0xCC20CE9BD35C78A5ull,   614,  204 },
+    { 0x98165AF37B2153DFull,   641,  212 },
+    { 0xE2A0B5DC971F303Aull,   667,  220 },
+    { 0xA8D9D1535CE3B396ull,   694,  228 },
+    { 0xFB9B7CD9A4A7443Cull,   720,  236 },
+    { 0xBB764C4CA7A44410ull,   747,  244 },
+    { 0x8BAB8EEFB6409C1Aull,   774,  252 },
+    { 0xD01FEF10A657842Cull,   800,  260 },
+    { 0x9B10A4E5E9913129ull,   827,  268 },
+    { 0xE7109BFBA19C0C9Dull,   853,  276 },
+    { 0xAC2820D9623BF429ull,   880,  284 },
+    { 0x80444B5E7AA7CF85ull,   907,  292 },
+    { 0xBF21E44003ACDD2Dull,   933,  300 },
+    { 0x8E679C2F5E44FF8Full,   960,  308 },
+    { 0xD433179D9C8CB841ull,   986,  316 },
+    { 0x9E19DB92B4E31BA9ull,  1013,  324 },
+};
+
+// the range for the binary exponent of the scaled value, so that the integral part fits into 32 bit
+static const int g_grisu_alpha = -60;
+static const int g_grisu_gamma = -32;
+
 /////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a cached power of ten c = f * 2^e, so that alpha <= c.e + e + 64 <= gamma.
+ */
+static RTTR_INLINE cached_power get_cached_power_for_binary_exponent(int e)
+{
+    // k = ceil((alpha - e - 1) * log10(2)); 78913 / 2^18 approximates log10(2)
+    const int f = g_grisu_alpha - e - 1;
+    const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+    const int index = (-g_cached_powers_min_dec_exp + k + (g_cached_powers_dec_step - 1)) / g_cached_powers_dec_step;
+
+    return g_cached_powers[index];
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool string_to_bool(std::string text, bool* ok)
+/*!
+ * Returns the number of decimal digits of \p n and stores the biggest power of ten, which is <= \p n, in \p pow10.
+ */
+static RTTR_INLINE int find_largest_pow10(uint32_t n, uint32_t& pow10)
 {
-    std::transform(text.begin(), text.end(), text.begin(), ::tolower);
-    text.erase( std::remove_if( text.begin(), text.end(), []( char ch ) { return std::isspace<char>( ch, std::locale::classic() ); } ), text.end() );
+    if (n >= 1000000000) { pow10 = 1000000000; return 10; }
+    if (n >= 100000000)  { pow10 = 100000000;  return  9; }
+    if (n >= 10000000)   { pow10 = 10000000;   return  8; }
+    if (n >= 1000000)    { pow10 = 1000000;    return  7; }
+    if (n >= 100000)     { pow10 = 100000;     return  6; }
+    if (n >= 10000)      { pow10 = 10000;      return  5; }
+    if (n >= 1000)       { pow10 = 1000;       return  4; }
+    if (n >= 100)        { pow10 = 100;        return  3; }
+    if (n >= 10)         { pow10 = 10;         return  2; }
+
+    pow10 = 1;
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
 
-    if (text == "false" || text == "0" || text.empty())
+/*!
+ * Moves the last generated digit closer to the exact value \p w, as long as the result stays inside the rounding interval.
+ */
+static RTTR_INLINE void grisu2_round(char* buffer, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+{
+    while (rest < dist &&
+           delta - rest >= ten_k &&
+           (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
     {
-        if (ok)
-            *ok = true;
-        return false;
+        buffer[length - 1]--;
+        rest += ten_k;
     }
-
-    if (ok)
-        *ok = true;
-
-    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-int string_to_int(const std::string& source, bool* ok)
+static void grisu2_digit_gen(char* buffer, int& length, int& decimal_exponent,
+                             diy_fp m_minus, diy_fp w, diy_fp m_plus)
 {
-    try
+    uint64_t delta  = diy_fp_sub(m_plus, m_minus).f;
+    uint64_t dist   = diy_fp_sub(m_plus, w).f;
+
+    const diy_fp one{uint64_t{1} << -m_plus.e, m_plus.e};
+
+    uint32_t p1 = static_cast<uint32_t>(m_plus.f >> -one.e); // integral part
+    uint64_t p2 = m_plus.f & (one.f - 1);                     // fractional part
+
+    uint32_t pow10;
+    int n = find_largest_pow10(p1, pow10);
+
+    while (n > 0)
     {
-        std::size_t pos = 0;
-        const int value = std::stoi(source, &pos);
-        if (pos == source.length())
+        const uint32_t digit = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + digit);
+        --n;
+
+        const uint64_t rest = (uint64_t{p1} << -one.e) + p2;
+        if (rest <= delta)
         {
-            if (ok)
-                *ok = true;
-            return value;
+            decimal_exponent += n;
+            grisu2_round(buffer, length, dist, delta, rest, uint64_t{pow10} << -one.e);
+            return;
         }
+
+        pow10 /= 10;
     }
-    catch (...)
+
+    int m = 0;
+    for (;;)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        p2      *= 10;
+        delta   *= 10;
+        dist    *= 10;
+
+        const uint64_t digit = p2 >> -one.e;
+        p2 &= one.f - 1;
+        buffer[length++] = static_cast<char>('0' + digit);
+        ++m;
+
+        if (p2 <= delta)
+            break;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    decimal_exponent -= m;
+    grisu2_round(buffer, length, dist, delta, p2, one.f);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long string_to_ulong(const std::string& source, bool* ok)
+/*!
+ * Generates the shortest digits of a positive, finite floating point number \p value.
+ * The result is: value == buffer[0..length) * 10^decimal_exponent
+ */
+template<typename T, typename Bits_Type>
+static RTTR_INLINE void grisu2(char* buffer, int& length, int& decimal_exponent, T value)
+{
+    const fp_boundaries b = compute_boundaries<T, Bits_Type>(value);
+
+    const cached_power cached = get_cached_power_for_binary_exponent(b.plus.e);
+    const diy_fp c_minus_k{cached.f, cached.e};
+
+    const diy_fp w          = diy_fp_mul(b.w, c_minus_k);
+    const diy_fp w_minus    = diy_fp_mul(b.minus, c_minus_k);
+    const diy_fp w_plus     = diy_fp_mul(b.plus, c_minus_k);
+
+    // the products are not exact, so the interval is narrowed by one unit on both sides
+    const diy_fp m_minus{w_minus.f + 1, w_minus.e};
+    const diy_fp m_plus{w_plus.f - 1, w_plus.e};
+
+    length = 0;
+    decimal_exponent = -cached.k;
+    grisu2_digit_gen(buffer, length, decimal_exponent, m_minus, w, m_plus);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Formats the digits like the 'printf' conversion "%g" does, but with \p precision significant digits;
+ * i.e. the scientific notation is used, when the exponent is less than -4 or greater than or equal to \p precision.
+ */
+static char* format_digits(char* out, const char* digits, int length, int decimal_exponent, int precision)
 {
-    try
+    const int exponent = length + decimal_exponent - 1; // exponent of the scientific notation
+
+    if (exponent < -4 || exponent >= precision)
     {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        unsigned long result = 0;
-        if (pos == source.length() && convert_to(value, result))
+        *out++ = digits[0];
+        if (length > 1)
         {
-            if (ok)
-                *ok = true;
-            return result;
+            *out++ = '.';
+            std::memcpy(out, digits + 1, static_cast<std::size_t>(length - 1));
+            out += length - 1;
         }
+
+        *out++ = 'e';
+        *out++ = (exponent < 0) ? '-' : '+';
+        const int abs_exponent = (exponent < 0) ? -exponent : exponent;
+        if (abs_exponent < 10)
+            *out++ = '0';
+
+        char buffer[4];
+        const char* first = write_unsigned_backwards(static_cast<unsigned long long>(abs_exponent), buffer + sizeof(buffer));
+        const std::size_t count = static_cast<std::size_t>(buffer + sizeof(buffer) - first);
+        std::memcpy(out, first, count);
+        return (out + count);
     }
-    catch (...)
+
+    if (decimal_exponent >= 0)
+    {
+        // 1234e3 => 1234000
+        std::memcpy(out, digits, static_cast<std::size_t>(length));
+        out += length;
+        std::memset(out, '0', static_cast<std::size_t>(decimal_exponent));
+        return (out + decimal_exponent);
+    }
+
+    const int integral_digits = length + decimal_exponent;
+    if (integral_digits > 0)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        // 1234e-2 => 12.34
+        std::memcpy(out, digits, static_cast<std::size_t>(integral_digits));
+        out += integral_digits;
+        *out++ = '.';
+        std::memcpy(out, digits + integral_digits, static_cast<std::size_t>(length - integral_digits));
+        return (out + length - integral_digits);
     }
 
+    // 1234e-6 => 0.001234
+    *out++ = '0';
+    *out++ = '.';
+    std::memset(out, '0', static_cast<std::size_t>(-integral_digits));
+    out += -integral_digits;
+    std::memcpy(out, digits, static_cast<std::size_t>(length));
+    return (out + length);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Bits_Type>
+static RTTR_INLINE std::string floating_point_to_string(T value, bool* ok)
+{
     if (ok)
-        *ok = false;
-    return 0;
+        *ok = true;
+
+    if (value != value)
+        return std::string("nan");
+
+    const bool is_negative = std::signbit(value);
+    if (value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+        return std::string(is_negative ? "-inf" : "inf");
+
+    if (value == 0)
+        return std::string(is_negative ? "-0" : "0");
+
+    // sign + 17 digits + '.' + 'e' + exponent sign + 3 exponent digits; or sign + "0." + 4 zeros + 17 digits
+    char buffer[32];
+    char* out = buffer;
+    if (is_negative)
+    {
+        *out++ = '-';
+        value = -value;
+    }
+
+    char digits[std::numeric_limits<T>::max_digits10 + 1];
+    int length = 0;
+    int decimal_exponent = 0;
+    grisu2<T, Bits_Type>(digits, length, decimal_exponent, value);
+
+    out = format_digits(out, digits, length, decimal_exponent, std::numeric_limits<T>::max_digits10);
+    return std::string(buffer, out);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
-long long string_to_long_long(const std::string& source, bool* ok)
+//! Returns true for the white-space characters of the "C" locale.
+static RTTR_INLINE bool is_space(char c)
+{
+    return (c == ' ' || (c >= '\t' && c <= '\r'));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_digit(char c)
+{
+    return (static_cast<unsigned char>(c - '0') < 10);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses the decimal digits in [\p itr, \p end) into \p value.
+ *
+ * \return `false` when no digit is available, when a non digit character was found or when the value is bigger than \p max_value.
+ */
+static RTTR_INLINE bool parse_digits(const char* itr, const char* end, unsigned long long max_value, unsigned long long& value)
 {
-    try
+    if (itr == end)
+        return false;
+
+    value = 0;
+    for (; itr != end; ++itr)
     {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
+        const unsigned digit = static_cast<unsigned char>(*itr - '0');
+        if (digit > 9)
+            return false;
+
+        if (value > (max_value - digit) / 10)
+            return false;
+
+        value = value * 10 + digit;
     }
-    catch (...)
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses a signed integer with the same syntax like `std::strtol` for base 10:
+ * optional leading white-spaces, an optional sign and at least one digit; the whole \p source has to be consumed.
+ */
+template<typename T>
+static RTTR_INLINE bool parse_signed(const std::string& source, T& result)
+{
+    const char* itr = source.data();
+    const char* const end = itr + source.size();
+
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    bool is_negative = false;
+    if (itr != end && (*itr == '-' || *itr == '+'))
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        is_negative = (*itr == '-');
+        ++itr;
     }
 
+    const unsigned long long max_value = is_negative ? 0ull - static_cast<unsigned long long>(std::numeric_limits<T>::min())
+                                                     : static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    unsigned long long value;
+    if (!parse_digits(itr, end, max_value, value))
+        return false;
+
+    result = is_negative ? static_cast<T>(0ull - value) : static_cast<T>(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T set_result(T value, bool success, bool* ok)
+{
     if (ok)
-        *ok = false;
-    return 0;
+        *ok = success;
+
+    return (success ? value : T(0));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
+static const double g_exact_powers_of_ten[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses decimal floating point numbers ([white-spaces][sign]digits[.digits][(e|E)[sign]digits]),
+ * when the result can be calculated exactly with one multiplication or division (Clinger's fast path).
+ *
+ * \return `false` when the input has another format or cannot be handled exactly; the caller has to use the slow path then.
+ */
+template<typename T>
+static bool parse_floating_point_fast(const std::string& source, T& result)
 {
-    try
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    const char* itr = source.data();
+    const char* const end = itr + source.size();
+
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    bool is_negative = false;
+    if (itr != end && (*itr == '-' || *itr == '+'))
+    {
+        is_negative = (*itr == '-');
+        ++itr;
+    }
+
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+
+    for (; itr != end && is_digit(*itr); ++itr)
+    {
+        has_digits = true;
+        if (mantissa == 0 && *itr == '0')
+            continue;
+
+        if (++significant_digits > 19)
+            return false;
+
+        mantissa = mantissa * 10 + static_cast<unsigned>(*itr - '0');
+    }
+
+    if (itr != end && *itr == '.')
     {
-        std::size_t pos = 0;
-        const auto itr = std::find_if(source.begin(), source.end(), [](char c){ return !std::isdigit(c, std::locale()); });
-        if (itr == source.end())
+        ++itr;
+        for (; itr != end && is_digit(*itr); ++itr)
         {
-            const unsigned long long value = std::stoull(source, &pos);
-            if (pos == source.length())
-            {
-                if (ok)
-                    *ok = true;
-                return value;
-            }
+            has_digits = true;
+            --exponent;
+            if (mantissa == 0 && *itr == '0')
+                continue;
+
+            if (++significant_digits > 19)
+                return false;
+
+            mantissa = mantissa * 10 + static_cast<unsigned>(*itr - '0');
         }
     }
-    catch (...)
+
+    if (!has_digits)
+        return false;
+
+    if (itr != end && (*itr == 'e' || *itr == 'E'))
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        ++itr;
+        bool is_exp_negative = false;
+        if (itr != end && (*itr == '-' || *itr == '+'))
+        {
+            is_exp_negative = (*itr == '-');
+            ++itr;
+        }
+
+        unsigned long long exp_value;
+        if (!parse_digits(itr, end, 10000, exp_value))
+            return false;
+
+        exponent += is_exp_negative ? -static_cast<int>(exp_value) : static_cast<int>(exp_value);
+        itr = end;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    if (itr != end)
+        return false;
+
+    // the mantissa and the power of ten have to be exactly representable
+    const uint64_t max_mantissa = uint64_t{1} << std::numeric_limits<T>::digits;
+    const int max_exponent = (std::numeric_limits<T>::digits > 24) ? 22 : 10;
+
+    T value;
+    if (mantissa == 0)
+        value = T(0);
+    else if (mantissa > max_mantissa || exponent < -max_exponent || exponent > max_exponent)
+        return false;
+    else if (exponent < 0)
+        value = static_cast<T>(mantissa) / static_cast<T>(g_exact_powers_of_ten[-exponent]);
+    else
+        value = static_cast<T>(mantissa) * static_cast<T>(g_exact_powers_of_ten[exponent]);
+
+    result = is_negative ? -value : value;
+    return true;
+#else
+    return false;
+#endif
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-float string_to_float(const std::string& source, bool* ok)
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+using c_locale_t = _locale_t;
+#else
+using c_locale_t = locale_t;
+#endif
+
+/*!
+ * Owns the "C" locale, which is passed to the `strto*_l` functions,
+ * so numbers are parsed independent of the global locale of the application.
+ */
+class c_numeric_locale
 {
-    try
-    {
-        std::size_t pos = 0;
-        const float value = std::stof(source, &pos);
-        if (pos == source.length())
+    public:
+        static c_locale_t get()
         {
-            if (ok)
-                *ok = true;
-            return value;
+            static const c_numeric_locale instance;
+            return instance.m_locale;
         }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    private:
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+        c_numeric_locale() : m_locale(_create_locale(LC_NUMERIC, "C")) {}
+        ~c_numeric_locale() { if (m_locale) _free_locale(m_locale); }
+#else
+        c_numeric_locale() : m_locale(newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0))) {}
+        ~c_numeric_locale() { if (m_locale) freelocale(m_locale); }
+#endif
+
+    private:
+        c_locale_t m_locale;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE float str_to_floating_point(const char* text, char** end_ptr, c_locale_t locale, float)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    return _strtof_l(text, end_ptr, locale);
+#else
+    return strtof_l(text, end_ptr, locale);
+#endif
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-double string_to_double(const std::string& source, bool* ok)
+static RTTR_INLINE double str_to_floating_point(const char* text, char** end_ptr, c_locale_t locale, double)
 {
-    try
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    return _strtod_l(text, end_ptr, locale);
+#else
+    return strtod_l(text, end_ptr, locale);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The slow path for all numbers, which cannot be handled by \ref parse_floating_point_fast().
+ * `strtod` is called with the "C" locale, so the decimal point is always '.', whatever the global locale is.
+ */
+template<typename T>
+static bool parse_floating_point_slow(const std::string& source, T& result)
+{
+    const c_locale_t locale = c_numeric_locale::get();
+    if (source.empty() || !locale)
+        return false;
+
+    const char* text = source.c_str();
+    const int old_errno = errno;
+    errno = 0;
+    char* end_ptr = nullptr;
+    const T value = str_to_floating_point(text, &end_ptr, locale, T());
+    // ERANGE is also reported for subnormal numbers, only overflows and underflows to zero are errors
+    const bool out_of_range = (errno == ERANGE && (value == T(0) || value == std::numeric_limits<T>::infinity() ||
+                                                   value == -std::numeric_limits<T>::infinity()));
+    errno = old_errno;
+
+    if (end_ptr != text + source.size() || out_of_range)
+        return false;
+
+    result = value;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T string_to_floating_point(const std::string& source, bool* ok)
+{
+    T value = T(0);
+    const bool success = parse_floating_point_fast(source, value) || parse_floating_point_slow(source, value);
+    return set_result(value, success, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(int value, bool* ok)
+{
+    return signed_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(long value, bool* ok)
+{
+    return signed_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(long long value, bool* ok)
+{
+    return signed_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned value, bool* ok)
+{
+    return unsigned_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned long value, bool* ok)
+{
+    return unsigned_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned long long value, bool* ok)
+{
+    return unsigned_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(float value, bool* ok)
+{
+    return floating_point_to_string<float, uint32_t>(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(double value, bool* ok)
+{
+    return floating_point_to_string<double, uint64_t>(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool string_to_bool(const std::string& text, bool* ok)
+{
+    // white-spaces are ignored and the comparison is case insensitive;
+    // only "false", "0" and an empty text will be interpreted as 'false'
+    static const char false_text[] = "false";
+    const std::size_t false_text_length = sizeof(false_text) - 1;
+
+    char buffer[false_text_length];
+    std::size_t length = 0;
+    for (const char c : text)
     {
-        std::size_t pos = 0;
-        const double value = std::stod(source, &pos);
-        if (pos == source.length())
+        if (is_space(c))
+            continue;
+
+        if (length == false_text_length)
         {
-            if (ok)
-                *ok = true;
-            return value;
+            length = false_text_length + 1;
+            break;
         }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
+
+        buffer[length++] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
     }
 
     if (ok)
-        *ok = false;
+        *ok = true;
+
+    if (length == 0 || (length == 1 && buffer[0] == '0'))
+        return false;
+
+    return !(length == false_text_length && std::memcmp(buffer, false_text, false_text_length) == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int string_to_int(const std::string& source, bool* ok)
+{
+    int value = 0;
+    const bool success = parse_signed(source, value);
+    return set_result(value, success, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long string_to_ulong(const std::string& source, bool* ok)
+{
+    long long value = 0;
+    unsigned long result = 0;
+    const bool success = parse_signed(source, value) && convert_to(value, result);
+    return set_result(result, success, ok);
+}
 
-    return 0;
+/////////////////////////////////////////////////////////////////////////////////////////
+
+long long string_to_long_long(const std::string& source, bool* ok)
+{
+    long long value = 0;
+    const bool success = parse_signed(source, value);
+    return set_result(value, success, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
+{
+    // only digits are allowed, no sign or white-spaces
+    const char* itr = source.data();
+    unsigned long long value = 0;
+    const bool success = parse_digits(itr, itr + source.size(), std::numeric_limits<unsigned long long>::max(), value);
+    return set_result(value, success, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+float string_to_float(const std::string& source, bool* ok)
+{
+    return string_to_floating_point<float>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+double string_to_double(const std::string& source, bool* ok)
+{
+    return string_to_floating_point<double>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -73,7 +73,7 @@ RTTR_API std::string to_string(double value, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-RTTR_API bool string_to_bool(std::string value, bool* ok);
+RTTR_API bool string_to_bool(const std::string& text, bool* ok);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
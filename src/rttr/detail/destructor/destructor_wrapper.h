@@ -31,6 +31,8 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/destructor/destructor_wrapper_base.h"
 #include "rttr/variant.h"
+#include "rttr/detail/type/get_derived_info_func.h"
+#include "rttr/object_pool.h"
 
 namespace rttr
 {
@@ -47,7 +49,22 @@ class destructor_wrapper : public destructor_wrapper_base
         {
             if (obj.is_type<ClassType*>())
             {
-                delete obj.get_value<ClassType*>();
+                ClassType* ptr = obj.get_value<ClassType*>();
+                // the memory was requested by the constructor from the allocator of the most derived type,
+                // the pointer might refer to a base class sub-object, when the object was converted
+                if (ptr)
+                {
+                    const derived_info info = get_most_derived_info_func<ClassType>()(ptr);
+                    if (object_allocator* allocator = info.m_type.get_allocator())
+                    {
+                        ptr->~ClassType();
+                        allocator->deallocate(info.m_ptr, info.m_type.get_sizeof(), info.m_type.get_alignof());
+                    }
+                    else
+                    {
+                        delete ptr;
+                    }
+                }
                 obj = variant();
                 return true;
             }
@@ -56,6 +73,15 @@ class destructor_wrapper : public destructor_wrapper_base
                 return false;
             }
         }
+
+        bool invoke_at(void* storage) const
+        {
+            if (!storage)
+                return false;
+
+            static_cast<ClassType*>(storage)->~ClassType();
+            return true;
+        }
 };
 
 } // end namespace detail
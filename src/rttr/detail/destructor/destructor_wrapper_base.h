@@ -53,6 +53,8 @@ class RTTR_API destructor_wrapper_base
 
         virtual type get_destructed_type() const = 0;
         virtual bool invoke(variant& obj) const = 0;
+        //! Calls the destructor of the object at \p storage, without releasing the memory.
+        virtual bool invoke_at(void* storage) const = 0;
 };
 
 } // end namespace detail
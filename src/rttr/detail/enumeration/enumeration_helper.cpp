@@ -28,6 +28,11 @@
 #include "rttr/detail/enumeration/enumeration_helper.h"
 #include "rttr/enumeration.h"
 #include "rttr/argument.h"
+#include "rttr/detail/enumeration/enumeration_wrapper_base.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+
+#include <cmath>
+#include <cstdint>
 
 namespace rttr
 {
@@ -43,12 +48,19 @@ string_view get_enumeration_name(const argument& arg)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::string get_enumeration_string(const argument& arg)
+{
+    return arg.get_type().get_enumeration().value_to_flag_names(arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool to_enumeration(string_view from, argument& to)
 {
     auto& var_ref = to.get_value<std::reference_wrapper<variant>>();
     variant& var = var_ref.get();
     const type enum_type = var.get_value<type>();
-    if (variant var_tmp = enum_type.get_enumeration().name_to_value(from))
+    if (variant var_tmp = enum_type.get_enumeration().flag_names_to_value(from))
     {
         var = var_tmp;
         return var.is_valid();
@@ -61,25 +73,52 @@ bool to_enumeration(string_view from, argument& to)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+//! Returns the value of the arithmetic variant \p from as integer; false, when it has a fractional part or is out of range.
+static bool to_integral_value(const variant& from, int64_t& value)
+{
+    const type from_type = from.get_type();
+    if (from_type == type::get<float>() || from_type == type::get<double>())
+    {
+        const double number = from.to_double();
+        if (!(number >= -9223372036854775808.0 && number < 9223372036854775808.0) || number != std::trunc(number))
+            return false;
+
+        value = static_cast<int64_t>(number);
+        return true;
+    }
+    else if (from_type == type::get<uint64_t>())
+    {
+        // the values of an enumeration with 64 bit unsigned underlying type are indexed by their bit pattern
+        value = static_cast<int64_t>(from.get_value<uint64_t>());
+        return true;
+    }
+
+    bool ok = false;
+    value = from.to_int64(&ok);
+    return ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool to_enumeration(const variant& from, argument& to)
 {
     auto& var_ref = to.get_value<std::reference_wrapper<variant>>();
     variant& var = var_ref.get();
     const type enum_type = var.get_value<type>();
-    const enumeration e = enum_type.get_enumeration();
-    const type underlying_enum_type = e.get_underlying_type();
-    for (const auto& value : e.get_values())
+    const enumeration_wrapper_base* wrapper = get_wrapper(enum_type.get_enumeration());
+    int64_t value = 0;
+    if (!wrapper || !to_integral_value(from, value))
+        return false;
+
+    if (variant var_tmp = wrapper->underlying_value_to_value(value))
     {
-        variant var_cpy = value;
-        const bool ret = var_cpy.convert(underlying_enum_type);
-        if (ret && var_cpy == from)
-        {
-            var = value;
-            return var.is_valid();
-        }
+        var = var_tmp;
+        return var.is_valid();
+    }
+    else
+    {
+        return false;
     }
-
-    return false;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
 
+#include <string>
+
 
 namespace rttr
 {
@@ -51,7 +53,17 @@ RTTR_API string_view get_enumeration_name(const argument& enum_value);
 /////////////////////////////////////////////////////////////////////////////////////////
 
 /*!
- * \brief Converts the given string \p from to its corresponding enumeration value.
+ * \brief Returns the name of the given enumeration value \p enum_value; the value of a bit-flag enumeration
+ *        is returned as the names of its bits (see \ref enumeration::value_to_flag_names()).
+ *        Otherwise an empty string is returned.
+ */
+RTTR_API std::string get_enumeration_string(const argument& enum_value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Converts the given string \p from to its corresponding enumeration value;
+ *        for a bit-flag enumeration, \p from can contain several names separated by `|`.
  *        The result is stored inside \p to.
  *
  * \remark The parameter \p to should contain a variant with \ref type object of the enumeration.
@@ -0,0 +1,371 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/enumeration/enumeration_index.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! The values are looked up in a table, when they cover at least this part of their range.
+static const uint64_t g_dense_table_factor = 4;
+
+//! After how many failed seeds the slot table of the perfect hash is enlarged.
+static const uint64_t g_seeds_per_slot_count = 8;
+
+static const uint64_t g_max_seed_count = 64;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE uint64_t mix_hash(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! FNV-1a with 64 bit, which is seeded and mixed afterwards, so all bits of the result can be used.
+static RTTR_INLINE uint64_t hash_name(string_view name, uint64_t seed)
+{
+    uint64_t hash = 14695981039346656037ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+    for (const char c : name)
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+
+    return mix_hash(hash);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE std::size_t get_bucket(uint64_t hash, std::size_t bucket_mask)
+{
+    return static_cast<std::size_t>(mix_hash(hash + 0x9e3779b97f4a7c15ULL)) & bucket_mask;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! The step width is odd, so every slot is reached by some displacement.
+static RTTR_INLINE std::size_t get_slot(uint64_t hash, uint32_t displacement, std::size_t slot_mask)
+{
+    const uint32_t first = static_cast<uint32_t>(hash);
+    const uint32_t step  = static_cast<uint32_t>(hash >> 32) | 1;
+    return static_cast<std::size_t>(first + displacement * step) & slot_mask;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t get_power_of_two(std::size_t value)
+{
+    std::size_t result = 1;
+    while (result < value)
+        result <<= 1;
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum_value_index::enum_value_index()
+:   m_is_dense(true),
+    m_min_value(0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void enum_value_index::build(const int64_t* values, std::size_t count)
+{
+    m_dense_list.clear();
+    m_sparse_list.clear();
+    m_is_dense = true;
+    if (count == 0)
+        return;
+
+    const auto min_max = std::minmax_element(values, values + count);
+    m_min_value = *min_max.first;
+    const uint64_t range = static_cast<uint64_t>(*min_max.second) - static_cast<uint64_t>(m_min_value);
+    m_is_dense = (range < static_cast<uint64_t>(count) * g_dense_table_factor);
+    if (m_is_dense)
+    {
+        m_dense_list.assign(static_cast<std::size_t>(range) + 1, -1);
+        for (std::size_t i = count; i > 0; --i)
+            m_dense_list[static_cast<std::size_t>(static_cast<uint64_t>(values[i - 1]) - static_cast<uint64_t>(m_min_value))] = static_cast<int>(i - 1);
+    }
+    else
+    {
+        m_sparse_list.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            m_sparse_list.emplace(values[i], static_cast<int>(i));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum_name_index::enum_name_index()
+:   m_count(0),
+    m_seed(0),
+    m_bucket_mask(0),
+    m_slot_mask(0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void enum_name_index::build(const string_view* names, std::size_t count)
+{
+    m_count = count;
+    m_displacement_list.clear();
+    m_slot_list.clear();
+    if (count == 0)
+        return;
+
+    // a load factor of at most 0.8 keeps the search for displacements short
+    const std::size_t slot_count = get_power_of_two(count + count / 4 + 1);
+    for (uint64_t seed = 0; seed < g_max_seed_count; ++seed)
+    {
+        if (try_build(names, count, seed, slot_count << (seed / g_seeds_per_slot_count)))
+            return;
+    }
+
+    m_displacement_list.clear();
+    m_slot_list.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool enum_name_index::try_build(const string_view* names, std::size_t count, uint64_t seed, std::size_t slot_count)
+{
+    using entry = std::pair<uint64_t, int>;
+    const std::size_t bucket_count = get_power_of_two(std::max<std::size_t>(1, count / 2));
+    m_seed = seed;
+    m_bucket_mask = bucket_count - 1;
+    m_slot_mask = slot_count - 1;
+
+    std::vector<std::vector<entry>> bucket_list(bucket_count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const uint64_t hash = hash_name(names[i], seed);
+        auto& bucket = bucket_list[get_bucket(hash, m_bucket_mask)];
+        const bool is_duplicate = std::any_of(bucket.begin(), bucket.end(),
+                                              [&](const entry& item) { return (names[item.second] == names[i]); });
+        if (!is_duplicate)
+            bucket.emplace_back(hash, static_cast<int>(i));
+    }
+
+    // the large buckets are placed first, while there are still many free slots
+    std::vector<std::size_t> order(bucket_count);
+    for (std::size_t i = 0; i < bucket_count; ++i)
+        order[i] = i;
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t lhs, std::size_t rhs) { return (bucket_list[lhs].size() > bucket_list[rhs].size()); });
+
+    m_displacement_list.assign(bucket_count, 0);
+    m_slot_list.assign(slot_count, -1);
+    std::vector<std::size_t> slots;
+    for (const std::size_t bucket_index : order)
+    {
+        const auto& bucket = bucket_list[bucket_index];
+        if (bucket.empty())
+            break;
+
+        bool is_placed = false;
+        for (std::size_t displacement = 0; displacement < slot_count && !is_placed; ++displacement)
+        {
+            slots.clear();
+            is_placed = true;
+            for (const auto& item : bucket)
+            {
+                const std::size_t slot = get_slot(item.first, static_cast<uint32_t>(displacement), m_slot_mask);
+                if (m_slot_list[slot] != -1 || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                {
+                    is_placed = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+
+            if (is_placed)
+            {
+                m_displacement_list[bucket_index] = static_cast<uint32_t>(displacement);
+                for (std::size_t i = 0; i < bucket.size(); ++i)
+                    m_slot_list[slots[i]] = bucket[i].second;
+            }
+        }
+
+        if (!is_placed)
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int enum_name_index::find(string_view name, const string_view* names) const
+{
+    if (m_slot_list.empty())
+    {
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            if (names[i] == name)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    const uint64_t hash = hash_name(name, m_seed);
+    const std::size_t slot = get_slot(hash, m_displacement_list[get_bucket(hash, m_bucket_mask)], m_slot_mask);
+    const int index = m_slot_list[slot];
+    return ((index >= 0 && names[index] == name) ? index : -1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the position of the single set bit in \p bit, via a de Bruijn sequence.
+static RTTR_INLINE int get_bit_position(uint64_t bit)
+{
+    static const int position_list[64] =
+    {
+         0,  1,  2, 53,  3,  7, 54, 27,  4, 38, 41,  8, 34, 55, 48, 28,
+        62,  5, 39, 46, 44, 42, 22,  9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52,  6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+    };
+    return position_list[(bit * 0x022fdd63cc95386dULL) >> 58];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_space(char c)
+{
+    return (c == ' ' || c == '\t');
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum_flag_index::enum_flag_index()
+:   m_bit_mask(0)
+{
+    m_bit_list.fill(-1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void enum_flag_index::build(const int64_t* values, std::size_t count)
+{
+    m_bit_mask = 0;
+    m_bit_list.fill(-1);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const uint64_t value = static_cast<uint64_t>(values[i]);
+        // only enumerators with exactly one bit name a bit; the first one wins
+        if (value == 0 || (value & (value - 1)) != 0 || (m_bit_mask & value) != 0)
+            continue;
+
+        m_bit_mask |= value;
+        m_bit_list[get_bit_position(value)] = static_cast<int>(i);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool enum_flag_index::to_string(int64_t value, const string_view* names, std::string& result) const
+{
+    uint64_t mask = static_cast<uint64_t>(value);
+    if (mask == 0 || !contains(value))
+        return false;
+
+    bool is_first = true;
+    while (mask != 0)
+    {
+        const uint64_t bit = mask & (~mask + 1);
+        const string_view name = names[m_bit_list[get_bit_position(bit)]];
+        if (!is_first)
+            result += '|';
+
+        result.append(name.data(), name.size());
+        is_first = false;
+        mask ^= bit;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool enum_flag_index::from_string(string_view text, const enum_name_index& name_index,
+                                  const string_view* names, const int64_t* values, int64_t& value) const
+{
+    uint64_t mask = 0;
+    const char* itr = text.data();
+    const char* const end = itr + text.size();
+    do
+    {
+        const char* name_begin = itr;
+        while (itr != end && *itr != '|')
+            ++itr;
+
+        const char* name_end = itr;
+        while (name_begin != name_end && is_space(*name_begin))
+            ++name_begin;
+        while (name_end != name_begin && is_space(*(name_end - 1)))
+            --name_end;
+
+        const int index = name_index.find(string_view(name_begin, static_cast<std::size_t>(name_end - name_begin)), names);
+        if (index < 0)
+            return false;
+
+        mask |= static_cast<uint64_t>(values[index]);
+    } while (itr++ != end);
+
+    value = static_cast<int64_t>(mask);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
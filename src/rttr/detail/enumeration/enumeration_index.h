@@ -0,0 +1,159 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_ENUMERATION_INDEX_H_
+#define RTTR_ENUMERATION_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Maps the underlying values of the enumerators to their index in the registration.
+ *
+ * When the values are compact, i.e. they cover at least a quarter of the range between the smallest and
+ * the largest value, the index is looked up directly in a table; otherwise in a hash map.
+ * When a value is registered more than once, the first enumerator is found.
+ */
+class RTTR_API enum_value_index
+{
+    public:
+        enum_value_index();
+
+        void build(const int64_t* values, std::size_t count);
+
+        //! Returns the index of the enumerator with the underlying value \p value; or -1, when there is none.
+        RTTR_INLINE int find(int64_t value) const
+        {
+            if (m_is_dense)
+            {
+                const uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(m_min_value);
+                return (offset < m_dense_list.size() ? m_dense_list[static_cast<std::size_t>(offset)] : -1);
+            }
+
+            const auto itr = m_sparse_list.find(value);
+            return (itr != m_sparse_list.end() ? itr->second : -1);
+        }
+
+    private:
+        bool                            m_is_dense;
+        int64_t                         m_min_value;
+        std::vector<int>                m_dense_list;
+        std::unordered_map<int64_t, int> m_sparse_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A perfect hash over the names of the enumerators, which maps a name to its index in the registration.
+ *
+ * The names are distributed into buckets by their hash; for every bucket a displacement is searched,
+ * which places all of its names into free slots. A lookup hashes the name once and compares it
+ * with exactly one registered name. When a name is registered more than once, the first enumerator is found.
+ * In the unlikely case, that no perfect hash is found, the names are searched linearly.
+ */
+class RTTR_API enum_name_index
+{
+    public:
+        enum_name_index();
+
+        void build(const string_view* names, std::size_t count);
+
+        //! Returns the index of the enumerator \p name in \p names; or -1, when there is none.
+        //! \p names have to be the same as given to \ref build().
+        int find(string_view name, const string_view* names) const;
+
+    private:
+        bool try_build(const string_view* names, std::size_t count, uint64_t seed, std::size_t slot_count);
+
+    private:
+        std::size_t             m_count;
+        uint64_t                m_seed;
+        std::size_t             m_bucket_mask;
+        std::size_t             m_slot_mask;
+        std::vector<uint32_t>   m_displacement_list;
+        std::vector<int>        m_slot_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Maps every bit of a bit-flag enumeration to the enumerator, which has exactly this bit as value.
+ *
+ * A mask is composed from, and decomposed into, the names of its bits with one lookup per set bit.
+ */
+class RTTR_API enum_flag_index
+{
+    public:
+        enum_flag_index();
+
+        void build(const int64_t* values, std::size_t count);
+
+        //! Returns true, when every set bit of \p value is registered as an enumerator of its own.
+        RTTR_INLINE bool contains(int64_t value) const
+        {
+            return ((static_cast<uint64_t>(value) & ~m_bit_mask) == 0);
+        }
+
+        /*!
+         * Appends the names of the set bits of \p value, separated by `|`, to \p result.
+         * Returns false, when \p value is zero or contains a bit without a name.
+         */
+        bool to_string(int64_t value, const string_view* names, std::string& result) const;
+
+        /*!
+         * Parses the names in \p text, which are separated by `|`, and combines their \p values into \p value.
+         * Returns false, when a name is not registered.
+         */
+        bool from_string(string_view text, const enum_name_index& name_index,
+                         const string_view* names, const int64_t* values, int64_t& value) const;
+
+    private:
+        uint64_t            m_bit_mask;
+        std::array<int, 64> m_bit_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ENUMERATION_INDEX_H_
@@ -31,10 +31,15 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/enumeration/enumeration_wrapper_base.h"
 #include "rttr/detail/enumeration/enum_data.h"
+#include "rttr/detail/enumeration/enumeration_index.h"
 #include "rttr/argument.h"
 #include "rttr/variant.h"
 #include "rttr/string_view.h"
+#include "rttr/enumeration.h"
 
+#include <array>
+#include <cstdint>
+#include <string>
 #include <utility>
 #include <type_traits>
 
@@ -49,16 +54,21 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
     public:
         enumeration_wrapper(std::array< enum_data<Enum_Type>, N > data,
                             std::array<metadata, Metadata_Count> metadata_list)
-        :   metadata_handler<Metadata_Count>(std::move(metadata_list))
+        :   metadata_handler<Metadata_Count>(std::move(metadata_list)),
+            m_is_flags(metadata_handler<Metadata_Count>::get_metadata(enumeration_metadata::flags).to_bool())
         {
             int index = 0;
             for (const auto& item : data)
             {
                  m_enum_names[index]    = item.get_name();
-                 m_enum_values[index]   = item.get_value();
                  m_enum_variant_values[index] = item.get_value();
+                 m_underlying_values[index] = to_underlying_value(item.get_value());
                  ++index;
             }
+            m_value_index.build(m_underlying_values.data(), N);
+            m_name_index.build(m_enum_names.data(), N);
+            if (m_is_flags)
+                m_flag_index.build(m_underlying_values.data(), N);
             static_assert(std::is_enum<Enum_Type>::value, "No enum type provided, please create an instance of this class only for enum types!");
         }
 
@@ -83,38 +93,83 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
                 return string_view();
             }
 
-            const Enum_Type enum_value = value.get_value<Enum_Type>();
-            int index = 0;
-            for (const auto& item : m_enum_values)
-            {
-                if (item == enum_value)
-                    return m_enum_names[index];
+            const int index = m_value_index.find(to_underlying_value(value.get_value<Enum_Type>()));
+            return (index >= 0 ? m_enum_names[index] : string_view());
+        }
 
-                ++index;
-            }
+        variant name_to_value(string_view name) const
+        {
+            const int index = m_name_index.find(name, m_enum_names.data());
+            return (index >= 0 ? m_enum_variant_values[index] : variant());
+        }
 
-            return string_view();
+        variant underlying_value_to_value(int64_t value) const
+        {
+            const int index = m_value_index.find(value);
+            if (index >= 0)
+                return m_enum_variant_values[index];
+            else if (m_is_flags && m_flag_index.contains(value))
+                return from_underlying_value(value);
+            else
+                return variant();
         }
 
-        variant name_to_value(string_view name) const
+        bool is_flags() const { return m_is_flags; }
+
+        std::string value_to_flag_names(argument& value) const
         {
-            int index = 0;
-            for (const auto& item : m_enum_names)
+            if (!value.is_type<Enum_Type>() &&
+                !value.is_type<typename std::underlying_type<Enum_Type>::type>())
             {
-                if (item == name)
-                    return m_enum_values[index];
-
-                ++index;
+                return std::string();
             }
-            return variant();
+
+            // a value, which has a name of its own (e.g. zero or a combination of bits), is not decomposed
+            const int64_t underlying_value = to_underlying_value(value.get_value<Enum_Type>());
+            const int index = m_value_index.find(underlying_value);
+            if (index >= 0)
+                return m_enum_names[index].to_string();
+
+            std::string result;
+            if (!m_is_flags || !m_flag_index.to_string(underlying_value, m_enum_names.data(), result))
+                return std::string();
+
+            return result;
+        }
+
+        variant flag_names_to_value(string_view names) const
+        {
+            int64_t value = 0;
+            if (!m_is_flags)
+                return name_to_value(names);
+            else if (m_flag_index.from_string(names, m_name_index, m_enum_names.data(), m_underlying_values.data(), value))
+                return from_underlying_value(value);
+            else
+                return variant();
         }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+
+    private:
+        static RTTR_INLINE int64_t to_underlying_value(Enum_Type value)
+        {
+            return static_cast<int64_t>(static_cast<typename std::underlying_type<Enum_Type>::type>(value));
+        }
+
+        static RTTR_INLINE Enum_Type from_underlying_value(int64_t value)
+        {
+            return static_cast<Enum_Type>(static_cast<typename std::underlying_type<Enum_Type>::type>(value));
+        }
 
     private:
         std::array< string_view, N >    m_enum_names;
-        std::array< Enum_Type, N >      m_enum_values;
         std::array< variant, N >        m_enum_variant_values;
+        std::array< int64_t, N >        m_underlying_values;
+        enum_value_index                m_value_index;
+        enum_name_index                 m_name_index;
+        enum_flag_index                 m_flag_index;
+        bool                            m_is_flags;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
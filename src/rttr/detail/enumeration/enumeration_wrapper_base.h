@@ -33,6 +33,7 @@
 #include "rttr/variant.h"
 #include "rttr/type.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <initializer_list>
@@ -68,11 +69,22 @@ class RTTR_API enumeration_wrapper_base
 
         virtual variant name_to_value(string_view name) const = 0;
 
+        //! Returns the enumerator, whose underlying value is \p value; or an invalid variant, when there is none.
+        //! For a bit-flag enumeration, also every combination of its registered bits is returned.
+        virtual variant underlying_value_to_value(int64_t value) const = 0;
+
+        virtual bool is_flags() const = 0;
+
+        virtual std::string value_to_flag_names(argument& value) const = 0;
+
+        virtual variant flag_names_to_value(string_view names) const = 0;
+
         void set_declaring_type(type declaring_type);
 
         type get_declaring_type() const;
 
         virtual variant get_metadata(const variant& key) const = 0;
+        virtual variant get_metadata(const metadata_key& key) const = 0;
     private:
         type m_declaring_type;
 };
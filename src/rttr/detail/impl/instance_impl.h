@@ -116,6 +116,31 @@ RTTR_INLINE type instance::get_derived_type() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail
+{
+
+/*!
+ * Returns the address of the object, which is referenced by \p object; it is an object of type \ref instance::get_type().
+ */
+RTTR_INLINE void* get_object_address(const instance& object)
+{
+    return object.m_data_container.m_data_address;
+}
+
+/*!
+ * Returns an instance, which refers to the object of type \p t at \p address; \p t must not be a wrapper type.
+ */
+RTTR_INLINE instance create_instance(void* address, const type& t)
+{
+    instance object;
+    object.m_data_container = data_address_container{t, type::get<invalid_wrapper_type>(), address, address};
+    return object;
+}
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 #endif // RTTR_INSTANCE_IMPL_H_
@@ -0,0 +1,180 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/io/binary_plan.h"
+
+#include "rttr/property.h"
+#include "rttr/enumeration.h"
+#include "rttr/detail/enumeration/enumeration_wrapper_base.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+
+#include <cstring>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_plan::binary_plan(const type& t)
+:   m_type(t)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void binary_plan::compile()
+{
+    for (const auto& prop : m_type.get_properties())
+    {
+        if (prop.is_static())
+            continue;
+
+        const type value_type = prop.get_type();
+        const binary_value_kind kind = get_kind(value_type);
+        if (kind == binary_value_kind::UNSUPPORTED)
+            continue;
+
+        const binary_plan* plan = (kind == binary_value_kind::OBJECT) ? &get(value_type) : nullptr;
+        const std::size_t size  = (kind == binary_value_kind::TRIVIAL) ? value_type.get_sizeof() : 0;
+        const bool is_checked = (kind == binary_value_kind::TRIVIAL && has_invalid_values(value_type));
+        m_fields.push_back({get_wrapper(prop), value_type, kind, size, plan, prop.is_readonly(), is_checked});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const binary_plan& binary_plan::get(const type& t)
+{
+    return plan_cache<binary_plan>::get(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value_kind binary_plan::get_kind(const type& t)
+{
+    if (t.is_arithmetic() || t.is_enumeration())
+        return binary_value_kind::TRIVIAL;
+    else if (t == type::get<std::string>())
+        return binary_value_kind::STRING;
+    else if (t.is_array())
+        return binary_value_kind::ARRAY;
+    else if (t.is_class() && !t.is_wrapper())
+        return binary_value_kind::OBJECT;
+    else
+        return binary_value_kind::UNSUPPORTED;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_plan::has_invalid_values(const type& t)
+{
+    return (t == type::get<bool>() || t.is_enumeration());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Signed_Type, typename Unsigned_Type>
+static bool is_enumeration_value(const enumeration_wrapper_base& wrapper, const char* data)
+{
+    Signed_Type value;
+    std::memcpy(&value, data, sizeof(value));
+    // the signedness of the underlying type is not known here; a registered value can match only one of both
+    // interpretations of the bit pattern, because the other one is outside of the range of the underlying type
+    return (wrapper.underlying_value_to_value(static_cast<int64_t>(value)).is_valid() ||
+            wrapper.underlying_value_to_value(static_cast<int64_t>(static_cast<Unsigned_Type>(value))).is_valid());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_plan::are_valid_values(const type& t, const void* data, std::size_t count)
+{
+    const char* bytes = static_cast<const char*>(data);
+    if (t == type::get<bool>())
+    {
+        const bool false_value = false;
+        const bool true_value = true;
+        for (std::size_t i = 0; i < count; ++i, bytes += sizeof(bool))
+        {
+            if (std::memcmp(bytes, &false_value, sizeof(bool)) != 0 && std::memcmp(bytes, &true_value, sizeof(bool)) != 0)
+                return false;
+        }
+
+        return true;
+    }
+    else if (t.is_enumeration())
+    {
+        const enumeration_wrapper_base* wrapper = get_wrapper(t.get_enumeration());
+        if (!wrapper)
+            return false;
+
+        const std::size_t size = t.get_sizeof();
+        using check_func = bool(*)(const enumeration_wrapper_base&, const char*);
+        check_func check = nullptr;
+        switch (size)
+        {
+            case 1: check = &is_enumeration_value<int8_t, uint8_t>; break;
+            case 2: check = &is_enumeration_value<int16_t, uint16_t>; break;
+            case 4: check = &is_enumeration_value<int32_t, uint32_t>; break;
+            case 8: check = &is_enumeration_value<int64_t, uint64_t>; break;
+            default: return false;
+        }
+
+        for (std::size_t i = 0; i < count; ++i, bytes += size)
+        {
+            if (!check(*wrapper, bytes))
+                return false;
+        }
+
+        return true;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type binary_plan::get_type() const
+{
+    return m_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<binary_field>& binary_plan::get_fields() const
+{
+    return m_fields;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
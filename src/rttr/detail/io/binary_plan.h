@@ -0,0 +1,139 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_PLAN_H_
+#define RTTR_BINARY_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/detail/misc/plan_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+class property_wrapper_base;
+class binary_plan;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Describes how a value is stored in the binary format.
+ */
+enum class binary_value_kind : uint8_t
+{
+    TRIVIAL,    //!< arithmetic types and enumerations; the bytes of the value are copied
+    STRING,     //!< std::string; the length followed by the characters
+    ARRAY,      //!< the size of the first dimension followed by the elements
+    OBJECT,     //!< a class; the properties in the order of its \ref binary_plan
+    UNSUPPORTED //!< pointers, wrappers and all other values; these are not serialized
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One serialized property of a \ref binary_plan.
+ */
+struct binary_field
+{
+    const property_wrapper_base*    m_wrapper;
+    type                            m_type;
+    binary_value_kind               m_kind;
+    std::size_t                     m_size;         //!< the size in bytes of a TRIVIAL value
+    const binary_plan*              m_plan;         //!< the plan of an OBJECT value
+    bool                            m_is_readonly;
+    bool                            m_is_checked;   //!< the bytes of a TRIVIAL value are validated, before they are stored
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The precompiled description of how the objects of one class are written to and read from the binary format.
+ *
+ * The plan contains the serializable, non-static properties of the class in the order of \ref type::get_properties(),
+ * together with the way, how every value is stored. The plans of nested class members are resolved in advance,
+ * so writing an object requires no lookup by type for its members.
+ *
+ * A plan is compiled once per type, on first use; it is never invalidated.
+ */
+class binary_plan
+{
+    public:
+        /*!
+         * Returns the plan for the class \p t. This function is thread safe.
+         */
+        static const binary_plan& get(const type& t);
+
+        /*!
+         * Returns the way, how a value of type \p t will be stored.
+         */
+        static binary_value_kind get_kind(const type& t);
+
+        /*!
+         * Returns true, when not every bit pattern is a valid value of the TRIVIAL type \p t;
+         * i.e. for `bool` and enumerations.
+         */
+        static bool has_invalid_values(const type& t);
+
+        /*!
+         * Returns true, when each of the \p count values of type \p t at \p data is valid:
+         * a `bool` has to be `false` or `true` and an enumeration has to have a registered value
+         * (or, for a bit-flag enumeration, a combination of the registered bits).
+         *
+         * The bytes read from a stream are checked with this function, before they are stored in an object.
+         */
+        static bool are_valid_values(const type& t, const void* data, std::size_t count);
+
+        type get_type() const;
+
+        const std::vector<binary_field>& get_fields() const;
+
+    private:
+        explicit binary_plan(const type& t);
+
+        //! The fields are compiled after the plan is stored in the \ref plan_cache.
+        void compile();
+
+        friend class plan_cache<binary_plan>;
+
+    private:
+        type                        m_type;
+        std::vector<binary_field>   m_fields;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_PLAN_H_
@@ -0,0 +1,326 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_READER_P_H_
+#define RTTR_BINARY_READER_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/argument.h"
+#include "rttr/variant.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/io/binary_plan.h"
+#include "rttr/detail/io/binary_stream.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/misc/utility.h"
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class binary_reader_private
+{
+    public:
+        binary_reader_private(const void* data, std::size_t size)
+        :   m_source(data, size),
+            m_last_plan(nullptr)
+        {
+        }
+
+        binary_reader_private(int file_descriptor, std::size_t buffer_size)
+        :   m_source(file_descriptor, buffer_size),
+            m_last_plan(nullptr)
+        {
+        }
+
+        bool read(const instance& object)
+        {
+            if (!object.is_valid())
+                return false;
+
+            return read_object(object, get_plan(object.get_derived_type()));
+        }
+
+        bool at_end()
+        {
+            return m_source.at_end();
+        }
+
+        //! Reads the value of one property of \p object.
+        bool read_field(instance& object, const binary_field& field)
+        {
+            void* address = field.m_is_readonly ? nullptr : field.m_wrapper->get_value_address(object);
+            if (address)
+            {
+                bool ok = false;
+                switch (field.m_kind)
+                {
+                    case binary_value_kind::TRIVIAL:
+                    {
+                        ok = (field.m_is_checked ? read_checked_value(address, field.m_type, field.m_size)
+                                                 : m_source.read(address, field.m_size));
+                        break;
+                    }
+                    case binary_value_kind::STRING:
+                    {
+                        ok = read_string(*static_cast<std::string*>(address));
+                        break;
+                    }
+                    case binary_value_kind::ARRAY:
+                    {
+                        auto view = field.m_wrapper->get_ref(object).create_array_view();
+                        ok = read_array(view);
+                        break;
+                    }
+                    case binary_value_kind::OBJECT:
+                    {
+                        ok = read_object(instance(field.m_wrapper->get_ref(object)), *field.m_plan);
+                        break;
+                    }
+                    case binary_value_kind::UNSUPPORTED:
+                    {
+                        ok = true;
+                        break;
+                    }
+                }
+
+                return ok;
+            }
+            else
+            {
+                // the value is read into a copy, which is assigned via the setter afterwards;
+                // for a read only property, the copy just consumes the data
+                variant value = field.m_wrapper->get_value(object);
+                if (!value.is_valid() || !read_value(value, field))
+                    return false;
+
+                if (!field.m_is_readonly)
+                {
+                    argument arg(value);
+                    field.m_wrapper->set_value(object, arg);
+                }
+
+                return true;
+            }
+        }
+
+        binary_source& get_source()
+        {
+            return m_source;
+        }
+
+    private:
+        const binary_plan& get_plan(const type& t)
+        {
+            if (!m_last_plan || m_last_plan->get_type() != t)
+                m_last_plan = &binary_plan::get(t);
+
+            return *m_last_plan;
+        }
+
+        bool read_string(std::string& text)
+        {
+            std::size_t size = 0;
+            if (!m_source.read_size(size) || !m_source.can_read(size))
+                return false;
+
+            text.resize(size);
+            return (size == 0 || m_source.read(&text[0], size));
+        }
+
+        //! Resizes \p view to \p size elements; an array with a fixed size must have exactly \p size elements.
+        static bool set_array_size(variant_array_view& view, std::size_t size)
+        {
+            return (view.is_dynamic() ? view.set_size(size) : (view.get_size() == size));
+        }
+
+        bool read_object(instance object, const binary_plan& plan)
+        {
+            for (const auto& field : plan.get_fields())
+            {
+                if (!read_field(object, field))
+                    return false;
+            }
+
+            return true;
+        }
+
+        //! Reads a `bool` or an enumeration via a buffer, so an invalid value is never stored in \p address.
+        bool read_checked_value(void* address, const type& t, std::size_t size)
+        {
+            uint64_t buffer = 0;
+            if (size > sizeof(buffer) || !m_source.read(&buffer, size) || !binary_plan::are_valid_values(t, &buffer, 1))
+                return false;
+
+            std::memcpy(address, &buffer, size);
+            return true;
+        }
+
+        bool read_value(variant& value, const binary_field& field)
+        {
+            switch (field.m_kind)
+            {
+                case binary_value_kind::TRIVIAL:
+                {
+                    void* address = get_object_address(instance(value));
+                    return (field.m_is_checked ? read_checked_value(address, field.m_type, field.m_size)
+                                               : m_source.read(address, field.m_size));
+                }
+                case binary_value_kind::STRING:
+                {
+                    return read_string(*static_cast<std::string*>(get_object_address(instance(value))));
+                }
+                case binary_value_kind::ARRAY:
+                {
+                    auto view = value.create_array_view();
+                    return read_array(view);
+                }
+                case binary_value_kind::OBJECT:
+                {
+                    return read_object(instance(value), *field.m_plan);
+                }
+                case binary_value_kind::UNSUPPORTED:
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool read_array(variant_array_view& view)
+        {
+            std::size_t size = 0;
+            if (!m_source.read_size(size))
+                return false;
+
+            const type element_type = view.get_element_type();
+            const binary_value_kind kind = binary_plan::get_kind(element_type);
+            if (kind == binary_value_kind::UNSUPPORTED)
+                return (size == 0);
+
+            if (kind == binary_value_kind::TRIVIAL)
+                return read_trivial_array(view, element_type, size);
+
+            // every string and every nested array starts with its size
+            if (kind != binary_value_kind::OBJECT && (size > SIZE_MAX / sizeof(uint64_t) || !m_source.can_read(size * sizeof(uint64_t))))
+                return false;
+
+            if (!set_array_size(view, size))
+                return false;
+
+            const binary_plan* plan = (kind == binary_value_kind::OBJECT) ? &binary_plan::get(element_type) : nullptr;
+            const bool is_contiguous = view.is_contiguous();
+            for (auto itr = view.begin(), end = view.end(); itr != end; ++itr)
+            {
+                bool ok = false;
+                if (kind == binary_value_kind::STRING && !is_contiguous)
+                {
+                    // the elements of a node based container are assigned, so also a container, which returns copies, works
+                    std::string text;
+                    ok = (read_string(text) && view.set_value(itr, text));
+                }
+                else
+                {
+                    const variant_ref element = *itr;
+                    if (kind == binary_value_kind::STRING)
+                    {
+                        ok = read_string(*static_cast<std::string*>(get_object_address(instance(element))));
+                    }
+                    else if (kind == binary_value_kind::ARRAY)
+                    {
+                        auto element_view = element.create_array_view();
+                        ok = read_array(element_view);
+                    }
+                    else
+                    {
+                        ok = read_object(instance(element), *plan);
+                    }
+                }
+
+                if (!ok)
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool read_trivial_array(variant_array_view& view, const type& element_type, std::size_t size)
+        {
+            const std::size_t element_size = element_type.get_sizeof();
+            if (element_size == 0 || size > SIZE_MAX / element_size || !m_source.can_read(size * element_size))
+                return false;
+
+            const bool is_contiguous = (view.is_contiguous() && view.get_stride() == element_size);
+            const bool is_checked = binary_plan::has_invalid_values(element_type);
+            if (is_contiguous && !is_checked)
+            {
+                if (!set_array_size(view, size))
+                    return false;
+
+                return (size == 0 || m_source.read(view.get_data(), size * element_size));
+            }
+
+            // containers without contiguous storage (e.g. std::vector<bool> or std::list) are assigned from a buffer;
+            // so are bools and enumerations, which are validated before they are stored
+            std::unique_ptr<char[]> buffer(new char[size * element_size + 1]);
+            if (!m_source.read(buffer.get(), size * element_size) ||
+                (is_checked && !binary_plan::are_valid_values(element_type, buffer.get(), size)))
+            {
+                return false;
+            }
+
+            if (!is_contiguous)
+                return view.assign(element_type, buffer.get(), size);
+
+            if (!set_array_size(view, size))
+                return false;
+
+            if (size > 0)
+                std::memcpy(view.get_data(), buffer.get(), size * element_size);
+
+            return true;
+        }
+
+    private:
+        binary_source       m_source;
+        const binary_plan*  m_last_plan;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_READER_P_H_
@@ -0,0 +1,241 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/io/binary_stream.h"
+
+#include <algorithm>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static long long write_file(int file_descriptor, const char* data, std::size_t size)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    return ::_write(file_descriptor, data, static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30)));
+#else
+    return ::write(file_descriptor, data, size);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static long long read_file(int file_descriptor, char* data, std::size_t size)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    return ::_read(file_descriptor, data, static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30)));
+#else
+    return ::read(file_descriptor, data, size);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool write_all(int file_descriptor, const char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        const long long written = write_file(file_descriptor, data, size);
+        if (written <= 0)
+            return false;
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_sink::binary_sink(std::vector<char>& buffer)
+:   m_buffer(&buffer),
+    m_file_descriptor(-1),
+    m_flush_size(0),
+    m_failed(false)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_sink::binary_sink(int file_descriptor, std::size_t buffer_size)
+:   m_buffer(&m_own_buffer),
+    m_file_descriptor(file_descriptor),
+    m_flush_size(std::max<std::size_t>(buffer_size, 1)),
+    m_failed(file_descriptor < 0)
+{
+    m_own_buffer.reserve(m_flush_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_sink::flush()
+{
+    if (m_file_descriptor >= 0 && !m_buffer->empty())
+    {
+        if (!m_failed)
+            m_failed = !write_all(m_file_descriptor, m_buffer->data(), m_buffer->size());
+
+        m_buffer->clear();
+    }
+
+    return !m_failed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_sink::has_failed() const
+{
+    return m_failed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void binary_sink::write_to_file(const void* data, std::size_t size)
+{
+    flush();
+
+    // big blocks, e.g. the content of an array, are written directly without copying them into the buffer
+    if (size >= m_flush_size)
+    {
+        if (!m_failed)
+            m_failed = !write_all(m_file_descriptor, static_cast<const char*>(data), size);
+    }
+    else
+    {
+        const char* bytes = static_cast<const char*>(data);
+        m_buffer->insert(m_buffer->end(), bytes, bytes + size);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_source::binary_source(const void* data, std::size_t size)
+:   m_pos(static_cast<const char*>(data)),
+    m_end(static_cast<const char*>(data) + size),
+    m_file_descriptor(-1)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_source::binary_source(int file_descriptor, std::size_t buffer_size)
+:   m_buffer(std::max<std::size_t>(buffer_size, 1)),
+    m_pos(m_buffer.data()),
+    m_end(m_buffer.data()),
+    m_file_descriptor(file_descriptor)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_source::can_read(std::size_t size) const
+{
+    return (m_file_descriptor >= 0 || static_cast<std::size_t>(m_end - m_pos) >= size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_source::at_end()
+{
+    return (m_pos == m_end && !fill_buffer());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_source::fill_buffer()
+{
+    if (m_file_descriptor < 0)
+        return false;
+
+    const long long count = read_file(m_file_descriptor, m_buffer.data(), m_buffer.size());
+    if (count <= 0)
+        return false;
+
+    m_pos = m_buffer.data();
+    m_end = m_pos + count;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_source::read_from_file(void* data, std::size_t size)
+{
+    if (m_file_descriptor < 0)
+        return false;
+
+    char* out = static_cast<char*>(data);
+    const std::size_t buffered = static_cast<std::size_t>(m_end - m_pos);
+    std::memcpy(out, m_pos, buffered);
+    out += buffered;
+    size -= buffered;
+    m_pos = m_end;
+
+    // big blocks are read directly into the target
+    while (size >= m_buffer.size())
+    {
+        const long long count = read_file(m_file_descriptor, out, size);
+        if (count <= 0)
+            return false;
+
+        out += count;
+        size -= static_cast<std::size_t>(count);
+    }
+
+    while (size > 0)
+    {
+        if (!fill_buffer())
+            return false;
+
+        const std::size_t count = std::min(size, static_cast<std::size_t>(m_end - m_pos));
+        std::memcpy(out, m_pos, count);
+        out += count;
+        size -= count;
+        m_pos += count;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_STREAM_H_
+#define RTTR_BINARY_STREAM_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The output of a \ref io::binary_writer; either a buffer of the user, or a file descriptor.
+ *
+ * For a file descriptor, the data is collected in an internal buffer and written in big blocks.
+ */
+class binary_sink
+{
+    public:
+        explicit binary_sink(std::vector<char>& buffer);
+        binary_sink(int file_descriptor, std::size_t buffer_size);
+
+        RTTR_INLINE void write(const void* data, std::size_t size)
+        {
+            if (m_file_descriptor >= 0 && m_buffer->size() + size > m_flush_size)
+            {
+                write_to_file(data, size);
+                return;
+            }
+
+            const char* bytes = static_cast<const char*>(data);
+            m_buffer->insert(m_buffer->end(), bytes, bytes + size);
+        }
+
+        RTTR_INLINE void write_size(std::size_t size)
+        {
+            const uint64_t value = static_cast<uint64_t>(size);
+            write(&value, sizeof(value));
+        }
+
+        bool flush();
+
+        bool has_failed() const;
+
+    private:
+        void write_to_file(const void* data, std::size_t size);
+
+    private:
+        std::vector<char>   m_own_buffer;
+        std::vector<char>*  m_buffer;
+        int                 m_file_descriptor;
+        std::size_t         m_flush_size;
+        bool                m_failed;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The input of a \ref io::binary_reader; either a block of memory, or a file descriptor.
+ */
+class binary_source
+{
+    public:
+        binary_source(const void* data, std::size_t size);
+        binary_source(int file_descriptor, std::size_t buffer_size);
+
+        RTTR_INLINE bool read(void* data, std::size_t size)
+        {
+            if (static_cast<std::size_t>(m_end - m_pos) < size)
+                return read_from_file(data, size);
+
+            std::memcpy(data, m_pos, size);
+            m_pos += size;
+            return true;
+        }
+
+        RTTR_INLINE bool read_size(std::size_t& size)
+        {
+            uint64_t value = 0;
+            if (!read(&value, sizeof(value)) || value > static_cast<uint64_t>(SIZE_MAX))
+                return false;
+
+            size = static_cast<std::size_t>(value);
+            return true;
+        }
+
+        /*!
+         * Returns false, when it is known that less than \p size bytes are left;
+         * it is used to reject corrupt sizes, before memory is allocated for them.
+         */
+        bool can_read(std::size_t size) const;
+
+        bool at_end();
+
+    private:
+        bool read_from_file(void* data, std::size_t size);
+        bool fill_buffer();
+
+    private:
+        std::vector<char>   m_buffer;
+        const char*         m_pos;
+        const char*         m_end;
+        int                 m_file_descriptor;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_STREAM_H_
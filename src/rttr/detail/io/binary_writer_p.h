@@ -0,0 +1,195 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_WRITER_P_H_
+#define RTTR_BINARY_WRITER_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/io/binary_plan.h"
+#include "rttr/detail/io/binary_stream.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/misc/utility.h"
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class binary_writer_private
+{
+    public:
+        explicit binary_writer_private(std::vector<char>& buffer)
+        :   m_sink(buffer),
+            m_last_plan(nullptr)
+        {
+        }
+
+        binary_writer_private(int file_descriptor, std::size_t buffer_size)
+        :   m_sink(file_descriptor, buffer_size),
+            m_last_plan(nullptr)
+        {
+        }
+
+        bool write(const instance& object)
+        {
+            if (!object.is_valid() || m_sink.has_failed())
+                return false;
+
+            write_object(object, get_plan(object.get_derived_type()));
+            return !m_sink.has_failed();
+        }
+
+        bool flush()
+        {
+            return m_sink.flush();
+        }
+
+        //! Writes the value of one property of \p object.
+        void write_field(instance& object, const binary_field& field)
+        {
+            if (field.m_kind == binary_value_kind::TRIVIAL || field.m_kind == binary_value_kind::STRING)
+            {
+                if (const void* address = field.m_wrapper->get_value_address(object))
+                {
+                    if (field.m_kind == binary_value_kind::TRIVIAL)
+                        m_sink.write(address, field.m_size);
+                    else
+                        write_string(*static_cast<const std::string*>(address));
+
+                    return;
+                }
+            }
+
+            write_value(field.m_wrapper->get_ref(object), field.m_kind, field.m_size, field.m_plan);
+        }
+
+        binary_sink& get_sink()
+        {
+            return m_sink;
+        }
+
+    private:
+        //! Most streams contain objects of one type, so the last plan is reused without locking the plan cache.
+        const binary_plan& get_plan(const type& t)
+        {
+            if (!m_last_plan || m_last_plan->get_type() != t)
+                m_last_plan = &binary_plan::get(t);
+
+            return *m_last_plan;
+        }
+
+        void write_string(const std::string& text)
+        {
+            m_sink.write_size(text.size());
+            m_sink.write(text.data(), text.size());
+        }
+
+        void write_object(instance object, const binary_plan& plan)
+        {
+            for (const auto& field : plan.get_fields())
+                write_field(object, field);
+        }
+
+        void write_value(const variant_ref& value, binary_value_kind kind, std::size_t size, const binary_plan* plan)
+        {
+            switch (kind)
+            {
+                case binary_value_kind::TRIVIAL:
+                {
+                    m_sink.write(get_object_address(instance(value)), size);
+                    break;
+                }
+                case binary_value_kind::STRING:
+                {
+                    write_string(value.get_value<std::string>());
+                    break;
+                }
+                case binary_value_kind::ARRAY:
+                {
+                    write_array(value.create_array_view());
+                    break;
+                }
+                case binary_value_kind::OBJECT:
+                {
+                    write_object(instance(value), *plan);
+                    break;
+                }
+                case binary_value_kind::UNSUPPORTED:
+                {
+                    break;
+                }
+            }
+        }
+
+        void write_array(const variant_array_view& view)
+        {
+            const type element_type = view.get_element_type();
+            const binary_value_kind kind = binary_plan::get_kind(element_type);
+            const std::size_t size = (kind != binary_value_kind::UNSUPPORTED) ? view.get_size() : 0;
+            m_sink.write_size(size);
+            if (size == 0)
+                return;
+
+            const std::size_t element_size = (kind == binary_value_kind::TRIVIAL) ? element_type.get_sizeof() : 0;
+            if (kind == binary_value_kind::TRIVIAL && view.is_contiguous())
+            {
+                const char* data = static_cast<const char*>(view.get_data());
+                const std::size_t stride = view.get_stride();
+                if (stride == element_size)
+                {
+                    m_sink.write(data, size * element_size);
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < size; ++i)
+                        m_sink.write(data + i * stride, element_size);
+                }
+                return;
+            }
+
+            const binary_plan* plan = (kind == binary_value_kind::OBJECT) ? &binary_plan::get(element_type) : nullptr;
+            for (auto itr = view.begin(), end = view.end(); itr != end; ++itr)
+                write_value(*itr, kind, element_size, plan);
+        }
+
+    private:
+        binary_sink         m_sink;
+        const binary_plan*  m_last_plan;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_WRITER_P_H_
@@ -0,0 +1,394 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/io/json_plan.h"
+
+#include "rttr/enumeration.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static json_number_kind get_number_kind()
+{
+    if (std::is_floating_point<T>::value)
+        return (sizeof(T) == sizeof(float) ? json_number_kind::FLOAT :
+                sizeof(T) == sizeof(double) ? json_number_kind::DOUBLE : json_number_kind::LONG_DOUBLE);
+    else if (std::is_signed<T>::value)
+        return (sizeof(T) == 1 ? json_number_kind::INT8 : sizeof(T) == 2 ? json_number_kind::INT16 :
+                sizeof(T) == 4 ? json_number_kind::INT32 : json_number_kind::INT64);
+    else
+        return (sizeof(T) == 1 ? json_number_kind::UINT8 : sizeof(T) == 2 ? json_number_kind::UINT16 :
+                sizeof(T) == 4 ? json_number_kind::UINT32 : json_number_kind::UINT64);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::pair<type, json_number_kind> make_number_item()
+{
+    return {type::get<T>(), get_number_kind<T>()};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool find_number_kind(const type& t, json_number_kind& kind)
+{
+    static const std::pair<type, json_number_kind> number_list[] =
+    {
+        make_number_item<char>(), make_number_item<signed char>(), make_number_item<unsigned char>(),
+        make_number_item<wchar_t>(), make_number_item<char16_t>(), make_number_item<char32_t>(),
+        make_number_item<short>(), make_number_item<unsigned short>(),
+        make_number_item<int>(), make_number_item<unsigned int>(),
+        make_number_item<long>(), make_number_item<unsigned long>(),
+        make_number_item<long long>(), make_number_item<unsigned long long>(),
+        make_number_item<float>(), make_number_item<double>(), make_number_item<long double>()
+    };
+
+    for (const auto& item : number_list)
+    {
+        if (item.first == t)
+        {
+            kind = item.second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_value_info json_value_info::get(const type& t)
+{
+    json_value_info info = {t, json_value_kind::UNSUPPORTED, json_number_kind::INT32, nullptr, nullptr};
+
+    if (t == type::get<bool>())
+    {
+        info.m_kind = json_value_kind::BOOLEAN;
+    }
+    else if (t.is_arithmetic())
+    {
+        if (find_number_kind(t, info.m_number_kind))
+            info.m_kind = json_value_kind::NUMBER;
+    }
+    else if (t.is_enumeration())
+    {
+        if (find_number_kind(t.get_enumeration().get_underlying_type(), info.m_number_kind))
+        {
+            info.m_kind = json_value_kind::ENUMERATION;
+            info.m_enum_table = &json_enum_table::get(t);
+        }
+    }
+    else if (t == type::get<std::string>())
+    {
+        info.m_kind = json_value_kind::STRING;
+    }
+    else if (t.is_array())
+    {
+        info.m_kind = json_value_kind::ARRAY;
+    }
+    else if (t.is_class() && !t.is_wrapper())
+    {
+        info.m_kind = json_value_kind::OBJECT;
+        info.m_plan = &json_plan::get(t);
+    }
+
+    return info;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_enum_table::json_enum_table(const type& t)
+{
+    const enumeration enum_type = t.get_enumeration();
+    json_number_kind kind = json_number_kind::INT32;
+    find_number_kind(enum_type.get_underlying_type(), kind);
+
+    for (const auto& name : enum_type.get_names())
+    {
+        variant value = enum_type.name_to_value(name);
+        if (!value.is_valid())
+            continue;
+
+        const uint64_t raw_value = json_load_integer(get_object_address(instance(value)), kind);
+        m_name_list.emplace_back(raw_value, name);
+        m_value_list.emplace(name, raw_value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const json_enum_table& json_enum_table::get(const type& t)
+{
+    static std::mutex mutex;
+    static std::unordered_map<type::type_id, std::unique_ptr<json_enum_table>> table_list;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& table = table_list[t.get_id()];
+    if (!table)
+        table.reset(new json_enum_table(t));
+
+    return *table;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view json_enum_table::get_name(uint64_t value) const
+{
+    for (const auto& item : m_name_list)
+    {
+        if (item.first == value)
+            return item.second;
+    }
+
+    return string_view();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool json_enum_table::get_value(string_view name, uint64_t& value) const
+{
+    auto found = m_value_list.find(name);
+    if (found == m_value_list.end())
+        return false;
+
+    value = found->second;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_plan::json_plan(const type& t)
+:   m_type(t)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void json_plan::compile()
+{
+    for (const auto& prop : m_type.get_properties())
+    {
+        if (prop.is_static())
+            continue;
+
+        const json_value_info info = json_value_info::get(prop.get_type());
+        if (info.m_kind == json_value_kind::UNSUPPORTED)
+            continue;
+
+        std::string key;
+        json_append_string(key, prop.get_name());
+        key += ':';
+
+        m_field_index_list.emplace(prop.get_name(), m_fields.size());
+        m_fields.push_back({prop.get_name(), std::move(key), get_wrapper(prop), info, prop.is_readonly()});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const json_plan& json_plan::get(const type& t)
+{
+    return plan_cache<json_plan>::get(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type json_plan::get_type() const
+{
+    return m_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<json_field>& json_plan::get_fields() const
+{
+    return m_fields;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const json_field* json_plan::find_field(string_view name) const
+{
+    auto found = m_field_index_list.find(name);
+    return (found != m_field_index_list.end() ? &m_fields[found->second] : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static uint64_t load_as(const void* address)
+{
+    T value;
+    std::memcpy(&value, address, sizeof(T));
+    return static_cast<uint64_t>(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t json_load_integer(const void* address, json_number_kind kind)
+{
+    switch (kind)
+    {
+        case json_number_kind::INT8:        return static_cast<uint64_t>(static_cast<int64_t>(load_as<int8_t>(address)));
+        case json_number_kind::INT16:       return static_cast<uint64_t>(static_cast<int64_t>(load_as<int16_t>(address)));
+        case json_number_kind::INT32:       return static_cast<uint64_t>(static_cast<int64_t>(load_as<int32_t>(address)));
+        case json_number_kind::INT64:       return load_as<int64_t>(address);
+        case json_number_kind::UINT8:       return load_as<uint8_t>(address);
+        case json_number_kind::UINT16:      return load_as<uint16_t>(address);
+        case json_number_kind::UINT32:      return load_as<uint32_t>(address);
+        case json_number_kind::UINT64:      return load_as<uint64_t>(address);
+        case json_number_kind::FLOAT:       return static_cast<uint64_t>(static_cast<int64_t>(*static_cast<const float*>(address)));
+        case json_number_kind::DOUBLE:      return static_cast<uint64_t>(static_cast<int64_t>(*static_cast<const double*>(address)));
+        case json_number_kind::LONG_DOUBLE: return static_cast<uint64_t>(static_cast<int64_t>(*static_cast<const long double*>(address)));
+    }
+
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static bool store_as(void* address, uint64_t value, bool is_negative)
+{
+    if (is_negative)
+    {
+        const int64_t signed_value = static_cast<int64_t>(value);
+        if (!std::is_signed<T>::value || signed_value < static_cast<int64_t>(std::numeric_limits<T>::min()))
+            return false;
+    }
+    else if (value > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+    {
+        return false;
+    }
+
+    const T result = static_cast<T>(value);
+    std::memcpy(address, &result, sizeof(T));
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool json_store_integer(void* address, json_number_kind kind, uint64_t value, bool is_negative)
+{
+    switch (kind)
+    {
+        case json_number_kind::INT8:    return store_as<int8_t>(address, value, is_negative);
+        case json_number_kind::INT16:   return store_as<int16_t>(address, value, is_negative);
+        case json_number_kind::INT32:   return store_as<int32_t>(address, value, is_negative);
+        case json_number_kind::INT64:   return store_as<int64_t>(address, value, is_negative);
+        case json_number_kind::UINT8:   return store_as<uint8_t>(address, value, is_negative);
+        case json_number_kind::UINT16:  return store_as<uint16_t>(address, value, is_negative);
+        case json_number_kind::UINT32:  return store_as<uint32_t>(address, value, is_negative);
+        case json_number_kind::UINT64:  return store_as<uint64_t>(address, value, is_negative);
+        case json_number_kind::FLOAT:
+        {
+            *static_cast<float*>(address) = is_negative ? static_cast<float>(static_cast<int64_t>(value)) : static_cast<float>(value);
+            return true;
+        }
+        case json_number_kind::DOUBLE:
+        {
+            *static_cast<double*>(address) = is_negative ? static_cast<double>(static_cast<int64_t>(value)) : static_cast<double>(value);
+            return true;
+        }
+        case json_number_kind::LONG_DOUBLE:
+        {
+            *static_cast<long double*>(address) = is_negative ? static_cast<long double>(static_cast<int64_t>(value)) : static_cast<long double>(value);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void json_append_string(std::string& output, string_view text)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    output += '"';
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    const char* run_begin = begin;
+    for (const char* itr = begin; itr != end; ++itr)
+    {
+        const unsigned char c = static_cast<unsigned char>(*itr);
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+
+        output.append(run_begin, itr);
+        run_begin = itr + 1;
+        switch (c)
+        {
+            case '"':   output += "\\\""; break;
+            case '\\':  output += "\\\\"; break;
+            case '\b':  output += "\\b"; break;
+            case '\f':  output += "\\f"; break;
+            case '\n':  output += "\\n"; break;
+            case '\r':  output += "\\r"; break;
+            case '\t':  output += "\\t"; break;
+            default:
+            {
+                const char escaped[] = {'\\', 'u', '0', '0', hex_digits[c >> 4], hex_digits[c & 0x0f]};
+                output.append(escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+    output.append(run_begin, end);
+    output += '"';
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,224 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_JSON_PLAN_H_
+#define RTTR_JSON_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/detail/misc/plan_cache.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+class property_wrapper_base;
+class json_plan;
+class json_enum_table;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Describes how a value is represented in JSON.
+ */
+enum class json_value_kind : uint8_t
+{
+    BOOLEAN,        //!< `true` or `false`
+    NUMBER,         //!< all other arithmetic types
+    ENUMERATION,    //!< the name of the enumerator; a number, when the value has no name
+    STRING,         //!< std::string
+    ARRAY,          //!< a JSON array with the elements
+    OBJECT,         //!< a JSON object with the properties of the class
+    UNSUPPORTED     //!< pointers, wrappers and all other values; these are not serialized
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The storage of an arithmetic value, which is read and written directly in memory.
+ */
+enum class json_number_kind : uint8_t
+{
+    INT8,
+    INT16,
+    INT32,
+    INT64,
+    UINT8,
+    UINT16,
+    UINT32,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    LONG_DOUBLE
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Everything, which is needed to read or write a value of one type.
+ */
+struct json_value_info
+{
+    /*!
+     * Returns the description for values of type \p t. This function is thread safe.
+     */
+    static json_value_info get(const type& t);
+
+    type                    m_type;
+    json_value_kind         m_kind;
+    json_number_kind        m_number_kind;  //!< the storage of a NUMBER or the underlying type of an ENUMERATION
+    const json_plan*        m_plan;         //!< the plan of an OBJECT value
+    const json_enum_table*  m_enum_table;   //!< the enumerators of an ENUMERATION value
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The names and values of all enumerators of one enumeration, in both directions.
+ *
+ * The values are stored as the bits of the underlying type, sign extended to 64 bit.
+ */
+class json_enum_table
+{
+    public:
+        /*!
+         * Returns the table for the enumeration \p t. This function is thread safe.
+         */
+        static const json_enum_table& get(const type& t);
+
+        /*!
+         * Returns the name of the enumerator with the given \p value, or an empty string_view when there is none.
+         */
+        string_view get_name(uint64_t value) const;
+
+        /*!
+         * Sets \p value to the value of the enumerator with the given \p name.
+         *
+         * \return True, when an enumerator with this name exists; otherwise false.
+         */
+        bool get_value(string_view name, uint64_t& value) const;
+
+    private:
+        explicit json_enum_table(const type& t);
+
+    private:
+        std::vector<std::pair<uint64_t, string_view>>   m_name_list;
+        std::unordered_map<string_view, uint64_t>       m_value_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One serialized property of a \ref json_plan.
+ */
+struct json_field
+{
+    string_view                     m_name;
+    std::string                     m_key;          //!< the escaped and quoted name, followed by a colon
+    const property_wrapper_base*    m_wrapper;
+    json_value_info                 m_value;
+    bool                            m_is_readonly;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The precompiled description of how the objects of one class are written to and read from JSON.
+ *
+ * The plan contains the serializable, non-static properties of the class in the order of \ref type::get_properties(),
+ * together with a hash table from the property name to the field. So the members of a JSON object
+ * can be found in constant time, in any order.
+ *
+ * A plan is compiled once per type, on first use; it is never invalidated.
+ */
+class json_plan
+{
+    public:
+        /*!
+         * Returns the plan for the class \p t. This function is thread safe.
+         */
+        static const json_plan& get(const type& t);
+
+        type get_type() const;
+
+        const std::vector<json_field>& get_fields() const;
+
+        /*!
+         * Returns the field with the given \p name, or a nullptr when the class has no such property.
+         */
+        const json_field* find_field(string_view name) const;
+
+    private:
+        explicit json_plan(const type& t);
+
+        //! The fields are compiled after the plan is stored in the \ref plan_cache.
+        void compile();
+
+        friend class plan_cache<json_plan>;
+
+    private:
+        type                                            m_type;
+        std::vector<json_field>                         m_fields;
+        std::unordered_map<string_view, std::size_t>    m_field_index_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the value at \p address, which is stored as \p kind, as 64 bit value.
+ * Signed values are sign extended, floating point values are truncated.
+ */
+uint64_t json_load_integer(const void* address, json_number_kind kind);
+
+/*!
+ * Stores the 64 bit \p value at \p address as \p kind; \p is_negative indicates a signed value.
+ *
+ * \return False, when the value is out of the range of \p kind; otherwise true.
+ */
+bool json_store_integer(void* address, json_number_kind kind, uint64_t value, bool is_negative);
+
+/*!
+ * Escapes \p text for a JSON string and appends it, quoted, to \p output.
+ */
+void json_append_string(std::string& output, string_view text);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_JSON_PLAN_H_
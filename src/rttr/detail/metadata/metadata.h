@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/variant.h"
+#include "rttr/metadata_key.h"
 
 namespace rttr
 {
@@ -39,38 +40,42 @@ namespace detail
 /*!
  * This class holds meta data.
  *
+ * The key is interned on construction, so that a lookup via \ref metadata_key
+ * has to compare only the integer id of the key.
  */
 class RTTR_API metadata
 {
     public:
         metadata() { }
-        metadata(variant key, variant value) : m_key(std::move(key)), m_value(std::move(value)) { }
-        metadata(const metadata& other) : m_key(other.m_key), m_value(other.m_value) {}
-        metadata(metadata&& other) : m_key(std::move(other.m_key)), m_value(std::move(other.m_value)) {}
-        metadata& operator=(const metadata& other) { m_key = other.m_key; m_value = other.m_value; return *this; }
+        metadata(variant key, variant value) : m_key(std::move(key)), m_value(std::move(value)), m_key_id(m_key) { }
+        metadata(const metadata& other) : m_key(other.m_key), m_value(other.m_value), m_key_id(other.m_key_id) {}
+        metadata(metadata&& other) : m_key(std::move(other.m_key)), m_value(std::move(other.m_value)), m_key_id(other.m_key_id) {}
+        metadata& operator=(const metadata& other) { m_key = other.m_key; m_value = other.m_value; m_key_id = other.m_key_id; return *this; }
 
-        variant get_key() const      { return m_key; }
-        variant get_value() const    { return m_value; }
+        variant get_key() const             { return m_key; }
+        variant get_value() const           { return m_value; }
+        metadata_key get_key_id() const     { return m_key_id; }
 
-        struct order_by_key
+        struct order_by_key_id
         {
             RTTR_INLINE bool operator () ( const metadata& _left, const metadata& _right )  const
             {
-                return _left.m_key < _right.m_key;
+                return _left.m_key_id.get_id() < _right.m_key_id.get_id();
             }
-            RTTR_INLINE bool operator () ( const variant& _left, const metadata& _right ) const
+            RTTR_INLINE bool operator () ( const metadata_key& _left, const metadata& _right ) const
             {
-                return _left < _right.m_key;
+                return _left.get_id() < _right.m_key_id.get_id();
             }
-            RTTR_INLINE bool operator () ( const metadata& _left, const variant& _right ) const
+            RTTR_INLINE bool operator () ( const metadata& _left, const metadata_key& _right ) const
             {
-                return _left.m_key < _right;
+                return _left.m_key_id.get_id() < _right.get_id();
             }
         };
 
     private:
-        variant m_key;
-        variant m_value;
+        variant         m_key;
+        variant         m_value;
+        metadata_key    m_key_id;
 };
 
 } // end namespace detail
@@ -45,7 +45,11 @@ template<std::size_t Metadata_Count>
 class metadata_handler
 {
     public:
-        RTTR_FORCE_INLINE metadata_handler(std::array<metadata, Metadata_Count> new_data) : m_metadata_list(std::move(new_data)) { }
+        RTTR_FORCE_INLINE metadata_handler(std::array<metadata, Metadata_Count> new_data) : m_metadata_list(std::move(new_data))
+        {
+            for (std::size_t i = 0; i < Metadata_Count; ++i)
+                m_key_id_list[i] = m_metadata_list[i].get_key_id().get_id();
+        }
 
         RTTR_FORCE_INLINE variant get_metadata(const variant& key) const
         {
@@ -59,8 +63,22 @@ class metadata_handler
             return variant();
         }
 
+        RTTR_FORCE_INLINE variant get_metadata(const metadata_key& key) const
+        {
+            const auto id = key.get_id();
+            for (std::size_t i = 0; i < Metadata_Count; ++i)
+            {
+                if (m_key_id_list[i] == id)
+                    return m_metadata_list[i].get_value();
+            }
+
+            return variant();
+        }
+
     private:
-        std::array<metadata, Metadata_Count> m_metadata_list;
+        std::array<metadata, Metadata_Count>        m_metadata_list;
+        //! The interned ids of the keys, stored separately, so that a lookup touches only this compact table.
+        std::array<std::uint32_t, Metadata_Count>   m_key_id_list;
 };
 
 /*!
@@ -76,6 +94,7 @@ class metadata_handler<0>
         RTTR_FORCE_INLINE void set_metadata(std::array<metadata, 0> new_data) { }
 
         RTTR_FORCE_INLINE variant get_metadata(const variant& key) const  { return variant(); }
+        RTTR_FORCE_INLINE variant get_metadata(const metadata_key& key) const  { return variant(); }
 };
 
 } // end namespace detail
@@ -83,6 +83,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<Param
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke(instance& object) const
         {
@@ -160,6 +161,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke(instance& object) const
         {
@@ -230,6 +232,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<>, Me
         access_levels get_access_level()                    const { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke(instance& object) const
         {
@@ -301,6 +304,7 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
         access_levels get_access_level()                    const { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key)       const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         variant invoke(instance& object) const
         {
@@ -71,6 +71,7 @@ class RTTR_API method_wrapper_base
         virtual std::vector<bool> get_is_const() const = 0;
         virtual array_range<parameter_info> get_parameter_infos() const = 0;
         virtual variant get_metadata(const variant& key) const = 0;
+        virtual variant get_metadata(const metadata_key& key) const = 0;
 
         virtual variant invoke(instance& object) const = 0;
         virtual variant invoke(instance& object, argument& arg1) const = 0;
@@ -73,6 +73,14 @@ using class_item_to_wrapper_t = conditional_t< std::is_same<T, property>::value,
 template<typename T>
 T create_item(const class_item_to_wrapper_t<T>* wrapper = nullptr);
 
+/*!
+ * Returns the wrapper of the given class item \p item; or a nullptr, when the item is not valid.
+ *
+ * This gives internal code, which calls an item very often (e.g. a serializer), direct access to the wrapper.
+ */
+template<typename T>
+const class_item_to_wrapper_t<T>* get_wrapper(const T& item);
+
 } // end namespace detail
 } // end namespace rttr
 
@@ -0,0 +1,110 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ITERATOR_STORAGE_H_
+#define RTTR_ITERATOR_STORAGE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <type_traits>
+#include <new>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The type erased storage for the position of an iterator of a reflected container,
+ * e.g. \ref variant_array_view::const_iterator. It holds either an index or the iterator of the underlying container.
+ */
+using iterator_data = std::aligned_storage<sizeof(void*) * 2, std::alignment_of<void*>::value>::type;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Copies and destroys the content of an \ref iterator_data object.
+ * The functions do not depend on the container wrapper instance,
+ * so an iterator can be safely destroyed after the view it was created from.
+ */
+struct iterator_manager
+{
+    void (*copy)(const iterator_data& src, iterator_data& dest);
+    void (*destroy)(iterator_data& itr);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Places an iterator of type \p Itr inside an \ref iterator_data object.
+ * When the iterator does not fit into the storage, it will be allocated on the heap.
+ */
+template<typename Itr, bool Can_Place = (sizeof(Itr) <= sizeof(iterator_data)) &&
+                                        (std::alignment_of<Itr>::value <= std::alignment_of<iterator_data>::value)>
+struct iterator_storage
+{
+    static RTTR_INLINE Itr& get(iterator_data& data) { return reinterpret_cast<Itr&>(data); }
+    static RTTR_INLINE const Itr& get(const iterator_data& data) { return reinterpret_cast<const Itr&>(data); }
+
+    static RTTR_INLINE void create(iterator_data& data, const Itr& itr) { new (&data) Itr(itr); }
+    static RTTR_INLINE void destroy(iterator_data& data) { get(data).~Itr(); }
+
+    static void copy(const iterator_data& src, iterator_data& dest) { create(dest, get(src)); }
+
+    static const iterator_manager* get_manager()
+    {
+        static const iterator_manager manager = { &copy, &destroy };
+        return &manager;
+    }
+};
+
+template<typename Itr>
+struct iterator_storage<Itr, false>
+{
+    static RTTR_INLINE Itr& get(iterator_data& data) { return *reinterpret_cast<Itr*&>(data); }
+    static RTTR_INLINE const Itr& get(const iterator_data& data) { return *reinterpret_cast<Itr* const&>(data); }
+
+    static RTTR_INLINE void create(iterator_data& data, const Itr& itr) { reinterpret_cast<Itr*&>(data) = new Itr(itr); }
+    static RTTR_INLINE void destroy(iterator_data& data) { delete reinterpret_cast<Itr*&>(data); }
+
+    static void copy(const iterator_data& src, iterator_data& dest) { create(dest, get(src)); }
+
+    static const iterator_manager* get_manager()
+    {
+        static const iterator_manager manager = { &copy, &destroy };
+        return &manager;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ITERATOR_STORAGE_H_
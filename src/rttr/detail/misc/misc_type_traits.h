@@ -32,6 +32,7 @@
 
 #include "rttr/detail/misc/function_traits.h"
 #include "rttr/array_mapper.h"
+#include "rttr/associative_mapper.h"
 #include "rttr/detail/misc/std_type_traits.h"
 
 
@@ -466,6 +467,86 @@ namespace detail
 
     template<typename T>
     using is_raw_array_type = ::rttr::detail::is_array<raw_type_t<T>>;
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // has_array_data_func<T>::value is true, when array_mapper<T> provides the function 'get_data(T&)',
+    // which means, the elements of the array are stored contiguously in memory
+
+    template <typename T>
+    struct has_array_data_func_impl
+    {
+        typedef char YesType[1];
+        typedef char NoType[2];
+
+        template <typename U> static YesType& check(decltype(array_mapper<U>::get_data(std::declval<U&>()))*);
+        template <typename U> static NoType& check(...);
+
+        static const bool value = (sizeof(check<T>(0)) == sizeof(YesType));
+    };
+
+    template<typename T>
+    using has_array_data_func = std::integral_constant<bool, has_array_data_func_impl<remove_cv_t< remove_reference_t<T> > >::value>;
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // has_array_iterator_func<T>::value is true, when array_mapper<T> provides the function 'begin(T&)',
+    // which means, the array should be traversed with the iterators of the container instead of an index
+
+    template <typename T>
+    struct has_array_iterator_func_impl
+    {
+        typedef char YesType[1];
+        typedef char NoType[2];
+
+        template <typename U> static YesType& check(decltype(array_mapper<U>::begin(std::declval<U&>()))*);
+        template <typename U> static NoType& check(...);
+
+        static const bool value = (sizeof(check<T>(0)) == sizeof(YesType));
+    };
+
+    template<typename T>
+    using has_array_iterator_func = std::integral_constant<bool, has_array_iterator_func_impl<remove_cv_t< remove_reference_t<T> > >::value>;
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // has_array_reserve_func<T>::value is true, when array_mapper<T> provides the function 'reserve(T&, std::size_t)',
+    // which allows to preallocate the storage before several elements are appended
+
+    template <typename T>
+    struct has_array_reserve_func_impl
+    {
+        typedef char YesType[1];
+        typedef char NoType[2];
+
+        template <typename U> static YesType& check(decltype(array_mapper<U>::reserve(std::declval<U&>(), std::size_t(0)))*);
+        template <typename U> static NoType& check(...);
+
+        static const bool value = (sizeof(check<T>(0)) == sizeof(YesType));
+    };
+
+    template<typename T>
+    using has_array_reserve_func = std::integral_constant<bool, has_array_reserve_func_impl<remove_cv_t< remove_reference_t<T> > >::value>;
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // is_associative_container<T>::value is true, when there exist a specialization of associative_mapper<T>
+
+    template <typename T>
+    struct is_associative_container_impl
+    {
+        typedef char YesType[1];
+        typedef char NoType[2];
+
+        template <typename U> static NoType& check(typename U::no_associative_type*);
+        template <typename U> static YesType& check(...);
+
+
+        static const bool value = (sizeof(check<associative_mapper<T> >(0)) == sizeof(YesType));
+    };
+
+    template<typename T>
+    using is_associative_container = std::integral_constant<bool, is_associative_container_impl<remove_cv_t< remove_reference_t<T> > >::value>;
+
+    template<typename T>
+    using is_raw_associative_container_type = is_associative_container<raw_type_t<T>>;
+
     /////////////////////////////////////////////////////////////////////////////////////
     // rank_type<T, size_t>::type
     //
@@ -0,0 +1,93 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PLAN_CACHE_H_
+#define RTTR_PLAN_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * Stores one plan of the class \p Plan per \ref type; a plan is created on first use and is never invalidated.
+ *
+ * \p Plan needs a constructor, which takes the type, a `compile()` function and `get_type()`;
+ * the cache has to be a friend, when these functions are private.
+ * The plan is stored before it is compiled, so the plans of members can refer back to it.
+ */
+template<typename Plan>
+class plan_cache
+{
+    public:
+        /*!
+         * Returns the plan for the class \p t. This function is thread safe.
+         */
+        static const Plan& get(const type& t)
+        {
+            // plans are mostly requested in loops over one type, so the last plan is checked before the lock is taken
+            static std::atomic<const Plan*> last_plan(nullptr);
+            const Plan* last = last_plan.load(std::memory_order_acquire);
+            if (last && last->get_type() == t)
+                return *last;
+
+            // recursive, because the plans of the members are compiled while the lock is held
+            static std::recursive_mutex mutex;
+            static std::unordered_map<type::type_id, std::unique_ptr<Plan>> plan_list;
+            static bool is_compiling = false;
+
+            std::lock_guard<std::recursive_mutex> lock(mutex);
+            auto& plan = plan_list[t.get_id()];
+            if (!plan)
+            {
+                plan.reset(new Plan(t));
+                const bool was_compiling = is_compiling;
+                is_compiling = true;
+                plan->compile();
+                is_compiling = was_compiling;
+            }
+
+            // during compilation the plan might be incomplete yet, so it must not be visible to other threads
+            if (!is_compiling)
+                last_plan.store(plan.get(), std::memory_order_release);
+
+            return *plan;
+        }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PLAN_CACHE_H_
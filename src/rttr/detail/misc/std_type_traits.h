@@ -212,6 +212,27 @@ using remove_cv = std::remove_cv<T>;
 
 #endif
 
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+
+#if RTTR_COMPILER == RTTR_COMPILER_GNUC && RTTR_COMP_VER < 5000
+// the standard library of GCC 4.x does not provide std::is_trivially_copyable
+
+template<typename T>
+struct is_trivially_copyable : std::integral_constant<bool, __has_trivial_copy(T) &&
+                                                            __has_trivial_assign(T) &&
+                                                            std::is_trivially_destructible<T>::value>
+{
+};
+
+#else
+
+template<typename T>
+using is_trivially_copyable = std::is_trivially_copyable<T>;
+
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////
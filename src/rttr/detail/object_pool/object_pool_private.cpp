@@ -0,0 +1,293 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/object_pool/object_pool_private.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace rttr
+{
+namespace detail
+{
+
+//! The list of all pools; the index of a pool is its position, the entry of a destroyed pool is `nullptr`.
+struct pool_registry
+{
+    std::mutex                          m_mutex;
+    std::vector<object_pool_private*>   m_pools;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static pool_registry& get_pool_registry()
+{
+    // the registry is never destroyed, because pools and exiting threads might still use it
+    // during the destruction of the static objects
+    static pool_registry* registry = new pool_registry;
+    return *registry;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Moves up to \p count blocks from the front of \p from to the front of \p to.
+static void move_blocks(pool_free_list& from, pool_free_list& to, std::size_t count)
+{
+    for (; count > 0 && from.m_head; --count)
+    {
+        pool_block* block = from.m_head;
+        from.m_head = block->m_next;
+        --from.m_count;
+
+        block->m_next = to.m_head;
+        to.m_head = block;
+        ++to.m_count;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef RTTR_NO_CXX11_THREAD_LOCAL
+
+/*!
+ * The free lists of all pools for one thread; the list of a pool is found via the index of the pool.
+ *
+ * When the thread exits, the blocks are handed over to the shared lists of the pools, which are still alive.
+ */
+class thread_free_lists
+{
+    public:
+        ~thread_free_lists()
+        {
+            auto& registry = get_pool_registry();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            for (std::size_t i = 0; i < m_lists.size(); ++i)
+            {
+                if (m_lists[i].m_count > 0 && registry.m_pools[i])
+                    registry.m_pools[i]->release_blocks(m_lists[i]);
+            }
+        }
+
+        pool_free_list& get(std::size_t index)
+        {
+            if (index >= m_lists.size())
+                m_lists.resize(index + 1);
+
+            return m_lists[index];
+        }
+
+    private:
+        std::vector<pool_free_list> m_lists;
+};
+
+static thread_local thread_free_lists g_thread_free_lists;
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool_private::object_pool_private(const object_allocator* owner, std::size_t object_size,
+                                         std::size_t alignment, std::size_t objects_per_chunk)
+:   m_owner(owner),
+    m_index(0),
+    m_alignment(std::max(alignment, alignof(pool_block))),
+    m_objects_per_chunk(std::max(objects_per_chunk, std::size_t(1))),
+    m_allocation_count(0),
+    m_deallocation_count(0)
+{
+    // every block has to be big enough for the link to the next free block,
+    // the size is a multiple of the alignment, so all blocks of a chunk are aligned
+    const std::size_t size = std::max(object_size, sizeof(pool_block));
+    m_block_size = (size + m_alignment - 1) / m_alignment * m_alignment;
+
+    auto& registry = get_pool_registry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    m_index = registry.m_pools.size();
+    registry.m_pools.push_back(this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool_private::~object_pool_private()
+{
+    {
+        auto& registry = get_pool_registry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        registry.m_pools[m_index] = nullptr;
+    }
+
+    for (auto chunk : m_chunks)
+        ::operator delete(chunk);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* object_pool_private::allocate()
+{
+#ifndef RTTR_NO_CXX11_THREAD_LOCAL
+    pool_free_list& list = g_thread_free_lists.get(m_index);
+    if (!list.m_head)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        refill(list);
+    }
+#else
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pool_free_list& list = m_shared_list;
+    if (!list.m_head)
+        add_chunk(list);
+#endif
+
+    pool_block* block = list.m_head;
+    list.m_head = block->m_next;
+    --list.m_count;
+
+    m_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return block;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool_private::deallocate(void* ptr)
+{
+    pool_block* block = static_cast<pool_block*>(ptr);
+
+#ifndef RTTR_NO_CXX11_THREAD_LOCAL
+    pool_free_list& list = g_thread_free_lists.get(m_index);
+    block->m_next = list.m_head;
+    list.m_head = block;
+    ++list.m_count;
+
+    // a thread, which only releases objects, would otherwise collect all blocks of the pool
+    if (list.m_count > 2 * m_objects_per_chunk)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        move_blocks(list, m_shared_list, m_objects_per_chunk);
+    }
+#else
+    std::lock_guard<std::mutex> lock(m_mutex);
+    block->m_next = m_shared_list.m_head;
+    m_shared_list.m_head = block;
+    ++m_shared_list.m_count;
+#endif
+
+    m_deallocation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool_private::refill(pool_free_list& list)
+{
+    if (m_shared_list.m_head)
+        move_blocks(m_shared_list, list, m_objects_per_chunk);
+    else
+        add_chunk(list);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool_private::add_chunk(pool_free_list& list)
+{
+    void* chunk = ::operator new(m_block_size * m_objects_per_chunk + m_alignment - 1);
+    m_chunks.push_back(chunk);
+
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk);
+    char* first = reinterpret_cast<char*>((address + m_alignment - 1) & ~std::uintptr_t(m_alignment - 1));
+
+    // the blocks are linked backwards, so they are handed out in the order of their addresses
+    for (std::size_t i = m_objects_per_chunk; i > 0; --i)
+    {
+        pool_block* block = reinterpret_cast<pool_block*>(first + (i - 1) * m_block_size);
+        block->m_next = list.m_head;
+        list.m_head = block;
+    }
+    list.m_count += m_objects_per_chunk;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool_private::release_blocks(pool_free_list& list)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    move_blocks(list, m_shared_list, list.m_count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_pool_private::can_allocate(std::size_t size, std::size_t alignment) const
+{
+    return (size <= m_block_size && alignment <= m_alignment);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t object_pool_private::get_block_size() const
+{
+    return m_block_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_statistics object_pool_private::get_statistics() const
+{
+    pool_statistics stats;
+    stats.m_block_size          = m_block_size;
+    stats.m_allocation_count    = m_allocation_count.load(std::memory_order_relaxed);
+    stats.m_deallocation_count  = m_deallocation_count.load(std::memory_order_relaxed);
+    stats.m_live_count          = stats.m_allocation_count - std::min(stats.m_deallocation_count, stats.m_allocation_count);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t block_count = m_chunks.size() * m_objects_per_chunk;
+    stats.m_chunk_count         = m_chunks.size();
+    stats.m_reserved_bytes      = block_count * m_block_size;
+    stats.m_free_count          = block_count - std::min(stats.m_live_count, block_count);
+    return stats;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const object_pool_private* object_pool_private::find(const object_allocator* allocator)
+{
+    if (!allocator)
+        return nullptr;
+
+    auto& registry = get_pool_registry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    for (auto pool : registry.m_pools)
+    {
+        if (pool && pool->m_owner == allocator)
+            return pool;
+    }
+
+    return nullptr;
+}
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,108 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_OBJECT_POOL_PRIVATE_H_
+#define RTTR_OBJECT_POOL_PRIVATE_H_
+
+#include "rttr/object_pool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+//! A free block of a pool; the link to the next free block is stored in the memory of the block itself.
+struct pool_block
+{
+    pool_block* m_next;
+};
+
+//! A singly linked list of free blocks.
+struct pool_free_list
+{
+    pool_free_list() : m_head(nullptr), m_count(0) {}
+
+    pool_block*     m_head;
+    std::size_t     m_count;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The implementation of \ref object_pool.
+ *
+ * Every pool gets an unique index, with this index every thread finds its own \ref pool_free_list of the pool.
+ * The indices are never reused, so the list of an exited thread can be matched to a pool, which might be already destroyed.
+ */
+class object_pool_private
+{
+    public:
+        object_pool_private(const object_allocator* owner, std::size_t object_size, std::size_t alignment, std::size_t objects_per_chunk);
+        ~object_pool_private();
+
+        void* allocate();
+        void deallocate(void* ptr);
+
+        bool can_allocate(std::size_t size, std::size_t alignment) const;
+        std::size_t get_block_size() const;
+        pool_statistics get_statistics() const;
+
+        //! Moves all blocks of \p list to the shared list.
+        void release_blocks(pool_free_list& list);
+
+        //! Returns the pool, which is used as \p allocator; `nullptr`, when \p allocator is no \ref object_pool.
+        static const object_pool_private* find(const object_allocator* allocator);
+
+    private:
+        //! Fills \p list from the shared list or with the blocks of a new chunk; the mutex has to be locked.
+        void refill(pool_free_list& list);
+        void add_chunk(pool_free_list& list);
+
+    private:
+        const object_allocator*     m_owner;
+        std::size_t                 m_index;
+        std::size_t                 m_block_size;
+        std::size_t                 m_alignment;
+        std::size_t                 m_objects_per_chunk;
+
+        mutable std::mutex          m_mutex;
+        pool_free_list              m_shared_list;
+        std::vector<void*>          m_chunks;
+
+        std::atomic<std::size_t>    m_allocation_count;
+        std::atomic<std::size_t>    m_deallocation_count;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_OBJECT_POOL_PRIVATE_H_
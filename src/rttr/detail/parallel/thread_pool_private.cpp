@@ -0,0 +1,266 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/parallel/thread_pool_private.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void work_stealing_queue::push(pool_task&& task)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool work_stealing_queue::pop(pool_task& task)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty())
+        return false;
+
+    task = std::move(m_tasks.back());
+    m_tasks.pop_back();
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool work_stealing_queue::steal(pool_task& task)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty())
+        return false;
+
+    task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+thread_pool_private::thread_pool_private(std::size_t thread_count)
+:   m_queued_count(0),
+    m_done(false)
+{
+    // the last queue is shared by all threads, which do not belong to the pool
+    for (std::size_t i = 0; i <= thread_count; ++i)
+        m_queues.emplace_back(new work_stealing_queue);
+
+    m_threads.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+        m_threads.emplace_back(&thread_pool_private::run_worker, this, i);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+thread_pool_private::~thread_pool_private()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_done = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t thread_pool_private::get_thread_count() const
+{
+    return m_threads.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t thread_pool_private::get_queue_index() const
+{
+    // the threads are created in the constructor, afterwards the list is never modified again
+    const auto id = std::this_thread::get_id();
+    for (std::size_t i = 0; i < m_threads.size(); ++i)
+    {
+        if (m_threads[i].get_id() == id)
+            return i;
+    }
+
+    return m_threads.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void thread_pool_private::push(pool_task&& task)
+{
+    // the counter is increased first, so it is never smaller than the number of queued tasks;
+    // increasing it under the lock avoids a lost wake up of a worker, which is just about to sleep
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_queued_count;
+    }
+
+    m_queues[get_queue_index()]->push(std::move(task));
+    m_condition.notify_one();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool thread_pool_private::try_run_one()
+{
+    return try_run_one(get_queue_index());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool thread_pool_private::try_run_one(std::size_t queue_index)
+{
+    pool_task task;
+    if (!m_queues[queue_index]->pop(task))
+    {
+        const std::size_t queue_count = m_queues.size();
+        bool found = false;
+        for (std::size_t i = 1; i < queue_count && !found; ++i)
+            found = m_queues[(queue_index + i) % queue_count]->steal(task);
+
+        if (!found)
+            return false;
+    }
+
+    --m_queued_count;
+    task();
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void thread_pool_private::run_worker(std::size_t queue_index)
+{
+    while (true)
+    {
+        if (try_run_one(queue_index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return (m_done || m_queued_count > 0); });
+        if (m_done)
+            return;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+task_group::task_group(thread_pool_private& pool)
+:   m_pool(pool),
+    m_pending_count(0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+task_group::~task_group()
+{
+    // the tasks may refer to data of the group owner, so they have to be finished in any case
+    wait_for_tasks();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void task_group::run(pool_task task)
+{
+    ++m_pending_count;
+    m_pool.push([this, task]()
+    {
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_exception_mutex);
+            if (!m_exception)
+                m_exception = std::current_exception();
+        }
+        // the waiting thread checks the count only while it holds the lock, so it cannot destroy the group
+        // before the notification is sent and the lock is released; nothing must be touched after this block
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_pending_count == 0)
+            m_finished.notify_all();
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void task_group::wait()
+{
+    wait_for_tasks();
+
+    if (m_exception)
+    {
+        std::exception_ptr exception;
+        std::swap(exception, m_exception);
+        std::rethrow_exception(exception);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void task_group::wait_for_tasks()
+{
+    while (true)
+    {
+        {
+            // a worker might still hold the lock, after it has finished the last task
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_pending_count == 0)
+                return;
+        }
+
+        if (m_pool.try_run_one())
+            continue;
+
+        // the tasks of this group are only pushed by the waiting thread itself, so when no task is queued anymore,
+        // the remaining ones are running in other threads and cannot be helped with
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_finished.wait(lock, [this]() { return (m_pending_count == 0); });
+        return;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
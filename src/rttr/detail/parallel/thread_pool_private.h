@@ -0,0 +1,148 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_THREAD_POOL_PRIVATE_H_
+#define RTTR_THREAD_POOL_PRIVATE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+using pool_task = std::function<void()>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The task queue of one worker thread.
+ *
+ * The owner pushes and pops tasks at the back (LIFO, the data of the last spawned task is most likely still in the cache),
+ * other threads steal from the front, so they take the oldest and usually biggest pieces of work.
+ */
+class work_stealing_queue
+{
+    public:
+        void push(pool_task&& task);
+        bool pop(pool_task& task);
+        bool steal(pool_task& task);
+
+    private:
+        std::mutex              m_mutex;
+        std::deque<pool_task>   m_tasks;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The implementation of \ref parallel::thread_pool.
+ *
+ * Every worker has its own \ref work_stealing_queue; one additional queue takes the tasks,
+ * which are spawned from threads outside of the pool. An idle worker steals from the other queues,
+ * when there is nothing left in the own queue, and sleeps only when no task is queued at all.
+ */
+class thread_pool_private
+{
+    public:
+        explicit thread_pool_private(std::size_t thread_count);
+        ~thread_pool_private();
+
+        std::size_t get_thread_count() const;
+
+        void push(pool_task&& task);
+
+        /*!
+         * Runs one queued task in the calling thread, when there is one.
+         * Returns false, when all queues are empty.
+         */
+        bool try_run_one();
+
+    private:
+        std::size_t get_queue_index() const;
+        bool try_run_one(std::size_t queue_index);
+        void run_worker(std::size_t queue_index);
+
+    private:
+        std::vector<std::unique_ptr<work_stealing_queue>>   m_queues;
+        std::vector<std::thread>                            m_threads;
+        std::mutex                                          m_mutex;
+        std::condition_variable                             m_condition;
+        std::atomic<std::size_t>                            m_queued_count;
+        bool                                                m_done;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A set of tasks, which run on a \ref thread_pool_private and can be waited for together.
+ *
+ * A thread which waits for the group, will run queued tasks meanwhile;
+ * so groups can be nested inside of tasks without blocking a worker.
+ * When no task is queued anymore, all tasks of the group are already running, so the thread sleeps until the last one has finished.
+ * The first exception, which was thrown by a task, will be rethrown by \ref wait().
+ */
+class task_group
+{
+    public:
+        explicit task_group(thread_pool_private& pool);
+        ~task_group();
+
+        void run(pool_task task);
+        void wait();
+
+    private:
+        //! Runs queued tasks, until none is left; afterwards sleeps, until the running tasks of the group are finished.
+        void wait_for_tasks();
+
+    private:
+        thread_pool_private&        m_pool;
+        std::atomic<std::size_t>    m_pending_count;
+        std::mutex                  m_mutex;
+        std::condition_variable     m_finished;
+        std::mutex                  m_exception_mutex;
+        std::exception_ptr          m_exception;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_THREAD_POOL_PRIVATE_H_
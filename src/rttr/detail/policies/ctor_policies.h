@@ -42,7 +42,9 @@ struct as_object {};
 
 struct as_std_shared_ptr {};
 
-using constructor_policy_list = type_list<as_raw_pointer, as_object, as_std_shared_ptr>;
+struct as_pooled {};
+
+using constructor_policy_list = type_list<as_raw_pointer, as_object, as_std_shared_ptr, as_pooled>;
 
 } // end namespace detail;
 
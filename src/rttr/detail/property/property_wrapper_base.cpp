@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/instance.h"
 
 namespace rttr
 {
@@ -69,5 +70,26 @@ type property_wrapper_base::get_declaring_type() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_ref property_wrapper_base::get_ref(instance& object) const
+{
+    return variant_ref(get_value(object));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* property_wrapper_base::get_value_address(instance& object) const
+{
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::copy_value(instance& source, instance& target) const
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
@@ -32,6 +32,7 @@
 #include "rttr/detail/metadata/metadata_handler.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
+#include "rttr/variant_ref.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
 
@@ -76,6 +77,7 @@ class RTTR_API property_wrapper_base
 
         //! Retrieve the stored metadata for this property
         virtual variant get_metadata(const variant& key) const = 0;
+        virtual variant get_metadata(const metadata_key& key) const = 0;
 
         //! Returns true when the underlying property is an array type.
         virtual bool is_array() const = 0;
@@ -85,9 +87,33 @@ class RTTR_API property_wrapper_base
 
         //! Returns the value of this property from the given instance \p instance.
         virtual variant get_value(instance& object) const = 0;
+
+        //! Returns a reference to the value of this property from the given instance \p instance; the default implementation copies the value.
+        virtual variant_ref get_ref(instance& object) const;
+
+        //! Returns the address of the value of this property inside \p object; or nullptr, when the value is not stored in the object (e.g. getter and setter functions).
+        virtual void* get_value_address(instance& object) const;
+
+        //! Copies the value of this property from \p source to \p target with the assignment operator of its type;
+        //! returns false, when the property is not writable or the value is not stored in the objects.
+        virtual bool copy_value(instance& source, instance& target) const;
     protected:
         void init();
 
+        //! Creates a \ref variant_ref, which refers to \p value.
+        template<typename T>
+        static enable_if_t<std::is_lvalue_reference<T>::value, variant_ref> create_ref(T&& value)
+        {
+            return variant_ref(value);
+        }
+
+        //! Creates a \ref variant_ref, which holds \p value, because a temporary value cannot be referenced.
+        template<typename T>
+        static enable_if_t<!std::is_lvalue_reference<T>::value, variant_ref> create_ref(T&& value)
+        {
+            return variant_ref(variant(std::forward<T>(value)));
+        }
+
     private:
         string_view m_name;
         type        m_declaring_type;
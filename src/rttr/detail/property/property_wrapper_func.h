@@ -60,6 +60,7 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, return_as_copy,
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -76,6 +77,11 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, return_as_copy,
             return variant(m_getter());
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return create_ref(m_getter());
+        }
+
     private:
         Getter m_getter;
         Setter m_setter;
@@ -109,6 +115,7 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, return_as_copy, re
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -120,6 +127,11 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, return_as_copy, re
             return (variant(m_accessor()));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return create_ref(m_accessor());
+        }
+
     private:
         Getter m_accessor;
 };
@@ -162,6 +174,7 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, return_as_ptr, s
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -211,6 +224,7 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, return_as_ptr, rea
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -62,6 +62,7 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_cop
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -82,6 +83,14 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_cop
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (class_type* ptr = object.try_convert<class_type>())
+                return create_ref((ptr->*m_getter)());
+            else
+                return variant_ref();
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -116,6 +125,7 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_copy,
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -130,6 +140,14 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_copy,
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (class_type* ptr = object.try_convert<class_type>())
+                return create_ref((ptr->*m_getter)());
+            else
+                return variant_ref();
+        }
+
     private:
         Getter  m_getter;
 };
@@ -171,6 +189,7 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_ptr
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -230,6 +249,7 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_ptr,
         bool is_array()     const   { return detail::is_array<return_type>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -53,6 +53,7 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
         bool is_array()     const   { return detail::is_array<A>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -71,6 +72,33 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return create_ref((ptr->*m_acc));
+            else
+                return variant_ref();
+        }
+
+        void* get_value_address(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return as_void_ptr(&(ptr->*m_acc));
+            else
+                return nullptr;
+        }
+
+        bool copy_value(instance& source, instance& target) const
+        {
+            C* source_ptr = source.try_convert<C>();
+            C* target_ptr = target.try_convert<C>();
+            if (!source_ptr || !target_ptr)
+                return false;
+
+            copy_array_impl<A>()(source_ptr->*m_acc, target_ptr->*m_acc);
+            return true;
+        }
+
     private:
         accessor m_acc;
 };
@@ -101,6 +129,7 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
         bool is_array()     const   { return detail::is_array<A>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -115,6 +144,22 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return create_ref((ptr->*m_acc));
+            else
+                return variant_ref();
+        }
+
+        void* get_value_address(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return as_void_ptr(&(ptr->*m_acc));
+            else
+                return nullptr;
+        }
+
     private:
         accessor m_acc;
 };
@@ -146,6 +191,7 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
         bool is_array()     const   { return detail::is_array<A>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -168,6 +214,17 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
                 return variant();
         }
 
+        bool copy_value(instance& source, instance& target) const
+        {
+            C* source_ptr = source.try_convert<C>();
+            C* target_ptr = target.try_convert<C>();
+            if (!source_ptr || !target_ptr)
+                return false;
+
+            copy_array_impl<A>()(source_ptr->*m_acc, target_ptr->*m_acc);
+            return true;
+        }
+
     private:
         accessor m_acc;
 };
@@ -198,6 +255,7 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
         bool is_array()     const   { return detail::is_array<A>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
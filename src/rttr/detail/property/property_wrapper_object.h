@@ -52,6 +52,7 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, set_valu
         bool is_array()     const   { return detail::is_array<C>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -70,6 +71,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, set_valu
             return (variant(*m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return create_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -97,6 +103,7 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, read_onl
         bool is_array()     const   { return detail::is_array<C>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -108,6 +115,11 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_copy, read_onl
             return (variant(*m_accessor));
         }
 
+        variant_ref get_ref(instance& object) const
+        {
+            return create_ref(*m_accessor);
+        }
+
     private:
         C* m_accessor;
 };
@@ -137,6 +149,7 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_ptr, set_as_pt
         bool is_array()     const   { return detail::is_array<C>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -182,6 +195,7 @@ class property_wrapper<object_ptr, C*, void, Acc_Level, return_as_ptr, read_only
         bool is_array()     const   { return detail::is_array<C>::value; }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const metadata_key& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -136,7 +136,7 @@ class registration::bind<detail::ctor, Class_Type, acc_level, Ctor_Args...> : pu
 
     public:
         bind(const std::shared_ptr<detail::registration_executer>& reg_exec)
-        :   registration::class_<Class_Type>(reg_exec), m_reg_exec(reg_exec)
+        :   registration::class_<Class_Type>(reg_exec), m_reg_exec(reg_exec), m_use_pool(false)
         {
             m_reg_exec->add_registration_func(this);
         }
@@ -154,8 +154,12 @@ class registration::bind<detail::ctor, Class_Type, acc_level, Ctor_Args...> : pu
                                                                                         param_info_t());
 
             auto wrapper = detail::make_rref(std::move(m_ctor));
-            auto reg_func = [wrapper]()
+            const bool use_pool = m_use_pool;
+            auto reg_func = [wrapper, use_pool]()
             {
+                if (use_pool)
+                    type_register::object_pool(type::get<Class_Type>());
+
                 type_register::constructor(type::get<Class_Type>(), std::move(wrapper.m_value));
                 type_register::destructor(type::get<Class_Type>(), detail::make_unique<destructor_wrapper<Class_Type>>());
             };
@@ -193,6 +197,7 @@ class registration::bind<detail::ctor, Class_Type, acc_level, Ctor_Args...> : pu
             // at the moment we only supported one policy
             using first_prop_policy = typename std::tuple_element<0, as_std_tuple_t<policy_list>>::type;
             using metadata_count = count_type<::rttr::detail::metadata, type_list<Args...>>;
+            m_use_pool = std::is_same<first_prop_policy, as_pooled>::value;
             m_ctor = create_constructor_wrapper<first_prop_policy>(std::move(get_metadata(std::forward<Args>(args)...)),
                                                                    std::move(get_default_args<type_list<Ctor_Args...>>(std::forward<Args>(args)...)),
                                                                    std::move(create_param_infos<type_list<Ctor_Args...>>(std::forward<Args>(args)...)));
@@ -202,6 +207,7 @@ class registration::bind<detail::ctor, Class_Type, acc_level, Ctor_Args...> : pu
     private:
         std::shared_ptr<detail::registration_executer> m_reg_exec;
         std::unique_ptr<detail::constructor_wrapper_base> m_ctor;
+        bool m_use_pool;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,281 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/type/clone_plan.h"
+
+#include "rttr/property.h"
+#include "rttr/constructor.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/constructor/constructor_wrapper_base.h"
+#include "rttr/detail/type/type_database_p.h"
+
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the default constructor, which creates a value of the wrapper type \p t; e.g. a `std::shared_ptr<T>`.
+static const constructor_wrapper_base* get_shared_constructor(const type& t)
+{
+    if (!t.is_wrapper() || !t.get_wrapped_type().is_pointer())
+        return nullptr;
+
+    const type pointee_type = t.get_wrapped_type().get_raw_type();
+    if (!pointee_type.is_class())
+        return nullptr;
+
+    for (const auto& ctor : pointee_type.get_constructors())
+    {
+        if (ctor.get_instanciated_type() == t && ctor.get_parameter_infos().empty())
+            return get_wrapper(ctor);
+    }
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the object, which is held by the pointer or wrapper, that \p object refers to; or \p object itself.
+static instance get_object_instance(const instance& object)
+{
+    instance wrapped = object.get_wrapped_instance();
+    return (wrapped.is_valid() ? wrapped : object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+clone_plan::clone_plan(const type& t)
+:   m_type(t)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void clone_plan::compile()
+{
+    for (const auto& prop : m_type.get_properties())
+    {
+        if (prop.is_static() || prop.is_readonly())
+            continue;
+
+        const type value_type = prop.get_type();
+        clone_field field = {get_wrapper(prop), value_type, clone_value_kind::VALUE, nullptr, nullptr};
+        if (value_type.is_class() && !value_type.is_wrapper() && !value_type.is_array() && !value_type.get_properties().empty())
+        {
+            field.m_kind = clone_value_kind::OBJECT;
+            field.m_plan = &get(value_type);
+        }
+        else if ((field.m_constructor = get_shared_constructor(value_type)))
+        {
+            field.m_kind = clone_value_kind::SHARED_POINTER;
+            field.m_plan = &get(value_type.get_wrapped_type().get_raw_type());
+        }
+        else if (value_type.is_array())
+        {
+            const type element_type = type_database::instance().get_array_element_type(value_type);
+            if ((field.m_constructor = get_shared_constructor(element_type)))
+            {
+                field.m_kind = clone_value_kind::SHARED_ARRAY;
+                field.m_plan = &get(element_type.get_wrapped_type().get_raw_type());
+            }
+        }
+
+        m_fields.push_back(field);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const clone_plan& clone_plan::get(const type& t)
+{
+    return plan_cache<clone_plan>::get(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type clone_plan::get_type() const
+{
+    return m_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<clone_field>& clone_plan::get_fields() const
+{
+    return m_fields;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_cloner::object_cloner(clone_mode mode)
+:   m_mode(mode)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_cloner::clone_object(const instance& source_object, const instance& target_object, const clone_plan& plan)
+{
+    instance source = get_object_instance(source_object);
+    instance target = get_object_instance(target_object);
+    if (get_object_address(source) == get_object_address(target))
+        return true;
+
+    return clone_members(source, target, plan);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_cloner::clone_members(instance& source, instance& target, const clone_plan& plan)
+{
+    for (const auto& field : plan.get_fields())
+    {
+        if (!copy_field(source, target, field))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_cloner::copy_field(instance& source, instance& target, const clone_field& field)
+{
+    switch (field.m_kind)
+    {
+        case clone_value_kind::VALUE:
+        {
+            break;
+        }
+        case clone_value_kind::OBJECT:
+        {
+            // members without an address are accessed via getter and setter functions; these are copied via a variant
+            void* target_address = field.m_wrapper->get_value_address(target);
+            void* source_address = target_address ? field.m_wrapper->get_value_address(source) : nullptr;
+            if (!source_address)
+                break;
+
+            instance source_member = create_instance(source_address, field.m_type);
+            instance target_member = create_instance(target_address, field.m_type);
+            return clone_members(source_member, target_member, *field.m_plan);
+        }
+        case clone_value_kind::SHARED_POINTER:
+        {
+            if (m_mode != clone_mode::clone_shared_pointees)
+                break;
+
+            variant value = field.m_wrapper->get_value(source);
+            if (!value.is_valid())
+                return false;
+
+            variant clone = clone_pointee(value, field.m_constructor, *field.m_plan);
+            argument arg(clone);
+            return field.m_wrapper->set_value(target, arg);
+        }
+        case clone_value_kind::SHARED_ARRAY:
+        {
+            if (m_mode != clone_mode::clone_shared_pointees || !field.m_wrapper->get_value_address(target))
+                break;
+
+            return copy_array(field.m_wrapper->get_ref(source), field.m_wrapper->get_ref(target), field);
+        }
+    }
+
+    // arithmetic values, strings, arrays and all other members are assigned directly, with the copy assignment of their type
+    if (field.m_wrapper->copy_value(source, target))
+        return true;
+
+    variant value = field.m_wrapper->get_value(source);
+    if (!value.is_valid())
+        return false;
+
+    argument arg(value);
+    return field.m_wrapper->set_value(target, arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_cloner::copy_array(const variant_ref& source, const variant_ref& target, const clone_field& field)
+{
+    const variant_array_view source_view = source.create_array_view();
+    variant_array_view target_view = target.create_array_view();
+    const std::size_t size = source_view.get_size();
+    if (target_view.is_dynamic() ? !target_view.set_size(size) : (target_view.get_size() != size))
+        return false;
+
+    auto target_itr = target_view.begin();
+    for (auto itr = source_view.begin(), end = source_view.end(); itr != end; ++itr, ++target_itr)
+    {
+        if (!target_view.set_value(target_itr, clone_pointee((*itr).to_variant(), field.m_constructor, *field.m_plan)))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant object_cloner::clone_pointee(const variant& value, const constructor_wrapper_base* constructor, const clone_plan& plan)
+{
+    variant holder = value;
+    const instance source = instance(holder).get_wrapped_instance();
+    const void* address = get_object_address(source);
+    // only an object of exactly the pointed-to class can be cloned by the constructor
+    if (!address || source.get_derived_type() != plan.get_type())
+        return value;
+
+    auto itr = m_clones.find(address);
+    if (itr != m_clones.end())
+        return itr->second;
+
+    variant clone = constructor->invoke();
+    if (!clone.is_valid())
+        return value;
+
+    // recorded before the members are cloned, so a cycle refers back to this clone
+    m_clones.emplace(address, clone);
+    if (!clone_object(source, instance(clone), plan))
+        return value;
+
+    return clone;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
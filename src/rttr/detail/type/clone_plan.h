@@ -0,0 +1,149 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_CLONE_PLAN_H_
+#define RTTR_CLONE_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/detail/misc/plan_cache.h"
+#include "rttr/instance.h"
+#include "rttr/clone_mode.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+class property_wrapper_base;
+class constructor_wrapper_base;
+class clone_plan;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Describes how a property value is copied by \ref type::clone_into().
+ */
+enum class clone_value_kind : uint8_t
+{
+    VALUE,          //!< assigned with the copy assignment of its type; via a \ref variant, when it has no address
+    OBJECT,         //!< a class with registered properties; copied property by property, following its \ref clone_plan
+    SHARED_POINTER, //!< a wrapper of a pointer to a class, which has a default constructor returning this wrapper
+    SHARED_ARRAY    //!< an array of SHARED_POINTER values
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One copied property of a \ref clone_plan.
+ */
+struct clone_field
+{
+    const property_wrapper_base*    m_wrapper;
+    type                            m_type;
+    clone_value_kind                m_kind;
+    const clone_plan*               m_plan;         //!< the plan of an OBJECT value, or of the class, a SHARED_POINTER points to
+    const constructor_wrapper_base* m_constructor;  //!< creates the clone of a SHARED_POINTER
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The precompiled description of how the objects of one class are copied.
+ *
+ * The plan contains the non-static, writable properties of the class in the order of \ref type::get_properties(),
+ * together with the way, how every value is copied. A plan is compiled once per type, on first use;
+ * it is never invalidated.
+ */
+class clone_plan
+{
+    public:
+        /*!
+         * Returns the plan for the class \p t. This function is thread safe.
+         */
+        static const clone_plan& get(const type& t);
+
+        type get_type() const;
+
+        const std::vector<clone_field>& get_fields() const;
+
+    private:
+        explicit clone_plan(const type& t);
+
+        //! The fields are compiled after the plan is stored, so a class can refer to itself via a shared pointer.
+        void compile();
+
+        friend class plan_cache<clone_plan>;
+
+    private:
+        type                        m_type;
+        std::vector<clone_field>    m_fields;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Copies the properties of one object into another one, following the \ref clone_plan of their class.
+ *
+ * In the mode \ref clone_mode::clone_shared_pointees, the objects, which were cloned so far, are recorded
+ * by their address; so an object, which is referenced more than once, is cloned only once.
+ */
+class object_cloner
+{
+    public:
+        explicit object_cloner(clone_mode mode);
+
+        //! Clones \p source into \p target; both may refer to their object also via a pointer or a wrapper.
+        bool clone_object(const instance& source, const instance& target, const clone_plan& plan);
+
+    private:
+        bool clone_members(instance& source, instance& target, const clone_plan& plan);
+        bool copy_field(instance& source, instance& target, const clone_field& field);
+        //! Clones the shared pointers in the array \p source into \p target.
+        bool copy_array(const variant_ref& source, const variant_ref& target, const clone_field& field);
+
+        //! Returns the clone of the object, which is referenced by the shared pointer \p value;
+        //! or \p value itself, when the object cannot be cloned.
+        variant clone_pointee(const variant& value, const constructor_wrapper_base* constructor, const clone_plan& plan);
+
+    private:
+        clone_mode                                  m_mode;
+        std::unordered_map<const void*, variant>    m_clones;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CLONE_PLAN_H_
@@ -0,0 +1,144 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/type/compare_plan.h"
+
+#include "rttr/property.h"
+#include "rttr/object_compare.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+compare_plan::compare_plan(const type& t)
+:   m_type(t)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void compare_plan::compile()
+{
+    for (const auto& prop : m_type.get_properties())
+    {
+        if (prop.is_static() || prop.get_metadata(compare_metadata::exclude).to_bool())
+            continue;
+
+        const type value_type = prop.get_type();
+        const compare_value_kind kind = get_kind(value_type);
+        const compare_plan* plan = (kind == compare_value_kind::OBJECT) ? &get(value_type) : nullptr;
+        const std::size_t size   = (kind == compare_value_kind::TRIVIAL) ? value_type.get_sizeof() : 0;
+        m_fields.push_back({get_wrapper(prop), value_type, kind, size, plan});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const compare_plan& compare_plan::get(const type& t)
+{
+    return plan_cache<compare_plan>::get(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+compare_value_kind compare_plan::get_kind(const type& t)
+{
+    if (t.is_arithmetic() || t.is_enumeration())
+        return compare_value_kind::TRIVIAL;
+    else if (t == type::get<std::string>())
+        return compare_value_kind::STRING;
+    else if (t.is_array())
+        return compare_value_kind::ARRAY;
+    else if (t.is_class() && !t.is_wrapper() && !t.get_properties().empty())
+        return compare_value_kind::OBJECT;
+    else
+        return compare_value_kind::VALUE;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type compare_plan::get_type() const
+{
+    return m_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<compare_field>& compare_plan::get_fields() const
+{
+    return m_fields;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<compare_step>& compare_plan::get_steps(instance& object) const
+{
+    std::call_once(m_steps_flag, [&]() { compile_steps(object); });
+    return m_steps;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void compare_plan::compile_steps(instance& object) const
+{
+    // the distance between the members of one object is the same for all objects of the class,
+    // so a run, which is found in this object, can be compared as a whole in every other object
+    const char* run_end = nullptr;
+    for (const auto& field : m_fields)
+    {
+        const char* address = nullptr;
+        if (field.m_kind == compare_value_kind::TRIVIAL)
+            address = static_cast<const char*>(field.m_wrapper->get_value_address(object));
+
+        if (!address)
+        {
+            m_steps.push_back({&field, 0});
+            run_end = nullptr;
+            continue;
+        }
+
+        if (address == run_end)
+            m_steps.back().m_run_size += field.m_size;
+        else
+            m_steps.push_back({&field, field.m_size});
+
+        run_end = address + field.m_size;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
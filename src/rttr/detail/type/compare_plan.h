@@ -0,0 +1,164 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_COMPARE_PLAN_H_
+#define RTTR_COMPARE_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/detail/misc/plan_cache.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+class property_wrapper_base;
+class compare_plan;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Describes how a value is hashed and compared by \ref hash_value() and \ref equals().
+ */
+enum class compare_value_kind : uint8_t
+{
+    TRIVIAL,    //!< arithmetic types and enumerations; the bytes of the value
+    STRING,     //!< std::string; the characters
+    ARRAY,      //!< the size followed by the elements
+    OBJECT,     //!< a class with registered properties; the properties in the order of its \ref compare_plan
+    VALUE       //!< all other values; with the registered hasher and comparator of the type
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One compared property of a \ref compare_plan.
+ */
+struct compare_field
+{
+    const property_wrapper_base*    m_wrapper;
+    type                            m_type;
+    compare_value_kind              m_kind;
+    std::size_t                     m_size;         //!< the size in bytes of a TRIVIAL value
+    const compare_plan*             m_plan;         //!< the plan of an OBJECT value
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One step of a \ref compare_plan; either a single field, or a run of TRIVIAL fields,
+ * which are stored without any gap after each other in the object.
+ */
+struct compare_step
+{
+    const compare_field*            m_field;        //!< the field; for a run the first field, its address is the start of the run
+    std::size_t                     m_run_size;     //!< the size in bytes of a run; zero for a single field
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The precompiled description of how the objects of one class are hashed and compared.
+ *
+ * The plan contains the non-static properties of the class, which are not excluded by \ref compare_metadata::exclude,
+ * in the order of \ref type::get_properties(). The plans of nested class members are resolved in advance.
+ *
+ * The layout of the members is not known before an object is available; so the fields are grouped into steps,
+ * when the plan is used for the first time. A plan is compiled once per type; it is never invalidated.
+ */
+class compare_plan
+{
+    public:
+        /*!
+         * Returns the plan for the class \p t. This function is thread safe.
+         */
+        static const compare_plan& get(const type& t);
+
+        /*!
+         * Returns the way, how a value of type \p t is hashed and compared.
+         */
+        static compare_value_kind get_kind(const type& t);
+
+        type get_type() const;
+
+        const std::vector<compare_field>& get_fields() const;
+
+        /*!
+         * Returns the steps, in which the fields are processed; \p object is used to determine the layout
+         * of the members, when the plan is used for the first time. This function is thread safe.
+         */
+        const std::vector<compare_step>& get_steps(instance& object) const;
+
+    private:
+        explicit compare_plan(const type& t);
+
+        //! The fields are compiled after the plan is stored in the \ref plan_cache.
+        void compile();
+
+        friend class plan_cache<compare_plan>;
+
+        void compile_steps(instance& object) const;
+
+    private:
+        type                                m_type;
+        std::vector<compare_field>          m_fields;
+        mutable std::vector<compare_step>   m_steps;
+        mutable std::once_flag              m_steps_flag;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Compares the \p size bytes of \p lhs and \p rhs; the sizes of the arithmetic types are compared without a call of `memcmp`.
+ */
+RTTR_INLINE bool trivial_equal(const void* lhs, const void* rhs, std::size_t size)
+{
+    switch (size)
+    {
+        case 1: return (*static_cast<const uint8_t*>(lhs) == *static_cast<const uint8_t*>(rhs));
+        case 2: { uint16_t a, b; std::memcpy(&a, lhs, 2); std::memcpy(&b, rhs, 2); return (a == b); }
+        case 4: { uint32_t a, b; std::memcpy(&a, lhs, 4); std::memcpy(&b, rhs, 4); return (a == b); }
+        case 8: { uint64_t a, b; std::memcpy(&a, lhs, 8); std::memcpy(&b, rhs, 8); return (a == b); }
+        default: return (std::memcmp(lhs, rhs, size) == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_COMPARE_PLAN_H_
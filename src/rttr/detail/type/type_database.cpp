@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <limits>
 
 using namespace std;
 
@@ -65,9 +66,12 @@ type_database::type_database()
 
     m_raw_type_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
     m_array_raw_type_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
+    m_array_element_type_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
     m_variant_create_func_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
 
     m_type_size.reserve(RTTR_DEFAULT_TYPE_COUNT);
+    m_type_alignment.reserve(RTTR_DEFAULT_TYPE_COUNT);
+    m_type_allocator.reserve(RTTR_DEFAULT_TYPE_COUNT);
     m_type_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
 
     m_is_class_list.reserve(RTTR_DEFAULT_TYPE_COUNT);
@@ -95,9 +99,12 @@ type_database::type_database()
     m_raw_type_list.push_back(0);
     m_wrapped_type_list.push_back(0);
     m_array_raw_type_list.push_back(0);
+    m_array_element_type_list.push_back(0);
     m_variant_create_func_list.push_back(nullptr);
 
     m_type_size.push_back(0);
+    m_type_alignment.push_back(0);
+    m_type_allocator.push_back(nullptr);
     m_type_list.push_back(0);
 
     m_is_class_list.push_back(false);
@@ -603,6 +610,19 @@ void type_database::register_destructor(const type& t, std::unique_ptr<destructo
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_database::register_object_pool(const type& t)
+{
+    // an allocator, which was set by the user, is not replaced
+    if (t.get_allocator() || m_type_object_pool_map.find(t) != m_type_object_pool_map.end())
+        return;
+
+    auto pool = detail::make_unique<object_pool>(t.get_sizeof(), t.get_alignof());
+    t.set_allocator(pool.get());
+    m_type_object_pool_map.insert(std::make_pair(t, std::move(pool)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 destructor type_database::get_destructor(const type& t) const
 {
     auto ret = m_type_dtor_map.find(t);
@@ -671,26 +691,45 @@ void type_database::register_metadata(const type& t, std::vector<metadata> data)
 
     if (!meta_vec)
     {
-        auto new_meta_vec = detail::make_unique<std::vector<metadata>>(data.cbegin(), data.cend());
+        auto new_meta_vec = detail::make_unique<std::vector<metadata>>();
         meta_vec = new_meta_vec.get();
         register_item_type(t, std::move(new_meta_vec), m_metadata_type_list);
     }
 
-    auto meta_vec_ref = *meta_vec;
+    auto& meta_vec_ref = *meta_vec;
 
     // when we insert new items, we want to check first whether a item with same key exist => ignore this data
     for (auto& new_item : data)
     {
-        if (get_metadata(new_item,  meta_vec_ref).is_valid() == false)
-            meta_vec_ref.emplace_back(std::move(new_item));
+        if (get_metadata(new_item.get_key_id(), meta_vec_ref).is_valid() == false)
+        {
+            auto itr = std::upper_bound(meta_vec_ref.begin(), meta_vec_ref.end(), new_item, metadata::order_by_key_id());
+            meta_vec_ref.insert(itr, std::move(new_item));
+        }
     }
-
-    std::sort(meta_vec_ref.begin(), meta_vec_ref.end(), metadata::order_by_key());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant type_database::get_metadata(const type& t, const variant& key) const
+{
+    auto meta_vec = get_metadata_list(t);
+    if (!meta_vec)
+        return variant();
+
+    // the list is ordered by the interned key id, so here we have to compare every key
+    for (const auto& item : *meta_vec)
+    {
+        if (item.get_key() == key)
+            return item.get_value();
+    }
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type_database::get_metadata(const type& t, const metadata_key& key) const
 {
     auto meta_vec = get_metadata_list(t);
     return (meta_vec ? get_metadata(key, *meta_vec) : variant());
@@ -698,13 +737,13 @@ variant type_database::get_metadata(const type& t, const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant type_database::get_metadata(const variant& key, const std::vector<metadata>& data) const
+variant type_database::get_metadata(const metadata_key& key, const std::vector<metadata>& data) const
 {
-    auto itr = std::lower_bound(data.cbegin(), data.cend(), key, metadata::order_by_key());
+    auto itr = std::lower_bound(data.cbegin(), data.cend(), key, metadata::order_by_key_id());
     if (itr != data.cend())
     {
         auto& item = *itr;
-        if (item.get_key() == key)
+        if (item.get_key_id() == key)
             return item.get_value();
     }
 
@@ -784,6 +823,33 @@ const type_comparator_base* type_database::get_comparator(const type& t) const
         return nullptr;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_database::register_hasher(const type& t, const type_hasher_base* hasher)
+{
+    if (!t.is_valid())
+        return;
+
+    using data_type = type_data<const type_hasher_base*>;
+    m_type_hasher_list.push_back({t.get_id(), hasher});
+    std::stable_sort(m_type_hasher_list.begin(), m_type_hasher_list.end(),
+                     data_type::order_by_id());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const type_hasher_base* type_database::get_hasher(const type& t) const
+{
+    using vec_value_type = type_data<const type_hasher_base*>;
+    const auto id = t.get_id();
+    auto itr = std::lower_bound(m_type_hasher_list.cbegin(), m_type_hasher_list.cend(), id,
+                                vec_value_type::order_by_id());
+    if (itr != m_type_hasher_list.cend() && itr->m_id == id)
+        return itr->m_data;
+    else
+        return nullptr;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -997,10 +1063,12 @@ uint16_t type_database::register_type(string_view name,
                                       const type& raw_type,
                                       const type& wrapped_type,
                                       const type& array_raw_type,
+                                      const type& array_element_type,
                                       vector<base_class_info> base_classes,
                                       get_derived_func derived_func_ptr,
                                       variant_create_func var_func_ptr,
                                       std::size_t type_size,
+                                      std::size_t type_alignment,
                                       bool is_class,
                                       bool is_enum,
                                       bool is_array,
@@ -1027,11 +1095,14 @@ uint16_t type_database::register_type(string_view name,
     m_wrapped_type_list.push_back(wrapped_type.get_id());
 
     m_array_raw_type_list.push_back(array_raw_type.get_id() == 0 ? id : array_raw_type.get_id());
+    m_array_element_type_list.push_back(array_element_type.get_id());
     m_get_derived_info_func_list.resize(std::max(m_get_derived_info_func_list.size(), static_cast<std::size_t>(raw_id + 1)));
     m_get_derived_info_func_list[raw_id]  = derived_func_ptr;
     m_variant_create_func_list.push_back(var_func_ptr);
 
     m_type_size.push_back(type_size);
+    m_type_alignment.push_back(type_alignment);
+    m_type_allocator.push_back(nullptr);
 
     m_is_class_list.push_back(is_class);
     m_is_enum_list.push_back(is_enum);
@@ -1062,5 +1133,142 @@ uint16_t type_database::get_by_name(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+type type_database::get_array_element_type(const type& t) const
+{
+    if (!t.is_valid() || m_array_element_type_list[t.get_id()] == type::m_invalid_id)
+        return type();
+
+    return type(m_array_element_type_list[t.get_id()]);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! FNV-1a with 64 bit; the bytes of integers are added in a fixed order, so the result does not depend on the byte order.
+struct fingerprint_builder
+{
+    uint64_t m_hash = 0xcbf29ce484222325ull;
+
+    void add_byte(unsigned char byte)
+    {
+        m_hash = (m_hash ^ byte) * 0x100000001b3ull;
+    }
+
+    void add(uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+            add_byte(static_cast<unsigned char>(value >> (i * 8)));
+    }
+
+    void add(string_view text)
+    {
+        add(static_cast<uint64_t>(text.size()));
+        for (const char c : text)
+            add_byte(static_cast<unsigned char>(c));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t type_database::get_fingerprint(const type& t)
+{
+    if (!t.is_valid())
+        return 0;
+
+    std::lock_guard<std::mutex> lock(m_fingerprint_mutex);
+    std::vector<type::type_id> stack;
+    std::size_t lowest_reference = std::numeric_limits<std::size_t>::max();
+    return compute_fingerprint(t, stack, lowest_reference);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A type, which is reached again while its own fingerprint is computed (e.g. `struct node { std::vector<node> children; }`),
+ * is added as reference to its position on the \p stack. Fingerprints, which depend on such a reference, are only valid
+ * in the context of the outer type; so they are not cached and \p lowest_reference is set to the referenced position.
+ */
+uint64_t type_database::compute_fingerprint(const type& t, std::vector<type::type_id>& stack, std::size_t& lowest_reference)
+{
+    auto found = m_fingerprint_cache.find(t.get_id());
+    if (found != m_fingerprint_cache.end())
+        return found->second;
+
+    fingerprint_builder builder;
+    for (std::size_t i = 0; i < stack.size(); ++i)
+    {
+        if (stack[i] == t.get_id())
+        {
+            lowest_reference = std::min(lowest_reference, i);
+            builder.add('@');
+            builder.add(static_cast<uint64_t>(stack.size() - i));
+            return builder.m_hash;
+        }
+    }
+
+    const std::size_t position = stack.size();
+    std::size_t own_reference = std::numeric_limits<std::size_t>::max();
+    stack.push_back(t.get_id());
+
+    const type::type_id id = t.get_id();
+    if (m_is_pointer_list[id])
+    {
+        builder.add('P');
+        builder.add(static_cast<uint64_t>(m_pointer_dim_list[id]));
+        builder.add(compute_fingerprint(type(m_raw_type_list[id]), stack, own_reference));
+    }
+    else if (m_wrapped_type_list[id] != type::m_invalid_id)
+    {
+        builder.add('W');
+        builder.add(compute_fingerprint(type(m_wrapped_type_list[id]), stack, own_reference));
+    }
+    else if (m_array_element_type_list[id] != type::m_invalid_id)
+    {
+        builder.add('R');
+        builder.add(compute_fingerprint(type(m_array_element_type_list[id]), stack, own_reference));
+    }
+    else if (m_is_enum_list[id] && get_enumeration(t))
+    {
+        const enumeration enum_type = t.get_enumeration();
+        builder.add('E');
+        builder.add(compute_fingerprint(enum_type.get_underlying_type(), stack, own_reference));
+        for (const auto& name : enum_type.get_names())
+        {
+            builder.add(name);
+            builder.add(static_cast<uint64_t>(enum_type.name_to_value(name).to_int64()));
+        }
+    }
+    else if (m_is_class_list[id] && (!t.get_properties().empty() || !t.get_base_classes().empty()))
+    {
+        builder.add('C');
+        for (const auto& base : t.get_base_classes())
+            builder.add(compute_fingerprint(base, stack, own_reference));
+
+        for (const auto& prop : t.get_properties())
+        {
+            if (prop.is_static())
+                continue;
+
+            builder.add(prop.get_name());
+            builder.add(compute_fingerprint(prop.get_type(), stack, own_reference));
+        }
+    }
+    else
+    {
+        builder.add('N');
+        builder.add(t.get_name());
+    }
+
+    stack.pop_back();
+
+    if (own_reference >= position)
+        m_fingerprint_cache[id] = builder.m_hash;
+    else
+        lowest_reference = std::min(lowest_reference, own_reference);
+
+    return builder.m_hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
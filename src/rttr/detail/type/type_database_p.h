@@ -35,6 +35,7 @@
 #include "rttr/constructor.h"
 #include "rttr/destructor.h"
 #include "rttr/enumeration.h"
+#include "rttr/object_pool.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
 
@@ -46,6 +47,7 @@
 #include <memory>
 #include <functional>
 #include <unordered_map>
+#include <mutex>
 
 #define RTTR_MAX_TYPE_COUNT 32767
 #define RTTR_MAX_INHERIT_TYPES_COUNT 50
@@ -58,6 +60,7 @@ namespace detail
 {
 
 struct type_comparator_base;
+struct type_hasher_base;
 
 /*!
  * This class holds all type information.
@@ -77,20 +80,24 @@ class RTTR_LOCAL type_database
         void register_method(const type& t, std::unique_ptr<method_wrapper_base> meth);
         void register_constructor(const type& t, std::unique_ptr<constructor_wrapper_base> ctor);
         void register_destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor);
+        void register_object_pool(const type& t);
         void register_enumeration(const type& t, std::unique_ptr<enumeration_wrapper_base> enum_data);
         void register_custom_name(const type& t, string_view name );
         void register_metadata( const type& t, std::vector<metadata> data);
         void register_converter(const type& t, std::unique_ptr<type_converter_base> converter);
         void register_comparator(const type& t, const type_comparator_base* comparator);
+        void register_hasher(const type& t, const type_hasher_base* hasher);
 
         uint16_t register_type(string_view name,
                                const type& raw_type,
                                const type& wrapped_type,
                                const type& array_raw_type,
+                               const type& array_element_type,
                                std::vector<base_class_info> base_classes,
                                get_derived_func derived_func_ptr,
                                variant_create_func var_func_ptr,
                                std::size_t type_size,
+                               std::size_t type_alignment,
                                bool is_class,
                                bool is_enum,
                                bool is_array,
@@ -151,7 +158,12 @@ class RTTR_LOCAL type_database
 
         /////////////////////////////////////////////////////////////////////////////////////
 
+        const type_hasher_base* get_hasher(const type& t) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////
+
         variant get_metadata(const type& t, const variant& key) const;
+        variant get_metadata(const type& t, const metadata_key& key) const;
 
         /////////////////////////////////////////////////////////////////////////////////////
 
@@ -159,6 +171,13 @@ class RTTR_LOCAL type_database
 
         /////////////////////////////////////////////////////////////////////////////////////
 
+        uint64_t get_fingerprint(const type& t);
+
+        //! Returns the type of the elements of the array type \p t; an invalid type, when \p t is no array.
+        type get_array_element_type(const type& t) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////
+
     private:
         type_database();
         ~type_database();
@@ -169,7 +188,8 @@ class RTTR_LOCAL type_database
         bool register_name(string_view name, const type& array_raw_type, uint16_t& id);
         void register_base_class_info(const type& src_type, const type& raw_type, std::vector<base_class_info> base_classes);
         std::vector<metadata>* get_metadata_list(const type& t) const;
-        variant get_metadata(const variant& key, const std::vector<metadata>& data) const;
+        variant get_metadata(const metadata_key& key, const std::vector<metadata>& data) const;
+        uint64_t compute_fingerprint(const type& t, std::vector<type::type_id>& stack, std::size_t& lowest_reference);
 
         using hash_type = std::size_t;
         RTTR_INLINE static hash_type generate_hash(const std::string& text) { return generate_hash(text.c_str()); }
@@ -244,9 +264,12 @@ class RTTR_LOCAL type_database
         std::vector<type::type_id>                                  m_raw_type_list;
         std::vector<type::type_id>                                  m_wrapped_type_list;
         std::vector<type::type_id>                                  m_array_raw_type_list;
+        std::vector<type::type_id>                                  m_array_element_type_list;
         std::vector<variant_create_func>                            m_variant_create_func_list; //!< This list contains a function to create from an 'argument' a variant
 
         std::vector<std::size_t>                                    m_type_size;
+        std::vector<std::size_t>                                    m_type_alignment;
+        std::vector<object_allocator*>                              m_type_allocator;
 
         std::vector<bool>                                           m_is_class_list;
         std::vector<bool>                                           m_is_enum_list;
@@ -270,11 +293,16 @@ class RTTR_LOCAL type_database
         std::unordered_map<type, std::vector<method>>               m_class_method_map;
         std::unordered_map<type, std::vector<constructor>>          m_type_ctor_map;
         std::unordered_map<type, destructor>                        m_type_dtor_map;
+        std::unordered_map<type, std::unique_ptr<object_pool>>      m_type_object_pool_map; //!< The pools of the constructors with the policy 'as_pooled'
 
         std::vector<type_data<type_converter_base>>                 m_type_converter_list;  //!< This list stores all type conversion objects
         std::vector<type_data<const type_comparator_base*>>         m_type_comparator_list;
+        std::vector<type_data<const type_hasher_base*>>             m_type_hasher_list;
         std::vector<type_data<enumeration_wrapper_base>>            m_enumeration_list;
         std::vector<type_data<std::vector<metadata>>>               m_metadata_type_list;
+
+        std::mutex                                                  m_fingerprint_mutex;
+        std::unordered_map<type::type_id, uint64_t>                 m_fingerprint_cache;    //!< Only fingerprints, which do not refer to an outer type
 };
 
 } // end namespace detail
@@ -38,6 +38,7 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/wrapper_mapper.h"
 #include "rttr/detail/type/type_comparator.h"
+#include "rttr/detail/type/type_hasher.h"
 
 namespace rttr
 {
@@ -253,6 +254,22 @@ struct array_raw_type<T, false>
     static RTTR_INLINE type get_type() { return type::get<typename raw_array_type<T>::type>(); }
 };
 
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, bool = is_array<T>::value>
+struct array_element_type
+{
+    static RTTR_INLINE type get_type() { return get_invalid_type(); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct array_element_type<T, true>
+{
+    static RTTR_INLINE type get_type() { return type::get<typename array_mapper<remove_cv_t<remove_reference_t<T>>>::sub_type>(); }
+};
+
 /////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
@@ -270,10 +287,12 @@ struct type_getter
                                                         raw_type_info<T>::get_type(),
                                                         wrapper_type_info<T>::get_type(),
                                                         array_raw_type<T>::get_type(),
+                                                        array_element_type<T>::get_type(),
                                                         std::move(base_classes<T>::get_types()),
                                                         get_most_derived_info_func<T>(),
                                                         &create_variant_func<T>::create_variant,
                                                         sizeof(T),
+                                                        alignof(T),
                                                         std::is_class<T>::value,
                                                         std::is_enum<T>::value,
                                                         is_array<T>::value,
@@ -302,10 +321,12 @@ struct type_getter<void>
                                                         raw_type_info<void>::get_type(),
                                                         wrapper_type_info<void>::get_type(),
                                                         array_raw_type<void>::get_type(),
+                                                        array_element_type<void>::get_type(),
                                                         std::vector<base_class_info>(),
                                                         get_most_derived_info_func<void>(),
                                                         nullptr,
                                                         0,
+                                                        0,
                                                         false,
                                                         false,
                                                         false,
@@ -334,10 +355,12 @@ struct type_getter<T, typename std::enable_if<std::is_function<T>::value>::type>
                                                         raw_type_info<T>::get_type(),
                                                         wrapper_type_info<T>::get_type(),
                                                         array_raw_type<T>::get_type(),
+                                                        array_element_type<T>::get_type(),
                                                         std::vector<detail::base_class_info>(),
                                                         get_most_derived_info_func<T>(),
                                                         &create_variant_func<T>::create_variant,
                                                         0,
+                                                        0,
                                                         std::is_class<T>::value,
                                                         std::is_enum<T>::value,
                                                         is_array<T>::value,
@@ -458,6 +481,15 @@ void type::register_comparators()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+void type::register_hasher()
+{
+    static detail::type_hasher<T> hasher;
+    detail::type_register::hasher(type::get<T>(), &hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 
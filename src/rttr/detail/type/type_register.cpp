@@ -72,6 +72,13 @@ void type_register::destructor(const type& t, std::unique_ptr<detail::destructor
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register::object_pool(const type& t)
+{
+    type_database::instance().register_object_pool(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register::enumeration(const type& t, std::unique_ptr<detail::enumeration_wrapper_base> enum_item)
 {
     type_database::instance().register_enumeration(t, move(enum_item));
@@ -107,14 +114,23 @@ void type_register::comparator(const type& t, type_comparator_base* comparator)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register::hasher(const type& t, type_hasher_base* hasher)
+{
+    type_database::instance().register_hasher(t, hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 uint16_t type_register::type_reg(string_view name,
                                  const type& raw_type,
                                  const type& wrapped_type,
                                  const type& array_raw_type,
+                                 const type& array_element_type,
                                  vector<base_class_info> base_classes,
                                  get_derived_func derived_func_ptr,
                                  variant_create_func var_func_ptr,
                                  std::size_t type_size,
+                                 std::size_t type_alignment,
                                  bool is_class,
                                  bool is_enum,
                                  bool is_array,
@@ -125,9 +141,9 @@ uint16_t type_register::type_reg(string_view name,
                                  bool is_member_function_pointer,
                                  std::size_t pointer_dimension)
 {
-    return type_database::instance().register_type(name, raw_type, wrapped_type, array_raw_type, move(base_classes),
+    return type_database::instance().register_type(name, raw_type, wrapped_type, array_raw_type, array_element_type, move(base_classes),
                                                    derived_func_ptr, var_func_ptr,
-                                                   type_size,
+                                                   type_size, type_alignment,
                                                    is_class, is_enum, is_array, is_pointer, is_arithmetic,
                                                    is_function_pointer, is_member_object_pointer, is_member_function_pointer, pointer_dimension);
 }
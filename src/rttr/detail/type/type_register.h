@@ -56,6 +56,7 @@ class property_wrapper_base;
 
 struct type_converter_base;
 struct type_comparator_base;
+struct type_hasher_base;
 struct base_class_info;
 struct derived_info;
 
@@ -87,6 +88,9 @@ public:
 
     static void destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor);
 
+    //! Creates an \ref object_pool for \p t and sets it as allocator, when no allocator is set yet.
+    static void object_pool(const type& t);
+
     static void enumeration(const type& t, std::unique_ptr<enumeration_wrapper_base> enum_data);
 
     static void custom_name(const type& t, string_view name);
@@ -97,6 +101,8 @@ public:
 
     static void comparator(const type& t, type_comparator_base* comparator);
 
+    static void hasher(const type& t, type_hasher_base* hasher);
+
     /*!
      * \brief Register the type info for the given name
      *
@@ -109,10 +115,12 @@ public:
                              const type& raw_type,
                              const type& wrapped_type,
                              const type& array_raw_type,
+                             const type& array_element_type,
                              std::vector<base_class_info> base_classes,
                              get_derived_func derived_func_ptr,
                              variant_create_func var_func_ptr,
                              std::size_t type_size,
+                             std::size_t type_alignment,
                              bool is_class,
                              bool is_enum,
                              bool is_array,
@@ -0,0 +1,179 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/variant/variant_conversion_table.h"
+
+#include "rttr/variant.h"
+#include "rttr/argument.h"
+#include "rttr/type.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+namespace
+{
+
+template<typename... T>
+struct basic_type_list {};
+
+/*!
+ * All types with a build in conversion, in the same order as in \ref basic_type_kind.
+ */
+using basic_types = basic_type_list<bool, char, int8_t, int16_t, int32_t, int64_t,
+                                    uint8_t, uint16_t, uint32_t, uint64_t,
+                                    float, double, std::string>;
+
+static const std::size_t g_kind_count = static_cast<std::size_t>(basic_type_kind::UNKNOWN);
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct variant_conversion_table::table_filler
+{
+    table_filler()
+    {
+        fill(basic_types());
+    }
+
+    template<typename... Ts>
+    void fill(basic_type_list<Ts...> list)
+    {
+        const type types[] = { type::get<Ts>()... };
+        for (std::size_t index = 0; index < sizeof...(Ts); ++index)
+        {
+            const auto id = types[index].get_id();
+            if (id >= m_kinds.size())
+                m_kinds.resize(id + 1, basic_type_kind::UNKNOWN);
+            m_kinds[id] = static_cast<basic_type_kind>(index);
+        }
+
+        std::size_t row = 0;
+        const int expand[] = { (fill_row<Ts>(m_table[row++], list), 0)... };
+        (void)expand;
+
+        const conversion_func enum_row[g_kind_count] = { &convert_enum_to_basic<Ts>..., nullptr };
+        std::copy(std::begin(enum_row), std::end(enum_row), m_table[static_cast<std::size_t>(basic_type_kind::ENUM)]);
+    }
+
+    template<typename Source, typename... Ts>
+    static void fill_row(conversion_func (&row)[g_kind_count], basic_type_list<Ts...>)
+    {
+        const conversion_func funcs[g_kind_count] = { &convert_basic<Source, Ts>..., &convert_basic_to_enum<Source> };
+        std::copy(std::begin(funcs), std::end(funcs), row);
+    }
+
+    std::vector<basic_type_kind>    m_kinds;
+    conversion_func                 m_table[g_kind_count][g_kind_count];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const variant_conversion_table::table_filler& variant_conversion_table::get_table()
+{
+    static const variant_conversion_table::table_filler table;
+    return table;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+basic_type_kind variant_conversion_table::get_kind(const type& t)
+{
+    const auto& kinds = get_table().m_kinds;
+    const auto id = t.get_id();
+    if (id < kinds.size() && kinds[id] != basic_type_kind::UNKNOWN)
+        return kinds[id];
+
+    return (t.is_enumeration() ? basic_type_kind::ENUM : basic_type_kind::UNKNOWN);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_conversion_table::conversion_func
+variant_conversion_table::get_conversion_func(basic_type_kind source, basic_type_kind target)
+{
+    if (source == basic_type_kind::UNKNOWN || target == basic_type_kind::UNKNOWN)
+        return nullptr;
+
+    return get_table().m_table[static_cast<std::size_t>(source)][static_cast<std::size_t>(target)];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source, typename Target>
+bool variant_conversion_table::convert_basic(const variant& from, const type& target_type, variant& to)
+{
+    Target value;
+    if (!convert_from<Source>::to(from.get_value<Source>(), value))
+        return false;
+
+    // 'from' and 'to' might be the same object, so assign not until the conversion is done
+    to = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source>
+bool variant_conversion_table::convert_basic_to_enum(const variant& from, const type& target_type, variant& to)
+{
+    variant var = target_type;
+    auto wrapper = std::ref(var);
+    argument arg(wrapper);
+    if (!convert_from<Source>::to_enum(from.get_value<Source>(), arg))
+        return false;
+
+    to = std::move(var);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Target>
+bool variant_conversion_table::convert_enum_to_basic(const variant& from, const type& target_type, variant& to)
+{
+    // the concrete enum type is only known to the policy of the variant
+    Target value;
+    if (!from.try_basic_type_conversion(value))
+        return false;
+
+    to = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,117 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_CONVERSION_TABLE_H_
+#define RTTR_VARIANT_CONVERSION_TABLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+
+namespace rttr
+{
+
+class variant;
+class type;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Classifies the types for which \ref variant has a build in conversion.
+ *
+ * \remark The order of the entries is the order of the rows and columns in the conversion table,
+ *         all entries before \p UNKNOWN are valid table indices.
+ */
+enum class basic_type_kind : uint8_t
+{
+    BOOL,
+    CHAR,
+    INT8,
+    INT16,
+    INT32,
+    INT64,
+    UINT8,
+    UINT16,
+    UINT32,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING,
+    ENUM,
+    UNKNOWN
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Dispatch table for the build in conversions between the basic types,
+ * indexed by the \ref basic_type_kind of the source and the target type.
+ *
+ * The table is filled once at startup, a lookup requires no type comparisons.
+ */
+struct RTTR_API variant_conversion_table
+{
+    using conversion_func = bool (*)(const variant& from, const type& target_type, variant& to);
+
+    /*!
+     * \brief Returns the \ref basic_type_kind of the given type \p t.
+     *
+     * \remark This is a lookup via the type id, enumerations are recognized via \ref type::is_enumeration().
+     */
+    static basic_type_kind get_kind(const type& t);
+
+    /*!
+     * \brief Returns the function which converts a variant of kind \p source to the kind \p target.
+     *
+     * \return When there is no build in conversion a `nullptr` is returned.
+     */
+    static conversion_func get_conversion_func(basic_type_kind source, basic_type_kind target);
+
+    private:
+        struct table_filler;
+        static const table_filler& get_table();
+
+        template<typename Source, typename Target>
+        static bool convert_basic(const variant& from, const type& target_type, variant& to);
+
+        template<typename Source>
+        static bool convert_basic_to_enum(const variant& from, const type& target_type, variant& to);
+
+        template<typename Target>
+        static bool convert_enum_to_basic(const variant& from, const type& target_type, variant& to);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_CONVERSION_TABLE_H_
@@ -31,6 +31,7 @@
 #include "rttr/detail/conversion/std_conversion_functions.h"
 #include "rttr/detail/conversion/number_conversion.h"
 #include "rttr/detail/enumeration/enumeration_helper.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
 
 namespace rttr
 {
@@ -59,38 +60,29 @@ struct default_type_converter
 {
     static bool convert_to(const T& value, argument& arg)
     {
-        const type target_type = arg.get_type();
-        bool result = false;
-        if (target_type == type::get<bool>())
-            return Type_Converter::to(value, arg.get_value<bool>());
-        else if (target_type == type::get<char>())
-            return Type_Converter::to(value, arg.get_value<char>());
-        else if (target_type == type::get<int8_t>())
-            return Type_Converter::to(value, arg.get_value<int8_t>());
-        else if (target_type == type::get<int16_t>())
-            return Type_Converter::to(value, arg.get_value<int16_t>());
-        else if (target_type == type::get<int32_t>())
-            return Type_Converter::to(value, arg.get_value<int32_t>());
-        else if (target_type == type::get<int64_t>())
-            return Type_Converter::to(value, arg.get_value<int64_t>());
-        else if (target_type == type::get<uint8_t>())
-            return Type_Converter::to(value, arg.get_value<uint8_t>());
-        else if (target_type == type::get<uint16_t>())
-            return Type_Converter::to(value, arg.get_value<uint16_t>());
-        else if (target_type == type::get<uint32_t>())
-            return Type_Converter::to(value, arg.get_value<uint32_t>());
-        else if (target_type == type::get<uint64_t>())
-            return Type_Converter::to(value, arg.get_value<uint64_t>());
-        else if (target_type == type::get<float>())
-            return Type_Converter::to(value, arg.get_value<float>());
-        else if (target_type == type::get<double>())
-            return Type_Converter::to(value, arg.get_value<double>());
-        else if (target_type == type::get<std::string>())
-            return Type_Converter::to(value, arg.get_value<std::string>());
-        else if (is_variant_with_enum(arg))
-            return Type_Converter::to_enum(value, arg);
-        else
-            return false;
+        switch (variant_conversion_table::get_kind(arg.get_type()))
+        {
+            case basic_type_kind::BOOL:     return Type_Converter::to(value, arg.get_value<bool>());
+            case basic_type_kind::CHAR:     return Type_Converter::to(value, arg.get_value<char>());
+            case basic_type_kind::INT8:     return Type_Converter::to(value, arg.get_value<int8_t>());
+            case basic_type_kind::INT16:    return Type_Converter::to(value, arg.get_value<int16_t>());
+            case basic_type_kind::INT32:    return Type_Converter::to(value, arg.get_value<int32_t>());
+            case basic_type_kind::INT64:    return Type_Converter::to(value, arg.get_value<int64_t>());
+            case basic_type_kind::UINT8:    return Type_Converter::to(value, arg.get_value<uint8_t>());
+            case basic_type_kind::UINT16:   return Type_Converter::to(value, arg.get_value<uint16_t>());
+            case basic_type_kind::UINT32:   return Type_Converter::to(value, arg.get_value<uint32_t>());
+            case basic_type_kind::UINT64:   return Type_Converter::to(value, arg.get_value<uint64_t>());
+            case basic_type_kind::FLOAT:    return Type_Converter::to(value, arg.get_value<float>());
+            case basic_type_kind::DOUBLE:   return Type_Converter::to(value, arg.get_value<double>());
+            case basic_type_kind::STRING:   return Type_Converter::to(value, arg.get_value<std::string>());
+            default:
+            {
+                if (is_variant_with_enum(arg))
+                    return Type_Converter::to_enum(value, arg);
+                else
+                    return false;
+            }
+        }
     }
 };
 
@@ -1432,7 +1424,7 @@ struct convert_from_enum
 
     static RTTR_INLINE bool to(const T& from, std::string& to)
     {
-        to = get_enumeration_name(from).to_string();
+        to = get_enumeration_string(from);
         return (to.empty() == false);
     }
 
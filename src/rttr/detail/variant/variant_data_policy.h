@@ -32,6 +32,7 @@
 #include "rttr/detail/variant/variant_data.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant_array_view/variant_array_view_creator.h"
+#include "rttr/detail/variant_associative_view/variant_associative_view_creator.h"
 #include "rttr/detail/variant/variant_data_converter.h"
 #include "rttr/detail/misc/compare_equal.h"
 #include "rttr/detail/misc/compare_less.h"
@@ -62,6 +63,9 @@ struct variant_data_policy_string;
 template<typename T>
 struct variant_data_policy_arithmetic;
 
+template<typename T, typename Converter>
+struct variant_data_policy_ref;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename T, bool Can_Place = (sizeof(T) <= sizeof(variant_data)) &&
@@ -128,11 +132,14 @@ enum class variant_policy_operation : uint8_t
     GET_ADDRESS_CONTAINER,
     IS_ARRAY,
     TO_ARRAY,
+    IS_ASSOCIATIVE_CONTAINER,
+    TO_ASSOCIATIVE_CONTAINER,
     IS_VALID,
     IS_NULLPTR,
     CONVERT,
     COMPARE_EQUAL,
-    COMPARE_LESS
+    COMPARE_LESS,
+    COPY_REFERENCED_VALUE
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -251,6 +258,15 @@ struct variant_data_base_policy
                 arg.get_value<std::unique_ptr<array_wrapper_base>&>() = create_variant_array_view(const_cast<T&>(Tp::get_value(src_data)));
                 break;
             }
+            case variant_policy_operation::IS_ASSOCIATIVE_CONTAINER:
+            {
+                return can_create_associative_view<T>::value;
+            }
+            case variant_policy_operation::TO_ASSOCIATIVE_CONTAINER:
+            {
+                arg.get_value<std::unique_ptr<associative_wrapper_base>&>() = create_variant_associative_view(const_cast<T&>(Tp::get_value(src_data)));
+                break;
+            }
             case variant_policy_operation::CONVERT:
             {
                 return Converter::convert_to(Tp::get_value(src_data), arg.get_value<argument>());
@@ -318,6 +334,10 @@ struct variant_data_base_policy
                 return (lhs.to_string() < rhs.to_string());
                 break;
             }
+            case variant_policy_operation::COPY_REFERENCED_VALUE:
+            {
+                return false;
+            }
         }
 
         return true;
@@ -549,6 +569,81 @@ struct RTTR_API variant_data_policy_string : variant_data_policy_big<std::string
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * This policy is used by \ref variant_ref, when it refers to an object which is owned by somebody else.
+ *
+ * Only the address of the referenced object is stored in \p variant_data;
+ * the object itself will never be copied or destroyed by this policy.
+ * All other operations (type queries, conversion, comparison, array access) work on the referenced object.
+ */
+template<typename T, typename Converter>
+struct variant_data_policy_ref : variant_data_base_policy<T, variant_data_policy_ref<T, Converter>, Converter>
+{
+    static bool invoke(variant_policy_operation op, const variant_data& src_data, argument_wrapper arg)
+    {
+        if (op == variant_policy_operation::COPY_REFERENCED_VALUE)
+            return copy_value(get_value(src_data), arg.get_value<variant>(), std::integral_constant<bool, std::is_copy_constructible<T>::value || std::is_array<T>::value>());
+
+        // std::move is needed, otherwise the template ctor of argument_wrapper would wrap 'arg' itself
+        return variant_data_base_policy<T, variant_data_policy_ref<T, Converter>, Converter>::invoke(op, src_data, std::move(arg));
+    }
+
+    static RTTR_INLINE bool copy_value(const T& value, variant& dest, std::true_type)
+    {
+        dest = value;
+        return true;
+    }
+
+    static RTTR_INLINE bool copy_value(const T& value, variant& dest, std::false_type)
+    {
+        // the referenced object cannot be copied, 'dest' stays invalid
+        return true;
+    }
+
+    static RTTR_INLINE const T& get_value(const variant_data& data)
+    {
+        return *reinterpret_cast<const T* const &>(data);
+    }
+
+    static RTTR_INLINE void destroy(T& value)
+    {
+    }
+
+    static RTTR_INLINE void clone(const T& value, variant_data& dest)
+    {
+        reinterpret_cast<const T*&>(dest) = &value;
+    }
+
+    static RTTR_INLINE void swap(T& value, variant_data& dest)
+    {
+        clone(value, dest);
+    }
+
+    static RTTR_INLINE void create(const T& value, variant_data& dest)
+    {
+        reinterpret_cast<const T*&>(dest) = std::addressof(value);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * This template alias will determine the reference policy for the given type \p T.
+ *
+ * The converter is the same one, which \ref variant_policy would choose for an owned value of type \p T.
+ */
+template<typename T>
+using variant_ref_policy = variant_data_policy_ref<T, conditional_t<std::is_arithmetic<T>::value || std::is_same<T, std::string>::value,
+                                                                    default_type_converter<T>,
+                                                                    conditional_t<std::is_enum<T>::value,
+                                                                                  default_type_converter<T, convert_from_enum<T>>,
+                                                                                  empty_type_converter<T>
+                                                                                 >
+                                                                   >
+                                                  >;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /*!
  * This policy is used when the variant does not contain any data. So in fact an invalid variant.
  *
@@ -609,6 +704,14 @@ struct RTTR_API variant_data_policy_empty
             {
                 break;
             }
+            case variant_policy_operation::IS_ASSOCIATIVE_CONTAINER:
+            {
+                return false;
+            }
+            case variant_policy_operation::TO_ASSOCIATIVE_CONTAINER:
+            {
+                break;
+            }
             case variant_policy_operation::IS_VALID:
             {
                 return false;
@@ -633,6 +736,10 @@ struct RTTR_API variant_data_policy_empty
             {
                 return false;
             }
+            case variant_policy_operation::COPY_REFERENCED_VALUE:
+            {
+                return false;
+            }
         }
         return true;
     }
@@ -705,6 +812,14 @@ struct RTTR_API variant_data_policy_void
             {
                 break;
             }
+            case variant_policy_operation::IS_ASSOCIATIVE_CONTAINER:
+            {
+                return false;
+            }
+            case variant_policy_operation::TO_ASSOCIATIVE_CONTAINER:
+            {
+                break;
+            }
             case variant_policy_operation::IS_NULLPTR:
             {
                 return false;
@@ -729,6 +844,10 @@ struct RTTR_API variant_data_policy_void
             {
                 return false;
             }
+            case variant_policy_operation::COPY_REFERENCED_VALUE:
+            {
+                return false;
+            }
         }
         return true;
     }
@@ -834,6 +953,14 @@ struct RTTR_API variant_data_policy_nullptr_t
             {
                 break;
             }
+            case variant_policy_operation::IS_ASSOCIATIVE_CONTAINER:
+            {
+                return false;
+            }
+            case variant_policy_operation::TO_ASSOCIATIVE_CONTAINER:
+            {
+                break;
+            }
             case variant_policy_operation::IS_VALID:
             {
                 return true;
@@ -875,6 +1002,10 @@ struct RTTR_API variant_data_policy_nullptr_t
                 const variant& rhs  = std::get<1>(param);
                 return (lhs.is_nullptr() && !rhs.is_nullptr());
             }
+            case variant_policy_operation::COPY_REFERENCED_VALUE:
+            {
+                return false;
+            }
         }
         return true;
     }
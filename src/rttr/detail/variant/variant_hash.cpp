@@ -0,0 +1,105 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/variant/variant_hash.h"
+
+#include "rttr/detail/variant/variant_numeric_key.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+#include "rttr/detail/type/type_database_p.h"
+#include "rttr/detail/type/type_hasher.h"
+#include "rttr/variant.h"
+#include "rttr/type.h"
+
+#include <functional>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+std::size_t variant_hash(const variant& var)
+{
+    if (!var.is_valid())
+        return 0;
+
+    const type t = var.get_type();
+    const basic_type_kind kind = variant_conversion_table::get_kind(t);
+
+    numeric_key key;
+    if (get_numeric_key(var, kind, key))
+        return key.hash();
+
+    if (kind == basic_type_kind::STRING)
+        return std::hash<std::string>()(var.get_value<std::string>());
+
+    if (t.is_pointer())
+        return std::hash<const void*>()(var.get_raw_ptr());
+
+    if (const auto hasher = type_database::instance().get_hasher(t))
+        return hasher->hash(var.get_ptr());
+
+    return std::hash<type>()(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_equal_as_key(const variant& lhs, const variant& rhs)
+{
+    const bool lhs_is_valid = lhs.is_valid();
+    const bool rhs_is_valid = rhs.is_valid();
+    if (!lhs_is_valid || !rhs_is_valid)
+        return (lhs_is_valid == rhs_is_valid);
+
+    const type lhs_type = lhs.get_type();
+    const type rhs_type = rhs.get_type();
+    const basic_type_kind lhs_kind = variant_conversion_table::get_kind(lhs_type);
+
+    numeric_key lhs_key;
+    numeric_key rhs_key;
+    const bool lhs_is_numeric = get_numeric_key(lhs, lhs_kind, lhs_key);
+    const bool rhs_is_numeric = get_numeric_key(rhs, variant_conversion_table::get_kind(rhs_type), rhs_key);
+    if (lhs_is_numeric || rhs_is_numeric)
+        return (lhs_is_numeric && rhs_is_numeric && lhs_key == rhs_key);
+
+    if (lhs_type != rhs_type)
+        return false;
+
+    if (lhs_kind == basic_type_kind::STRING)
+        return (lhs.get_value<std::string>() == rhs.get_value<std::string>());
+
+    if (lhs_type.is_pointer())
+        return (lhs.get_raw_ptr() == rhs.get_raw_ptr());
+
+    return (lhs == rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
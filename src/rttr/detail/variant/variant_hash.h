@@ -0,0 +1,69 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_HASH_H_
+#define RTTR_VARIANT_HASH_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns the hash value of the given variant \p var.
+ *
+ * Arithmetic values and enumerations are hashed by their numeric value, independent of the concrete type,
+ * strings by their content, pointers by their address. For all other types the registered hash function
+ * (see \ref type::register_hasher()) will be used, otherwise the hash of the \ref type.
+ */
+RTTR_API std::size_t variant_hash(const variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Compares the two variants \p lhs and \p rhs with the key semantic of \ref variant_hash.
+ *
+ * \return `true`, when both variants are equal, otherwise `false`.
+ */
+RTTR_API bool variant_equal_as_key(const variant& lhs, const variant& rhs);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_HASH_H_
@@ -35,6 +35,14 @@
 #include "rttr/detail/misc/data_address_container.h"
 #include "rttr/detail/variant/variant_data_policy.h"
 #include "rttr/variant_array_view.h"
+#include "rttr/variant_associative_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/variant/variant_sort_key.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
 
 namespace rttr
 {
@@ -309,6 +317,74 @@ RTTR_INLINE T variant::convert(bool* ok) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+RTTR_INLINE bool variant_key_equal::operator()(const variant& lhs, const variant& rhs) const
+{
+    return detail::variant_equal_as_key(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Iter>
+void sort_variants(Iter first, Iter last)
+{
+    static_assert(std::is_same<typename std::iterator_traits<Iter>::value_type, variant>::value,
+                  "The given range has to contain rttr::variant objects.");
+
+    struct sort_entry
+    {
+        std::string key;
+        std::size_t index;
+    };
+
+    std::vector<variant> values;
+    std::vector<sort_entry> entries;
+    for (Iter itr = first; itr != last; ++itr)
+    {
+        entries.push_back({itr->sort_key(), values.size()});
+        values.push_back(std::move(*itr));
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [&values](const sort_entry& lhs, const sort_entry& rhs)
+    {
+        const int result = lhs.key.compare(rhs.key);
+        if (result != 0)
+            return (result < 0);
+
+        return (detail::is_partial_sort_key(lhs.key) && values[lhs.index] < values[rhs.index]);
+    });
+
+    for (const auto& entry : entries)
+    {
+        *first = std::move(values[entry.index]);
+        ++first;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Range>
+void sort_variants(Range& range)
+{
+    using std::begin;
+    using std::end;
+    sort_variants(begin(range), end(range));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
+namespace std
+{
+    template <>
+    class hash<rttr::variant>
+    {
+    public:
+        size_t operator()(const rttr::variant& var) const
+        {
+            return rttr::detail::variant_hash(var);
+        }
+    };
+} // end namespace std
+
 #endif // RTTR_VARIANT_IMPL_H_
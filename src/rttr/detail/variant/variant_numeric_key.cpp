@@ -0,0 +1,81 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/variant/variant_numeric_key.h"
+
+#include "rttr/variant.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool get_numeric_key(const variant& var, basic_type_kind kind, numeric_key& key)
+{
+    switch (kind)
+    {
+        case basic_type_kind::BOOL:     key = numeric_key::from(static_cast<int64_t>(var.get_value<bool>())); return true;
+        case basic_type_kind::CHAR:     key = numeric_key::from(static_cast<int64_t>(var.get_value<char>())); return true;
+        case basic_type_kind::INT8:     key = numeric_key::from(static_cast<int64_t>(var.get_value<int8_t>())); return true;
+        case basic_type_kind::INT16:    key = numeric_key::from(static_cast<int64_t>(var.get_value<int16_t>())); return true;
+        case basic_type_kind::INT32:    key = numeric_key::from(static_cast<int64_t>(var.get_value<int32_t>())); return true;
+        case basic_type_kind::INT64:    key = numeric_key::from(var.get_value<int64_t>()); return true;
+        case basic_type_kind::UINT8:    key = numeric_key::from(static_cast<int64_t>(var.get_value<uint8_t>())); return true;
+        case basic_type_kind::UINT16:   key = numeric_key::from(static_cast<int64_t>(var.get_value<uint16_t>())); return true;
+        case basic_type_kind::UINT32:   key = numeric_key::from(static_cast<int64_t>(var.get_value<uint32_t>())); return true;
+        case basic_type_kind::UINT64:   key = numeric_key::from(var.get_value<uint64_t>()); return true;
+        case basic_type_kind::FLOAT:    key = numeric_key::from(static_cast<double>(var.get_value<float>())); return true;
+        case basic_type_kind::DOUBLE:   key = numeric_key::from(var.get_value<double>()); return true;
+        case basic_type_kind::ENUM:
+        {
+            bool ok = false;
+            const int64_t signed_value = var.to_int64(&ok);
+            if (ok)
+            {
+                key = numeric_key::from(signed_value);
+                return true;
+            }
+
+            const uint64_t unsigned_value = var.to_uint64(&ok);
+            if (ok)
+                key = numeric_key::from(unsigned_value);
+
+            return ok;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,146 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_NUMERIC_KEY_H_
+#define RTTR_VARIANT_NUMERIC_KEY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The normalized representation of an arithmetic or enumeration value.
+ *
+ * Every integral value which fits into `int64_t` is stored signed, only bigger values are stored unsigned.
+ * Floating point values without fractional part are stored as integers, so `1`, `1u` and `1.0` have the same key.
+ */
+struct numeric_key
+{
+    enum class kind : uint8_t
+    {
+        SIGNED,
+        UNSIGNED,
+        REAL
+    };
+
+    kind m_kind;
+    union
+    {
+        int64_t     m_signed;
+        uint64_t    m_unsigned;
+        double      m_real;
+    };
+
+    static numeric_key from(int64_t value)
+    {
+        numeric_key key;
+        key.m_kind = kind::SIGNED;
+        key.m_signed = value;
+        return key;
+    }
+
+    static numeric_key from(uint64_t value)
+    {
+        if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            return from(static_cast<int64_t>(value));
+
+        numeric_key key;
+        key.m_kind = kind::UNSIGNED;
+        key.m_unsigned = value;
+        return key;
+    }
+
+    static numeric_key from(double value)
+    {
+        const double two_pow_63 = 9223372036854775808.0;
+        if (std::isfinite(value) && std::trunc(value) == value)
+        {
+            if (value >= -two_pow_63 && value < two_pow_63)
+                return from(static_cast<int64_t>(value));
+            else if (value >= 0.0 && value < 2.0 * two_pow_63)
+                return from(static_cast<uint64_t>(value));
+        }
+
+        numeric_key key;
+        key.m_kind = kind::REAL;
+        key.m_real = value;
+        return key;
+    }
+
+    std::size_t hash() const
+    {
+        switch (m_kind)
+        {
+            case kind::SIGNED:      return std::hash<int64_t>()(m_signed);
+            case kind::UNSIGNED:    return std::hash<uint64_t>()(m_unsigned);
+            default:                return std::hash<double>()(m_real);
+        }
+    }
+
+    bool operator==(const numeric_key& other) const
+    {
+        if (m_kind != other.m_kind)
+            return false;
+
+        switch (m_kind)
+        {
+            case kind::SIGNED:      return (m_signed == other.m_signed);
+            case kind::UNSIGNED:    return (m_unsigned == other.m_unsigned);
+            default:                return (m_real == other.m_real);
+        }
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns `true` and stores the normalized value inside \p key, when \p var contains an arithmetic value
+ * or an enumeration, otherwise `false`. The parameter \p kind has to be the kind of the type of \p var.
+ */
+RTTR_LOCAL bool get_numeric_key(const variant& var, basic_type_kind kind, numeric_key& key);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_NUMERIC_KEY_H_
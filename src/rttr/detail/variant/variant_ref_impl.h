@@ -0,0 +1,106 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_REF_IMPL_H_
+#define RTTR_VARIANT_REF_IMPL_H_
+
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/detail/variant/variant_data_policy.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE variant_ref::variant_ref()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Tp>
+RTTR_INLINE variant_ref::variant_ref(T& value)
+{
+    using policy = detail::variant_ref_policy<detail::remove_cv_t<T>>;
+    policy::create(value, m_var.m_data);
+    m_var.m_policy = &policy::invoke;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE instance::instance(const variant_ref& ref)
+:   m_data_container(ref.m_var.get_data_address_container())
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_ref::is_type() const
+{
+    return m_var.is_type<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE const T& variant_ref::get_value() const
+{
+    return m_var.get_value<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_ref::can_convert() const
+{
+    return m_var.can_convert<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE T variant_ref::convert(bool* ok) const
+{
+    return m_var.convert<T>(ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_ref::convert(T& value) const
+{
+    return m_var.convert(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_REF_IMPL_H_
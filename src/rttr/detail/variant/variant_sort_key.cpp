@@ -0,0 +1,150 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/variant/variant_sort_key.h"
+
+#include "rttr/detail/variant/variant_numeric_key.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+#include "rttr/variant.h"
+#include "rttr/type.h"
+
+#include <cstring>
+#include <limits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE void append_big_endian(std::string& key, uint64_t value)
+{
+    for (int shift = 56; shift >= 0; shift -= 8)
+        key.push_back(static_cast<char>((value >> shift) & 0xff));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Maps the bit pattern of \p value to an unsigned integer with the same order.
+ * Negative numbers have the sign bit set, therefore all bits are flipped, otherwise only the sign bit.
+ * A NaN is mapped to a single value above infinity.
+ */
+static uint64_t get_ordered_bits(double value)
+{
+    if (value != value)
+        value = std::numeric_limits<double>::quiet_NaN();
+
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint64_t sign_bit = uint64_t(1) << 63;
+    if (bits & sign_bit)
+        return ~bits;
+    else
+        return (bits | sign_bit);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A numeric key consists of the ordered bits of the value as double, followed by the exact
+ * integral value (biased by 2^63, stored in 65 bits) as tiebreaker for big integers,
+ * which have the same double representation.
+ */
+static void append_numeric_key(std::string& key, const numeric_key& value)
+{
+    const uint64_t bias = uint64_t(1) << 63;
+    switch (value.m_kind)
+    {
+        case numeric_key::kind::SIGNED:
+        {
+            append_big_endian(key, get_ordered_bits(static_cast<double>(value.m_signed)));
+            key.push_back(0);
+            append_big_endian(key, static_cast<uint64_t>(value.m_signed) + bias);
+            break;
+        }
+        case numeric_key::kind::UNSIGNED:
+        {
+            // values of this kind are always >= 2^63, so the bias results always in a carry
+            append_big_endian(key, get_ordered_bits(static_cast<double>(value.m_unsigned)));
+            key.push_back(1);
+            append_big_endian(key, value.m_unsigned - bias);
+            break;
+        }
+        case numeric_key::kind::REAL:
+        {
+            append_big_endian(key, get_ordered_bits(value.m_real));
+            key.append(9, 0);
+            break;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string variant_sort_key(const variant& var)
+{
+    std::string key;
+    if (!var.is_valid())
+    {
+        key.push_back(static_cast<char>(sort_key_class::INVALID));
+        return key;
+    }
+
+    const type t = var.get_type();
+    const basic_type_kind kind = variant_conversion_table::get_kind(t);
+
+    numeric_key value;
+    if (get_numeric_key(var, kind, value))
+    {
+        key.reserve(18);
+        key.push_back(static_cast<char>(sort_key_class::NUMERIC));
+        append_numeric_key(key, value);
+    }
+    else if (kind == basic_type_kind::STRING)
+    {
+        const auto& text = var.get_value<std::string>();
+        key.reserve(text.size() + 1);
+        key.push_back(static_cast<char>(sort_key_class::STRING));
+        key.append(text);
+    }
+    else
+    {
+        const auto id = t.get_id();
+        key.push_back(static_cast<char>(sort_key_class::OTHER));
+        key.push_back(static_cast<char>((id >> 8) & 0xff));
+        key.push_back(static_cast<char>(id & 0xff));
+    }
+
+    return key;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,80 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_SORT_KEY_H_
+#define RTTR_VARIANT_SORT_KEY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+#include <string>
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The first byte of every sort key, it defines the order between the different classes of values.
+ */
+enum class sort_key_class : uint8_t
+{
+    INVALID = 0,
+    NUMERIC = 1,
+    STRING  = 2,
+    OTHER   = 3
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns the sort key of the given variant \p var. See \ref variant::sort_key().
+ */
+RTTR_API std::string variant_sort_key(const variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns `true`, when two variants with the same sort \p key might still be different,
+ *        i.e. their order can only be determined with \ref variant::operator<().
+ */
+RTTR_INLINE bool is_partial_sort_key(const std::string& key)
+{
+    return (!key.empty() && static_cast<uint8_t>(key[0]) == static_cast<uint8_t>(sort_key_class::OTHER));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_SORT_KEY_H_
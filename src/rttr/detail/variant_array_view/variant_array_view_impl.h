@@ -82,6 +82,57 @@ RTTR_INLINE variant_array_view& variant_array_view::operator=(const variant_arra
 
 /////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+RTTR_INLINE T* variant_array_view::get_data() const
+{
+    if (m_array_wrapper->get_element_type() != type::get<T>())
+        return nullptr;
+
+    return static_cast<T*>(m_array_wrapper->get_data());
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::copy_to(T* out, std::size_t count) const
+{
+    return convert_to(type::get<T>(), out, count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::append_range(const T* data, std::size_t count)
+{
+    return m_array_wrapper->append_range(data, count, type::get<T>(), false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::append_range(std::move_iterator<T*> first, std::move_iterator<T*> last)
+{
+    return m_array_wrapper->append_range(first.base(), static_cast<std::size_t>(last.base() - first.base()), type::get<T>(), true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::assign(const T* data, std::size_t count)
+{
+    return m_array_wrapper->assign(data, count, type::get<T>(), false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::assign(std::move_iterator<T*> first, std::move_iterator<T*> last)
+{
+    return m_array_wrapper->assign(first.base(), static_cast<std::size_t>(last.base() - first.base()), type::get<T>(), true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 #endif // RTTR_VARIANT_ARRAY_VIEW_IMPL_H_
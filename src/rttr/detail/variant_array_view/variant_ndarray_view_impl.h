@@ -0,0 +1,61 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_NDARRAY_VIEW_IMPL_H_
+#define RTTR_VARIANT_NDARRAY_VIEW_IMPL_H_
+
+#include "rttr/type.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE T* variant_ndarray_view::get_flat_data() const
+{
+    if (get_value_type() != type::get<T>())
+        return nullptr;
+
+    return static_cast<T*>(get_flat_data());
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename... Indices>
+RTTR_INLINE variant_ref variant_ndarray_view::at(std::size_t index_1, Indices... indices) const
+{
+    const std::size_t index_list[] = {index_1, static_cast<std::size_t>(indices)...};
+    return get_element(index_list, sizeof...(Indices) + 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_NDARRAY_VIEW_IMPL_H_
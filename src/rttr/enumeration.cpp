@@ -45,6 +45,12 @@ enumeration create_item(const enumeration_wrapper_base* wrapper)
     return enumeration(wrapper);
 }
 
+template<>
+const enumeration_wrapper_base* get_wrapper(const enumeration& item)
+{
+    return item.m_wrapper;
+}
+
 } // end namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -121,6 +127,16 @@ variant enumeration::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant enumeration::get_metadata(const metadata_key& key) const
+{
+    if (is_valid())
+        return m_wrapper->get_metadata(key);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 array_range<string_view> enumeration::get_names() const
 {
     if (is_valid())
@@ -161,6 +177,36 @@ variant enumeration::name_to_value(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool enumeration::is_flags() const
+{
+    if (is_valid())
+        return m_wrapper->is_flags();
+    else
+        return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string enumeration::value_to_flag_names(argument value) const
+{
+    if (is_valid())
+        return m_wrapper->value_to_flag_names(value);
+    else
+        return std::string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant enumeration::flag_names_to_value(string_view names) const
+{
+    if (is_valid())
+        return m_wrapper->flag_names_to_value(names);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool enumeration::operator==(const enumeration& other) const
 {
     return (m_wrapper == other.m_wrapper);
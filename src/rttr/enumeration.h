@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/type.h"
 #include "rttr/string_view.h"
+#include "rttr/metadata_key.h"
 #include "rttr/detail/misc/class_item_mapper.h"
 
 #include <memory>
@@ -47,6 +48,32 @@ namespace detail
     class enumeration_wrapper_base;
 }
 
+/*!
+ * The \ref enumeration_metadata enum contains the keys of the \ref rttr::metadata() "metadata",
+ * which changes the behavior of an \ref enumeration.
+ *
+ * \see enumeration::is_flags()
+ */
+enum class enumeration_metadata
+{
+    /*!
+     * With the value `true`, the enumeration is a bit-flag enumeration; every registered enumerator,
+     * which consists of exactly one bit, names this bit. A value is then converted to a string
+     * like `"read|write"` and back. See \ref enumeration::value_to_flag_names().
+     *
+     * \code{.cpp}
+     *  registration::enumeration<access>("access")
+     *  (
+     *      metadata(enumeration_metadata::flags, true),
+     *      value("read",   access::read),
+     *      value("write",  access::write),
+     *      value("exec",   access::exec)
+     *  );
+     * \endcode
+     */
+    flags
+};
+
 /*!
  * The \ref enumeration class provides several meta information about an enum.
  *
@@ -158,6 +185,19 @@ class RTTR_API enumeration
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned key \p key.
+         *
+         * In contrast to \ref get_metadata(const variant&) const "get_metadata(const variant&)",
+         * only the integer ids of the keys are compared.
+         *
+         * \remark When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const metadata_key& key) const;
+
         /*!
          * \brief Returns all enum names registered for this enumeration.
          *
@@ -181,6 +221,9 @@ class RTTR_API enumeration
          * \brief Returns the string_view that is used as the name of the given enumeration \p value,
          *        or an empty string_view if the \p value is not defined.
          *
+         * \remark The name is looked up in constant time; when a value is registered for more than one name,
+         *         the first registered name is returned.
+         *
          * \return A string_view object, containing the name for the given value.
          */
         string_view value_to_name(argument value) const;
@@ -188,10 +231,40 @@ class RTTR_API enumeration
         /*!
          * \brief Returns the value of the given enumeration \p name, or an empty variant if the name is not defined.
          *
+         * \remark The value is looked up in constant time, via a perfect hash of the registered names.
+         *
          * \return A variant object, containing the value for the given \p name.
          */
         variant name_to_value(string_view name) const;
 
+        /*!
+         * \brief Returns true, when this enumeration was registered as bit-flag enumeration
+         *        (see \ref enumeration_metadata::flags).
+         */
+        bool is_flags() const;
+
+        /*!
+         * \brief Returns the names of the bits, which are set in the given \p value, separated by `|`; e.g. `"read|write"`.
+         *
+         * When the \p value itself has a registered name, this name is returned. Otherwise the \p value is decomposed
+         * into its bits, with one lookup per set bit; this requires a \ref is_flags() "bit-flag enumeration",
+         * which registered every set bit as an enumerator of its own. The \ref variant::to_string() "string conversion"
+         * of an enumeration value uses this function.
+         *
+         * \return The names; an empty string, when the \p value cannot be named.
+         */
+        std::string value_to_flag_names(argument value) const;
+
+        /*!
+         * \brief Returns the value, which combines the enumerators in \p names, that are separated by `|`; e.g. `"read | write"`.
+         *
+         * For an enumeration, which is not a \ref is_flags() "bit-flag enumeration", this is the same as \ref name_to_value().
+         * The conversion of a string to an enumeration value in the \ref variant class uses this function.
+         *
+         * \return The combined value; an invalid variant, when a name is not registered.
+         */
+        variant flag_names_to_value(string_view names) const;
+
         /*!
          * \brief Returns true if this enumeration is the same like the \p other.
          *
@@ -213,6 +286,8 @@ class RTTR_API enumeration
 
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
+        template<typename T>
+        friend const detail::class_item_to_wrapper_t<T>* detail::get_wrapper(const T& item);
     private:
         const detail::enumeration_wrapper_base* m_wrapper;
 };
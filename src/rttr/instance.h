@@ -35,8 +35,17 @@
 namespace rttr
 {
 class variant;
+class variant_ref;
+class variant_array_view;
 class type;
 class argument;
+class instance;
+
+namespace detail
+{
+    RTTR_INLINE void* get_object_address(const instance& object);
+    RTTR_INLINE instance create_instance(void* address, const type& t);
+}
 
 /*!
  * The \ref instance class is used for forwarding the instance of an object to invoke a \ref property or \ref method.
@@ -49,6 +58,7 @@ class RTTR_API instance
     template<typename T, typename Tp = detail::decay_t<T>>
     using decay_instance_t = detail::enable_if_t<!std::is_same<instance, Tp>::value &&
                                                  !std::is_same<variant, Tp>::value &&
+                                                 !std::is_same<variant_ref, Tp>::value &&
                                                  !std::is_same<variant_array_view, Tp>::value, T>;
 
 public:
@@ -64,6 +74,14 @@ public:
      */
     RTTR_INLINE instance(variant& var);
 
+    /*!
+     * \brief Creates an instance object from the object, which is referenced by the given \ref variant_ref \p ref.
+     *
+     * This makes it possible to access the properties of an object, which was retrieved via \ref property::get_ref(),
+     * without copying it.
+     */
+    RTTR_INLINE instance(const variant_ref& ref);
+
     /*!
      * \brief Copy constructor for an instance.
      */
@@ -150,6 +168,9 @@ public:
 private:
     instance& operator=(const instance& other);
 
+    friend void* detail::get_object_address(const instance& object);
+    friend instance detail::create_instance(void* address, const type& t);
+
     detail::data_address_container m_data_container;
 };
 
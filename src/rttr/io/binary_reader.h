@@ -0,0 +1,122 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_READER_H_
+#define RTTR_BINARY_READER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace rttr
+{
+namespace detail
+{
+    class binary_reader_private;
+}
+
+namespace io
+{
+
+/*!
+ * The \ref binary_reader class reads the properties of reflected objects, which were written by a \ref binary_writer,
+ * either from a block of memory or from a file descriptor.
+ *
+ * The objects have to exist already; the reader assigns the values to their properties in the order of the
+ * serialization plan of the object's type. Arithmetic values and enumerations are copied directly into the object,
+ * contiguous arrays of them with one `memcpy` for the whole array.
+ * Read only properties are skipped; properties with a setter function are assigned via the setter.
+ *
+ * \code{.cpp}
+ *  io::binary_reader reader(buffer.data(), buffer.size());
+ *  std::vector<mesh> meshes;
+ *  while (!reader.at_end())
+ *  {
+ *      mesh m;
+ *      if (!reader.read(m))
+ *          break;
+ *      meshes.push_back(std::move(m));
+ *  }
+ * \endcode
+ *
+ * \see binary_writer
+ */
+class RTTR_API binary_reader
+{
+    public:
+        /*!
+         * \brief Creates a reader for the \p size bytes at \p data.
+         *
+         * \remark The data is not copied, it has to outlive the reader.
+         */
+        binary_reader(const void* data, std::size_t size);
+
+        /*!
+         * \brief Creates a reader for the given open \p file_descriptor, which reads blocks of \p buffer_size bytes.
+         *
+         * The file descriptor will not be closed by the reader.
+         */
+        explicit binary_reader(int file_descriptor, std::size_t buffer_size = 64 * 1024);
+
+        /*!
+         * \brief Destroys the reader.
+         */
+        ~binary_reader();
+
+        /*!
+         * \brief Reads the properties of the given \p object.
+         *
+         * The plan of the \ref instance::get_derived_type() "most derived type" of \p object is used.
+         *
+         * \return True, when the object could be read; otherwise false, e.g. when the data ended too early,
+         *         \p object is invalid or the size of a fixed size array does not match.
+         *         Then the object might be read partially.
+         */
+        bool read(const instance& object);
+
+        /*!
+         * \brief Returns true, when all data was read.
+         *
+         * \return True, when there is no more data; otherwise false.
+         */
+        bool at_end();
+
+    private:
+        binary_reader(const binary_reader& other);
+        binary_reader& operator=(const binary_reader& other);
+
+        std::unique_ptr<detail::binary_reader_private> m_private;
+};
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_BINARY_READER_H_
@@ -0,0 +1,76 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/io/binary_writer.h"
+
+#include "rttr/detail/io/binary_writer_p.h"
+
+namespace rttr
+{
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_writer::binary_writer(std::vector<char>& buffer)
+:   m_private(detail::make_unique<detail::binary_writer_private>(buffer))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_writer::binary_writer(int file_descriptor, std::size_t buffer_size)
+:   m_private(detail::make_unique<detail::binary_writer_private>(file_descriptor, buffer_size))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_writer::~binary_writer()
+{
+    m_private->flush();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_writer::write(const instance& object)
+{
+    return m_private->write(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_writer::flush()
+{
+    return m_private->flush();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
@@ -0,0 +1,129 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_BINARY_WRITER_H_
+#define RTTR_BINARY_WRITER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+    class binary_writer_private;
+}
+
+namespace io
+{
+
+/*!
+ * The \ref binary_writer class writes the properties of reflected objects in a compact binary format,
+ * either into a buffer or into a file descriptor. Use a \ref binary_reader to read them back.
+ *
+ * For every class, a serialization plan is compiled once: the list of its non-static properties together with
+ * the way, how each value is stored. Writing an object then follows the plan; arithmetic values and enumerations
+ * are copied directly from the object, contiguous arrays of them with one `memcpy` for the whole array.
+ * Only for properties, which are accessed via getter functions, a temporary value is created.
+ *
+ * \code{.cpp}
+ *  std::vector<char> buffer;
+ *  io::binary_writer writer(buffer);
+ *  for (const auto& mesh : scene.meshes)
+ *      writer.write(mesh);
+ * \endcode
+ *
+ * Format
+ * ------
+ * - arithmetic types and enumerations: the bytes of the value, in the byte order of the machine
+ * - `std::string`: the length as 64 bit unsigned integer, followed by the characters
+ * - arrays: the size of the first dimension as 64 bit unsigned integer, followed by the elements
+ * - classes: the values of the properties, in the order of \ref type::get_properties()
+ *
+ * No type information is stored, so the data has to be read with objects of the same types in the same order,
+ * by a program which registered the same properties. Pointers, wrappers, associative containers
+ * and static properties are not written.
+ *
+ * \see binary_reader
+ */
+class RTTR_API binary_writer
+{
+    public:
+        /*!
+         * \brief Creates a writer, which appends the written objects to the given \p buffer.
+         *
+         * \remark The buffer has to outlive the writer.
+         */
+        explicit binary_writer(std::vector<char>& buffer);
+
+        /*!
+         * \brief Creates a writer, which writes into the given open \p file_descriptor.
+         *
+         * The data is collected in a buffer of \p buffer_size bytes, before it is written.
+         * The file descriptor will not be closed by the writer.
+         */
+        explicit binary_writer(int file_descriptor, std::size_t buffer_size = 64 * 1024);
+
+        /*!
+         * \brief Writes all buffered data into the file descriptor and destroys the writer.
+         */
+        ~binary_writer();
+
+        /*!
+         * \brief Writes the properties of the given \p object.
+         *
+         * The plan of the \ref instance::get_derived_type() "most derived type" of \p object is used.
+         *
+         * \return True, when the object could be written; otherwise false, e.g. when \p object is invalid
+         *         or writing into the file descriptor failed.
+         */
+        bool write(const instance& object);
+
+        /*!
+         * \brief Writes all buffered data into the file descriptor.
+         *
+         * \return True, when no error happened so far; otherwise false.
+         */
+        bool flush();
+
+    private:
+        binary_writer(const binary_writer& other);
+        binary_writer& operator=(const binary_writer& other);
+
+        std::unique_ptr<detail::binary_writer_private> m_private;
+};
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_BINARY_WRITER_H_
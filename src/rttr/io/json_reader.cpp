@@ -0,0 +1,764 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/io/json_reader.h"
+
+#include "rttr/argument.h"
+#include "rttr/variant.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/io/json_plan.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/detail/conversion/std_conversion_functions.h"
+
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class json_reader_private
+{
+    public:
+        explicit json_reader_private(string_view text)
+        :   m_begin(text.data()),
+            m_current(text.data()),
+            m_end(text.data() + text.size()),
+            m_last_plan(nullptr)
+        {
+        }
+
+        bool read(const instance& object)
+        {
+            m_error.clear();
+            if (!object.is_valid())
+                return set_error("invalid object");
+
+            skip_white_space();
+            return read_object(object, get_plan(object.get_derived_type()));
+        }
+
+        bool at_end()
+        {
+            skip_white_space();
+            return (m_current == m_end);
+        }
+
+        const std::string& get_error() const
+        {
+            return m_error;
+        }
+
+    private:
+        //! The maximum nesting of skipped values, so malicious input cannot exhaust the stack.
+        static const int max_skip_depth = 512;
+
+        const json_plan& get_plan(const type& t)
+        {
+            if (!m_last_plan || m_last_plan->get_type() != t)
+                m_last_plan = &json_plan::get(t);
+
+            return *m_last_plan;
+        }
+
+        bool set_error(const char* message)
+        {
+            m_error = std::string(message) + " at offset " + std::to_string(m_current - m_begin);
+            return false;
+        }
+
+        void skip_white_space()
+        {
+            while (m_current != m_end && (*m_current == ' ' || *m_current == '\n' || *m_current == '\r' || *m_current == '\t'))
+                ++m_current;
+        }
+
+        //! Skips white space and consumes the character \p c, when it is next.
+        bool consume(char c)
+        {
+            skip_white_space();
+            if (m_current == m_end || *m_current != c)
+                return false;
+
+            ++m_current;
+            return true;
+        }
+
+        bool expect(char c)
+        {
+            if (consume(c))
+                return true;
+
+            const char message[] = {'e', 'x', 'p', 'e', 'c', 't', 'e', 'd', ' ', '\'', c, '\'', '\0'};
+            return set_error(message);
+        }
+
+        bool consume_literal(const char* literal, std::size_t size)
+        {
+            if (static_cast<std::size_t>(m_end - m_current) < size || std::memcmp(m_current, literal, size) != 0)
+                return false;
+
+            m_current += size;
+            return true;
+        }
+
+        bool is_null()
+        {
+            skip_white_space();
+            return consume_literal("null", 4);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////
+
+        static bool parse_hex(const char* text, uint32_t& value)
+        {
+            value = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                const char c = text[i];
+                value <<= 4;
+                if (c >= '0' && c <= '9')
+                    value |= static_cast<uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    value |= static_cast<uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    value |= static_cast<uint32_t>(c - 'A' + 10);
+                else
+                    return false;
+            }
+            return true;
+        }
+
+        static void append_utf8(std::string& text, uint32_t code_point)
+        {
+            if (code_point < 0x80)
+            {
+                text += static_cast<char>(code_point);
+            }
+            else if (code_point < 0x800)
+            {
+                text += static_cast<char>(0xc0 | (code_point >> 6));
+                text += static_cast<char>(0x80 | (code_point & 0x3f));
+            }
+            else if (code_point < 0x10000)
+            {
+                text += static_cast<char>(0xe0 | (code_point >> 12));
+                text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+                text += static_cast<char>(0x80 | (code_point & 0x3f));
+            }
+            else
+            {
+                text += static_cast<char>(0xf0 | (code_point >> 18));
+                text += static_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+                text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+                text += static_cast<char>(0x80 | (code_point & 0x3f));
+            }
+        }
+
+        bool read_escape(std::string& text)
+        {
+            if (m_current == m_end)
+                return set_error("unterminated string");
+
+            const char c = *m_current++;
+            switch (c)
+            {
+                case '"':   text += '"'; return true;
+                case '\\':  text += '\\'; return true;
+                case '/':   text += '/'; return true;
+                case 'b':   text += '\b'; return true;
+                case 'f':   text += '\f'; return true;
+                case 'n':   text += '\n'; return true;
+                case 'r':   text += '\r'; return true;
+                case 't':   text += '\t'; return true;
+                case 'u':   break;
+                default:    return set_error("invalid escape sequence");
+            }
+
+            uint32_t code_point = 0;
+            if (m_end - m_current < 4 || !parse_hex(m_current, code_point))
+                return set_error("invalid unicode escape sequence");
+            m_current += 4;
+
+            if (code_point >= 0xd800 && code_point <= 0xdbff)
+            {
+                uint32_t low_surrogate = 0;
+                if (m_end - m_current < 6 || m_current[0] != '\\' || m_current[1] != 'u' ||
+                    !parse_hex(m_current + 2, low_surrogate) || low_surrogate < 0xdc00 || low_surrogate > 0xdfff)
+                {
+                    return set_error("invalid unicode surrogate pair");
+                }
+                m_current += 6;
+                code_point = 0x10000 + ((code_point - 0xd800) << 10) + (low_surrogate - 0xdc00);
+            }
+            else if (code_point >= 0xdc00 && code_point <= 0xdfff)
+            {
+                return set_error("invalid unicode surrogate pair");
+            }
+
+            append_utf8(text, code_point);
+            return true;
+        }
+
+        /*!
+         * Reads a string; when it contains no escape sequences, \p result refers directly to the text,
+         * otherwise to the decoded string in \p buffer.
+         */
+        bool read_string(string_view& result, std::string& buffer)
+        {
+            if (!expect('"'))
+                return false;
+
+            const char* run_begin = m_current;
+            bool has_escapes = false;
+            while (true)
+            {
+                if (m_current == m_end)
+                    return set_error("unterminated string");
+
+                const char c = *m_current;
+                if (c == '"')
+                {
+                    if (has_escapes)
+                    {
+                        buffer.append(run_begin, m_current);
+                        result = string_view(buffer.data(), buffer.size());
+                    }
+                    else
+                    {
+                        result = string_view(run_begin, static_cast<std::size_t>(m_current - run_begin));
+                    }
+                    ++m_current;
+                    return true;
+                }
+                else if (c == '\\')
+                {
+                    if (!has_escapes)
+                        buffer.clear();
+                    has_escapes = true;
+                    buffer.append(run_begin, m_current);
+                    ++m_current;
+                    if (!read_escape(buffer))
+                        return false;
+                    run_begin = m_current;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    return set_error("control character in string");
+                }
+                else
+                {
+                    ++m_current;
+                }
+            }
+        }
+
+        bool read_string(std::string& text)
+        {
+            string_view result;
+            if (!read_string(result, m_string_buffer))
+                return false;
+
+            text.assign(result.data(), result.size());
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////
+
+        //! Finds the end of the number at the current position.
+        bool scan_number(const char*& end, bool& is_integer)
+        {
+            skip_white_space();
+            end = m_current;
+            is_integer = true;
+            if (end != m_end && *end == '-')
+                ++end;
+
+            const char* digits_begin = end;
+            while (end != m_end && *end >= '0' && *end <= '9')
+                ++end;
+            if (end == digits_begin)
+                return set_error("expected a number");
+
+            while (end != m_end && ((*end >= '0' && *end <= '9') || *end == '.' || *end == 'e' || *end == 'E' || *end == '+' || *end == '-'))
+            {
+                is_integer = false;
+                ++end;
+            }
+
+            return true;
+        }
+
+        bool read_integer(uint64_t& value, bool& is_negative)
+        {
+            const char* end = nullptr;
+            bool is_integer = false;
+            if (!scan_number(end, is_integer))
+                return false;
+            if (!is_integer)
+                return set_error("expected an integer");
+
+            is_negative = (*m_current == '-');
+            const char* itr = m_current + (is_negative ? 1 : 0);
+            value = 0;
+            for (; itr != end; ++itr)
+            {
+                const uint64_t digit = static_cast<uint64_t>(*itr - '0');
+                if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+                    return set_error("number out of range");
+                value = value * 10 + digit;
+            }
+
+            if (is_negative)
+            {
+                if (value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1)
+                    return set_error("number out of range");
+                value = ~value + 1;
+            }
+
+            m_current = end;
+            return true;
+        }
+
+        //! `strtold` respects the decimal point of the C locale, so it is replaced before parsing.
+        bool read_long_double(long double& value, std::size_t size)
+        {
+            char buffer[128];
+            if (size >= sizeof(buffer))
+                return false;
+
+            const char decimal_point = *std::localeconv()->decimal_point;
+            for (std::size_t i = 0; i < size; ++i)
+                buffer[i] = (m_current[i] == '.' ? decimal_point : m_current[i]);
+            buffer[size] = '\0';
+
+            char* parse_end = nullptr;
+            value = std::strtold(buffer, &parse_end);
+            return (parse_end == buffer + size);
+        }
+
+        bool read_floating_point(void* address, json_number_kind kind)
+        {
+            const char* end = nullptr;
+            bool is_integer = false;
+            if (!scan_number(end, is_integer))
+                return false;
+
+            const std::size_t size = static_cast<std::size_t>(end - m_current);
+            bool ok = false;
+            if (kind == json_number_kind::FLOAT)
+                *static_cast<float*>(address) = string_to_float(std::string(m_current, size), &ok);
+            else if (kind == json_number_kind::DOUBLE)
+                *static_cast<double*>(address) = string_to_double(std::string(m_current, size), &ok);
+            else
+                ok = read_long_double(*static_cast<long double*>(address), size);
+
+            if (!ok)
+                return set_error("invalid number");
+
+            m_current = end;
+            return true;
+        }
+
+        bool read_number(void* address, json_number_kind kind)
+        {
+            if (kind == json_number_kind::FLOAT || kind == json_number_kind::DOUBLE || kind == json_number_kind::LONG_DOUBLE)
+            {
+                if (is_null())
+                {
+                    // not finite values are written as null
+                    if (kind == json_number_kind::FLOAT)
+                        *static_cast<float*>(address) = std::numeric_limits<float>::quiet_NaN();
+                    else if (kind == json_number_kind::DOUBLE)
+                        *static_cast<double*>(address) = std::numeric_limits<double>::quiet_NaN();
+                    else
+                        *static_cast<long double*>(address) = std::numeric_limits<long double>::quiet_NaN();
+                    return true;
+                }
+
+                return read_floating_point(address, kind);
+            }
+
+            uint64_t value = 0;
+            bool is_negative = false;
+            const char* number_begin = m_current;
+            if (!read_integer(value, is_negative))
+                return false;
+
+            if (!json_store_integer(address, kind, value, is_negative))
+            {
+                m_current = number_begin;
+                return set_error("number out of range");
+            }
+
+            return true;
+        }
+
+        bool read_scalar(void* address, const json_value_info& info)
+        {
+            skip_white_space();
+            switch (info.m_kind)
+            {
+                case json_value_kind::BOOLEAN:
+                {
+                    if (consume_literal("true", 4))
+                        *static_cast<bool*>(address) = true;
+                    else if (consume_literal("false", 5))
+                        *static_cast<bool*>(address) = false;
+                    else
+                        return set_error("expected a boolean");
+                    return true;
+                }
+                case json_value_kind::NUMBER:
+                {
+                    return read_number(address, info.m_number_kind);
+                }
+                case json_value_kind::ENUMERATION:
+                {
+                    if (m_current == m_end || *m_current != '"')
+                        return read_number(address, info.m_number_kind);
+
+                    string_view name;
+                    const char* name_begin = m_current;
+                    uint64_t value = 0;
+                    if (!read_string(name, m_string_buffer))
+                        return false;
+
+                    if (!info.m_enum_table->get_value(name, value))
+                    {
+                        m_current = name_begin;
+                        return set_error("unknown enumerator");
+                    }
+
+                    return json_store_integer(address, info.m_number_kind, value, static_cast<int64_t>(value) < 0);
+                }
+                case json_value_kind::STRING:
+                {
+                    return read_string(*static_cast<std::string*>(address));
+                }
+                case json_value_kind::ARRAY:
+                case json_value_kind::OBJECT:
+                case json_value_kind::UNSUPPORTED:
+                {
+                    break;
+                }
+            }
+
+            return set_error("unsupported value");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////
+
+        bool skip_value(int depth = 0)
+        {
+            if (depth > max_skip_depth)
+                return set_error("nesting too deep");
+
+            skip_white_space();
+            if (m_current == m_end)
+                return set_error("unexpected end of text");
+
+            const char c = *m_current;
+            if (c == '"')
+            {
+                string_view text;
+                return read_string(text, m_string_buffer);
+            }
+            else if (c == '{' || c == '[')
+            {
+                const char close = (c == '{') ? '}' : ']';
+                ++m_current;
+                if (consume(close))
+                    return true;
+
+                do
+                {
+                    if (c == '{')
+                    {
+                        string_view key;
+                        if (!read_string(key, m_string_buffer) || !expect(':'))
+                            return false;
+                    }
+
+                    if (!skip_value(depth + 1))
+                        return false;
+                } while (consume(','));
+
+                return expect(close);
+            }
+            else if (consume_literal("true", 4) || consume_literal("false", 5) || consume_literal("null", 4))
+            {
+                return true;
+            }
+            else
+            {
+                const char* end = nullptr;
+                bool is_integer = false;
+                if (!scan_number(end, is_integer))
+                    return false;
+
+                m_current = end;
+                return true;
+            }
+        }
+
+        //! Counts the elements of the array, which starts at the current position, without consuming it.
+        bool count_array_elements(std::size_t& count)
+        {
+            const char* array_begin = m_current;
+            count = 0;
+            if (!expect('['))
+                return false;
+
+            if (!consume(']'))
+            {
+                do
+                {
+                    if (!skip_value())
+                        return false;
+                    ++count;
+                } while (consume(','));
+
+                if (!expect(']'))
+                    return false;
+            }
+
+            m_current = array_begin;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////
+
+        bool read_object(instance object, const json_plan& plan)
+        {
+            if (!expect('{'))
+                return false;
+
+            if (consume('}'))
+                return true;
+
+            do
+            {
+                string_view name;
+                if (!read_string(name, m_key_buffer) || !expect(':'))
+                    return false;
+
+                const json_field* field = plan.find_field(name);
+                if (!field || field->m_is_readonly)
+                {
+                    if (!skip_value())
+                        return false;
+                }
+                else if (!is_null() && !read_field(object, *field))
+                {
+                    return false;
+                }
+            } while (consume(','));
+
+            return expect('}');
+        }
+
+        bool read_field(instance& object, const json_field& field)
+        {
+            const json_value_info& info = field.m_value;
+            if (void* address = field.m_wrapper->get_value_address(object))
+            {
+                if (info.m_kind == json_value_kind::ARRAY || info.m_kind == json_value_kind::OBJECT)
+                    return read_value(field.m_wrapper->get_ref(object), info);
+                else
+                    return read_scalar(address, info);
+            }
+
+            // the value is read into a copy, which is assigned via the setter afterwards
+            variant value = field.m_wrapper->get_value(object);
+            if (!value.is_valid())
+                return set_error("property value not available");
+
+            if (!read_value(value, info))
+                return false;
+
+            argument arg(value);
+            if (!field.m_wrapper->set_value(object, arg))
+                return set_error("property could not be set");
+
+            return true;
+        }
+
+        template<typename T>
+        bool read_value(T& value, const json_value_info& info)
+        {
+            if (info.m_kind == json_value_kind::ARRAY)
+            {
+                auto view = value.create_array_view();
+                return read_array(view);
+            }
+            else if (info.m_kind == json_value_kind::OBJECT)
+            {
+                return read_object(instance(value), *info.m_plan);
+            }
+            else
+            {
+                return read_scalar(get_object_address(instance(value)), info);
+            }
+        }
+
+        bool read_value(const variant_ref& value, const json_value_info& info)
+        {
+            return read_value<const variant_ref>(value, info);
+        }
+
+        bool read_array(variant_array_view& view)
+        {
+            const json_value_info info = json_value_info::get(view.get_element_type());
+            if (info.m_kind == json_value_kind::UNSUPPORTED)
+                return skip_value();
+
+            std::size_t size = 0;
+            if (!count_array_elements(size))
+                return false;
+
+            if (view.is_dynamic() ? !view.set_size(size) : (view.get_size() != size))
+                return set_error("array size mismatch");
+
+            consume('[');
+            const bool is_scalar = (info.m_kind != json_value_kind::ARRAY && info.m_kind != json_value_kind::OBJECT);
+            if (is_scalar && view.is_contiguous())
+            {
+                char* data = static_cast<char*>(view.get_data());
+                const std::size_t stride = view.get_stride();
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if ((i > 0 && !expect(',')) || !read_scalar(data + i * stride, info))
+                        return false;
+                }
+            }
+            else if (is_scalar && info.m_kind != json_value_kind::STRING)
+            {
+                // containers without contiguous storage (e.g. std::vector<bool> or std::list) are assigned from a buffer
+                const std::size_t element_size = info.m_type.get_sizeof();
+                std::unique_ptr<long double[]> buffer(new long double[(size * element_size) / sizeof(long double) + 1]);
+                char* data = reinterpret_cast<char*>(buffer.get());
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    if ((i > 0 && !expect(',')) || !read_scalar(data + i * element_size, info))
+                        return false;
+                }
+
+                if (!view.assign(info.m_type, data, size))
+                    return set_error("array could not be assigned");
+            }
+            else
+            {
+                std::size_t index = 0;
+                for (auto itr = view.begin(), end = view.end(); itr != end; ++itr, ++index)
+                {
+                    if (index > 0 && !expect(','))
+                        return false;
+
+                    if (info.m_kind == json_value_kind::STRING)
+                    {
+                        // the elements are assigned, so also a container, which returns copies, works
+                        std::string text;
+                        if (!read_string(text))
+                            return false;
+                        if (!view.set_value(itr, text))
+                            return set_error("array element could not be set");
+                    }
+                    else if (!read_value(*itr, info))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return expect(']');
+        }
+
+    private:
+        const char*         m_begin;
+        const char*         m_current;
+        const char*         m_end;
+        const json_plan*    m_last_plan;
+        std::string         m_error;
+        std::string         m_key_buffer;
+        std::string         m_string_buffer;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_reader::json_reader(string_view text)
+:   m_private(detail::make_unique<detail::json_reader_private>(text))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_reader::~json_reader()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool json_reader::read(const instance& object)
+{
+    return m_private->read(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool json_reader::at_end()
+{
+    return m_private->at_end();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string json_reader::get_error() const
+{
+    return m_private->get_error();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
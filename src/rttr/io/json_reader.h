@@ -0,0 +1,121 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_JSON_READER_H_
+#define RTTR_JSON_READER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/string_view.h"
+
+#include <memory>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+    class json_reader_private;
+}
+
+namespace io
+{
+
+/*!
+ * The \ref json_reader class parses JSON text directly into the properties of reflected objects.
+ *
+ * No document tree is built; the text is parsed in one pass. The members of a JSON object are matched to the properties
+ * via a hash table of the precompiled plan of the object's type, so they may appear in any order.
+ * Arithmetic values and strings are stored directly into the object, without creating a \ref variant.
+ * Enumerations are read by the name of the enumerator (see \ref enumeration::name_to_value()) or as number.
+ * Arrays are resized via \ref variant_array_view and filled element by element.
+ *
+ * Members without a matching property, members of read only properties and members with the value `null` are skipped;
+ * properties without a member keep their value. Properties with a setter function are assigned via the setter.
+ *
+ * \code{.cpp}
+ *  io::json_reader reader(text);
+ *  order o;
+ *  if (!reader.read(o))
+ *      std::cerr << reader.get_error() << std::endl;
+ * \endcode
+ *
+ * \see json_writer
+ */
+class RTTR_API json_reader
+{
+    public:
+        /*!
+         * \brief Creates a reader for the given JSON \p text, which can contain several objects.
+         *
+         * \remark The text is not copied, it has to outlive the reader.
+         */
+        explicit json_reader(string_view text);
+
+        /*!
+         * \brief Destroys the reader.
+         */
+        ~json_reader();
+
+        /*!
+         * \brief Parses the next JSON object of the text into the properties of the given \p object.
+         *
+         * The plan of the \ref instance::get_derived_type() "most derived type" of \p object is used.
+         *
+         * \return True, when the object could be read; otherwise false, e.g. when the text is no valid JSON,
+         *         a value does not fit into the type of its property or \p object is invalid.
+         *         Then the object might be read partially and \ref get_error() describes the problem.
+         */
+        bool read(const instance& object);
+
+        /*!
+         * \brief Returns true, when the rest of the text contains only white space.
+         *
+         * \return True, when there are no more objects; otherwise false.
+         */
+        bool at_end();
+
+        /*!
+         * \brief Returns a description of the last error, including the offset in the text, where it occurred.
+         *
+         * \return The error message, or an empty string, when the last \ref read() succeeded.
+         */
+        std::string get_error() const;
+
+    private:
+        json_reader(const json_reader& other);
+        json_reader& operator=(const json_reader& other);
+
+        std::unique_ptr<detail::json_reader_private> m_private;
+};
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_JSON_READER_H_
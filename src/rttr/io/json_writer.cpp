@@ -0,0 +1,324 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/io/json_writer.h"
+
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/io/json_plan.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/detail/conversion/std_conversion_functions.h"
+
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class json_writer_private
+{
+    public:
+        explicit json_writer_private(std::string& output)
+        :   m_output(output),
+            m_last_plan(nullptr),
+            m_object_count(0)
+        {
+        }
+
+        bool write(const instance& object)
+        {
+            if (!object.is_valid())
+                return false;
+
+            if (m_object_count++ > 0)
+                m_output += '\n';
+
+            write_object(object, get_plan(object.get_derived_type()));
+            return true;
+        }
+
+    private:
+        //! Most streams contain objects of one type, so the last plan is reused without locking the plan cache.
+        const json_plan& get_plan(const type& t)
+        {
+            if (!m_last_plan || m_last_plan->get_type() != t)
+                m_last_plan = &json_plan::get(t);
+
+            return *m_last_plan;
+        }
+
+        static bool is_scalar(json_value_kind kind)
+        {
+            return (kind != json_value_kind::ARRAY && kind != json_value_kind::OBJECT);
+        }
+
+        void write_unsigned(uint64_t value)
+        {
+            char buffer[24];
+            char* end = buffer + sizeof(buffer);
+            char* begin = end;
+            do
+            {
+                *--begin = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+
+            m_output.append(begin, end);
+        }
+
+        void write_signed(uint64_t value)
+        {
+            if (static_cast<int64_t>(value) < 0)
+            {
+                m_output += '-';
+                value = ~value + 1;
+            }
+
+            write_unsigned(value);
+        }
+
+        //! Writes the shortest text, which reads back to the same \p value, independent of the C locale.
+        template<typename T>
+        void write_floating_point(T value)
+        {
+            if (!std::isfinite(value))
+            {
+                m_output += "null";
+                return;
+            }
+
+            m_output += to_string(value, nullptr);
+        }
+
+        //! There is no shortest formatting for 'long double', so all digits are written; the decimal point of the C locale is replaced.
+        void write_floating_point(long double value)
+        {
+            if (!std::isfinite(value))
+            {
+                m_output += "null";
+                return;
+            }
+
+            char buffer[64];
+            const int size = std::snprintf(buffer, sizeof(buffer), "%.21Lg", value);
+            if (size <= 0)
+                return;
+
+            const char decimal_point = *std::localeconv()->decimal_point;
+            const std::size_t length = static_cast<std::size_t>(size) < sizeof(buffer) ? static_cast<std::size_t>(size) : sizeof(buffer) - 1;
+            for (std::size_t i = 0; i < length; ++i)
+                m_output += (buffer[i] == decimal_point ? '.' : buffer[i]);
+        }
+
+        void write_number(const void* address, json_number_kind kind)
+        {
+            switch (kind)
+            {
+                case json_number_kind::INT8:
+                case json_number_kind::INT16:
+                case json_number_kind::INT32:
+                case json_number_kind::INT64:
+                {
+                    write_signed(json_load_integer(address, kind));
+                    break;
+                }
+                case json_number_kind::UINT8:
+                case json_number_kind::UINT16:
+                case json_number_kind::UINT32:
+                case json_number_kind::UINT64:
+                {
+                    write_unsigned(json_load_integer(address, kind));
+                    break;
+                }
+                case json_number_kind::FLOAT:
+                {
+                    write_floating_point(*static_cast<const float*>(address));
+                    break;
+                }
+                case json_number_kind::DOUBLE:
+                {
+                    write_floating_point(*static_cast<const double*>(address));
+                    break;
+                }
+                case json_number_kind::LONG_DOUBLE:
+                {
+                    write_floating_point(*static_cast<const long double*>(address));
+                    break;
+                }
+            }
+        }
+
+        void write_scalar(const void* address, const json_value_info& info)
+        {
+            switch (info.m_kind)
+            {
+                case json_value_kind::BOOLEAN:
+                {
+                    m_output += (*static_cast<const bool*>(address) ? "true" : "false");
+                    break;
+                }
+                case json_value_kind::NUMBER:
+                {
+                    write_number(address, info.m_number_kind);
+                    break;
+                }
+                case json_value_kind::ENUMERATION:
+                {
+                    const string_view name = info.m_enum_table->get_name(json_load_integer(address, info.m_number_kind));
+                    if (!name.empty())
+                        json_append_string(m_output, name);
+                    else
+                        write_number(address, info.m_number_kind);
+                    break;
+                }
+                case json_value_kind::STRING:
+                {
+                    const std::string& text = *static_cast<const std::string*>(address);
+                    json_append_string(m_output, string_view(text.data(), text.size()));
+                    break;
+                }
+                case json_value_kind::ARRAY:
+                case json_value_kind::OBJECT:
+                case json_value_kind::UNSUPPORTED:
+                {
+                    break;
+                }
+            }
+        }
+
+        void write_object(instance object, const json_plan& plan)
+        {
+            m_output += '{';
+            bool is_first = true;
+            for (const auto& field : plan.get_fields())
+            {
+                if (!is_first)
+                    m_output += ',';
+                is_first = false;
+
+                m_output += field.m_key;
+                if (is_scalar(field.m_value.m_kind))
+                {
+                    if (const void* address = field.m_wrapper->get_value_address(object))
+                    {
+                        write_scalar(address, field.m_value);
+                        continue;
+                    }
+                }
+
+                write_value(field.m_wrapper->get_ref(object), field.m_value);
+            }
+            m_output += '}';
+        }
+
+        void write_value(const variant_ref& value, const json_value_info& info)
+        {
+            if (info.m_kind == json_value_kind::ARRAY)
+                write_array(value.create_array_view());
+            else if (info.m_kind == json_value_kind::OBJECT)
+                write_object(instance(value), *info.m_plan);
+            else
+                write_scalar(get_object_address(instance(value)), info);
+        }
+
+        void write_array(const variant_array_view& view)
+        {
+            m_output += '[';
+            const json_value_info info = json_value_info::get(view.get_element_type());
+            if (info.m_kind != json_value_kind::UNSUPPORTED)
+            {
+                if (is_scalar(info.m_kind) && view.is_contiguous())
+                {
+                    const char* data = static_cast<const char*>(view.get_data());
+                    const std::size_t stride = view.get_stride();
+                    const std::size_t size = view.get_size();
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        if (i > 0)
+                            m_output += ',';
+                        write_scalar(data + i * stride, info);
+                    }
+                }
+                else
+                {
+                    bool is_first = true;
+                    for (auto itr = view.begin(), end = view.end(); itr != end; ++itr)
+                    {
+                        if (!is_first)
+                            m_output += ',';
+                        is_first = false;
+                        write_value(*itr, info);
+                    }
+                }
+            }
+            m_output += ']';
+        }
+
+    private:
+        std::string&        m_output;
+        const json_plan*    m_last_plan;
+        std::size_t         m_object_count;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_writer::json_writer(std::string& output)
+:   m_private(detail::make_unique<detail::json_writer_private>(output))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_writer::~json_writer()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool json_writer::write(const instance& object)
+{
+    return m_private->write(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
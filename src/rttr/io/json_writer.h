@@ -0,0 +1,111 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_JSON_WRITER_H_
+#define RTTR_JSON_WRITER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <memory>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+    class json_writer_private;
+}
+
+namespace io
+{
+
+/*!
+ * The \ref json_writer class writes the properties of reflected objects as JSON text.
+ *
+ * The objects are written directly, without building a document tree first. For every class, a plan is compiled once:
+ * the list of its non-static properties with their quoted names and the way, how each value is written.
+ * Arithmetic values, enumerations and strings are read directly from the object; no \ref variant is created for them.
+ * Only for properties, which are accessed via getter functions, a temporary value is created.
+ *
+ * \code{.cpp}
+ *  std::string text;
+ *  io::json_writer writer(text);
+ *  writer.write(order);    // {"id":42,"state":"shipped","items":[{"sku":"A-12","count":2}]}
+ * \endcode
+ *
+ * Format
+ * ------
+ * - `bool`: `true` or `false`
+ * - other arithmetic types: a number; not finite floating point values are written as `null`
+ * - enumerations: the name of the enumerator as string; a number, when the value has no name
+ * - `std::string`: a string
+ * - arrays: an array with the elements
+ * - classes: an object with the values of the properties, in the order of \ref type::get_properties()
+ *
+ * Pointers, wrappers, associative containers and static properties are not written.
+ * Every call of \ref write() appends one JSON object; consecutive objects are separated by a new line.
+ *
+ * \see json_reader
+ */
+class RTTR_API json_writer
+{
+    public:
+        /*!
+         * \brief Creates a writer, which appends the written objects to the given \p output.
+         *
+         * \remark The string has to outlive the writer.
+         */
+        explicit json_writer(std::string& output);
+
+        /*!
+         * \brief Destroys the writer.
+         */
+        ~json_writer();
+
+        /*!
+         * \brief Writes the properties of the given \p object as one JSON object.
+         *
+         * The plan of the \ref instance::get_derived_type() "most derived type" of \p object is used.
+         *
+         * \return True, when the object could be written; otherwise false, when \p object is invalid.
+         */
+        bool write(const instance& object);
+
+    private:
+        json_writer(const json_writer& other);
+        json_writer& operator=(const json_writer& other);
+
+        std::unique_ptr<detail::json_writer_private> m_private;
+};
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_JSON_WRITER_H_
@@ -0,0 +1,1038 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/io/registry_snapshot.h"
+
+#include "rttr/type.h"
+#include "rttr/enumeration.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const char       snapshot_magic[8]           = {'R', 'T', 'T', 'R', 'S', 'N', 'A', 'P'};
+static const uint32_t   snapshot_version            = 1;
+static const uint32_t   snapshot_byte_order_mark    = 0x01020304;
+static const uint32_t   snapshot_invalid_index      = 0xffffffff;
+
+enum snapshot_type_flags : uint32_t
+{
+    SNAPSHOT_CLASS                      = 1 << 0,
+    SNAPSHOT_ENUMERATION                = 1 << 1,
+    SNAPSHOT_ARRAY                      = 1 << 2,
+    SNAPSHOT_POINTER                    = 1 << 3,
+    SNAPSHOT_ARITHMETIC                 = 1 << 4,
+    SNAPSHOT_WRAPPER                    = 1 << 5,
+    SNAPSHOT_FUNCTION_POINTER           = 1 << 6,
+    SNAPSHOT_MEMBER_OBJECT_POINTER      = 1 << 7,
+    SNAPSHOT_MEMBER_FUNCTION_POINTER    = 1 << 8
+};
+
+enum snapshot_property_flags : uint32_t
+{
+    SNAPSHOT_READONLY                   = 1 << 0,
+    SNAPSHOT_STATIC                     = 1 << 1
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The start of every image. All offsets are relative to the begin of the image, all counts are numbers of records.
+ */
+struct snapshot_header
+{
+    char        m_magic[8];
+    uint32_t    m_version;
+    uint32_t    m_byte_order_mark;
+    uint32_t    m_image_size;
+    uint32_t    m_type_count;
+    uint32_t    m_type_offset;
+    uint32_t    m_bucket_count;
+    uint32_t    m_bucket_offset;
+    uint32_t    m_index_count;
+    uint32_t    m_index_offset;
+    uint32_t    m_property_count;
+    uint32_t    m_property_offset;
+    uint32_t    m_enum_count;
+    uint32_t    m_enum_offset;
+    uint32_t    m_string_size;
+    uint32_t    m_string_offset;
+};
+
+/*!
+ * One type; the base and derived classes are ranges in the index table, which holds type indices.
+ * Types with the same name hash bucket are chained via \p m_next_in_bucket.
+ */
+struct snapshot_type_record
+{
+    uint32_t    m_name_offset;
+    uint32_t    m_name_size;
+    uint32_t    m_name_hash;
+    uint32_t    m_next_in_bucket;
+    uint32_t    m_raw_type;
+    uint32_t    m_flags;
+    uint32_t    m_size;
+    uint32_t    m_base_begin;
+    uint32_t    m_base_count;
+    uint32_t    m_derived_begin;
+    uint32_t    m_derived_count;
+    uint32_t    m_property_begin;
+    uint32_t    m_property_count;
+    uint32_t    m_enum_begin;
+    uint32_t    m_enum_count;
+};
+
+struct snapshot_property_record
+{
+    uint32_t    m_name_offset;
+    uint32_t    m_name_size;
+    uint32_t    m_type;
+    uint32_t    m_declaring_type;
+    uint32_t    m_flags;
+};
+
+//! The value is split into two halves, so all records only need an alignment of four bytes.
+struct snapshot_enum_record
+{
+    uint32_t    m_name_offset;
+    uint32_t    m_name_size;
+    uint32_t    m_value_low;
+    uint32_t    m_value_high;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! FNV-1a with 32 bit, so the hash values in the image do not depend on the size of std::size_t.
+static uint32_t get_snapshot_hash(string_view name)
+{
+    uint32_t hash = 0x811c9dc5u;
+    for (const char c : name)
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x01000193u;
+
+    return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const snapshot_header& get_header(const char* image)
+{
+    return *reinterpret_cast<const snapshot_header*>(image);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const snapshot_type_record* get_type_record(const char* image, uint32_t index)
+{
+    if (!image || index >= get_header(image).m_type_count)
+        return nullptr;
+
+    return reinterpret_cast<const snapshot_type_record*>(image + get_header(image).m_type_offset) + index;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t get_type_index(const char* image, uint32_t table_index)
+{
+    return reinterpret_cast<const uint32_t*>(image + get_header(image).m_index_offset)[table_index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static string_view get_string(const char* image, uint32_t offset, uint32_t size)
+{
+    return string_view(image + get_header(image).m_string_offset + offset, size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const snapshot_enum_record* get_enum_record(const char* image, const snapshot_type_record* record, std::size_t index)
+{
+    if (!record || index >= record->m_enum_count)
+        return nullptr;
+
+    const auto* record_list = reinterpret_cast<const snapshot_enum_record*>(image + get_header(image).m_enum_offset);
+    return (record_list + record->m_enum_begin + index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_range_valid(uint64_t begin, uint64_t count, uint64_t total)
+{
+    return (begin <= total && count <= total - begin);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Checks, that all offsets and indices of the image are in range; afterwards, no access has to be checked again.
+static bool is_image_valid(const char* image, std::size_t size)
+{
+    if (size < sizeof(snapshot_header) || reinterpret_cast<uintptr_t>(image) % sizeof(uint32_t) != 0)
+        return false;
+
+    const snapshot_header& header = get_header(image);
+    if (std::memcmp(header.m_magic, snapshot_magic, sizeof(snapshot_magic)) != 0 ||
+        header.m_version != snapshot_version || header.m_byte_order_mark != snapshot_byte_order_mark ||
+        header.m_image_size > size)
+    {
+        return false;
+    }
+
+    const uint64_t image_size = header.m_image_size;
+    const uint32_t section_offsets[] = {header.m_type_offset, header.m_bucket_offset, header.m_index_offset,
+                                        header.m_property_offset, header.m_enum_offset};
+    for (const uint32_t offset : section_offsets)
+    {
+        if (offset % sizeof(uint32_t) != 0)
+            return false;
+    }
+
+    if (!is_range_valid(header.m_type_offset, uint64_t(header.m_type_count) * sizeof(snapshot_type_record), image_size) ||
+        !is_range_valid(header.m_bucket_offset, uint64_t(header.m_bucket_count) * sizeof(uint32_t), image_size) ||
+        !is_range_valid(header.m_index_offset, uint64_t(header.m_index_count) * sizeof(uint32_t), image_size) ||
+        !is_range_valid(header.m_property_offset, uint64_t(header.m_property_count) * sizeof(snapshot_property_record), image_size) ||
+        !is_range_valid(header.m_enum_offset, uint64_t(header.m_enum_count) * sizeof(snapshot_enum_record), image_size) ||
+        !is_range_valid(header.m_string_offset, header.m_string_size, image_size) ||
+        (header.m_type_count > 0 && header.m_bucket_count == 0))
+    {
+        return false;
+    }
+
+    const uint32_t type_count = header.m_type_count;
+    auto is_type_index_valid = [type_count](uint32_t index) { return (index < type_count); };
+
+    const uint32_t* bucket_list = reinterpret_cast<const uint32_t*>(image + header.m_bucket_offset);
+    for (uint32_t i = 0; i < header.m_bucket_count; ++i)
+    {
+        if (bucket_list[i] != snapshot_invalid_index && !is_type_index_valid(bucket_list[i]))
+            return false;
+    }
+
+    const uint32_t* index_list = reinterpret_cast<const uint32_t*>(image + header.m_index_offset);
+    for (uint32_t i = 0; i < header.m_index_count; ++i)
+    {
+        if (!is_type_index_valid(index_list[i]))
+            return false;
+    }
+
+    const snapshot_type_record* type_list = reinterpret_cast<const snapshot_type_record*>(image + header.m_type_offset);
+    for (uint32_t i = 0; i < type_count; ++i)
+    {
+        const snapshot_type_record& record = type_list[i];
+        if (!is_range_valid(record.m_name_offset, record.m_name_size, header.m_string_size) ||
+            (record.m_next_in_bucket != snapshot_invalid_index && !is_type_index_valid(record.m_next_in_bucket)) ||
+            !is_type_index_valid(record.m_raw_type) ||
+            !is_range_valid(record.m_base_begin, record.m_base_count, header.m_index_count) ||
+            !is_range_valid(record.m_derived_begin, record.m_derived_count, header.m_index_count) ||
+            !is_range_valid(record.m_property_begin, record.m_property_count, header.m_property_count) ||
+            !is_range_valid(record.m_enum_begin, record.m_enum_count, header.m_enum_count))
+        {
+            return false;
+        }
+    }
+
+    const snapshot_property_record* property_list = reinterpret_cast<const snapshot_property_record*>(image + header.m_property_offset);
+    for (uint32_t i = 0; i < header.m_property_count; ++i)
+    {
+        const snapshot_property_record& record = property_list[i];
+        if (!is_range_valid(record.m_name_offset, record.m_name_size, header.m_string_size) ||
+            !is_type_index_valid(record.m_type) || !is_type_index_valid(record.m_declaring_type))
+        {
+            return false;
+        }
+    }
+
+    const snapshot_enum_record* enum_list = reinterpret_cast<const snapshot_enum_record*>(image + header.m_enum_offset);
+    for (uint32_t i = 0; i < header.m_enum_count; ++i)
+    {
+        if (!is_range_valid(enum_list[i].m_name_offset, enum_list[i].m_name_size, header.m_string_size))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t get_snapshot_flags(const type& t)
+{
+    uint32_t flags = 0;
+    if (t.is_class())                       flags |= SNAPSHOT_CLASS;
+    if (t.is_enumeration())                 flags |= SNAPSHOT_ENUMERATION;
+    if (t.is_array())                       flags |= SNAPSHOT_ARRAY;
+    if (t.is_pointer())                     flags |= SNAPSHOT_POINTER;
+    if (t.is_arithmetic())                  flags |= SNAPSHOT_ARITHMETIC;
+    if (t.is_wrapper())                     flags |= SNAPSHOT_WRAPPER;
+    if (t.is_function_pointer())            flags |= SNAPSHOT_FUNCTION_POINTER;
+    if (t.is_member_object_pointer())       flags |= SNAPSHOT_MEMBER_OBJECT_POINTER;
+    if (t.is_member_function_pointer())     flags |= SNAPSHOT_MEMBER_FUNCTION_POINTER;
+    return flags;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static uint32_t append_records(std::vector<char>& buffer, const std::vector<T>& record_list)
+{
+    const uint32_t offset = static_cast<uint32_t>(buffer.size());
+    if (!record_list.empty())
+    {
+        const char* data = reinterpret_cast<const char*>(record_list.data());
+        buffer.insert(buffer.end(), data, data + record_list.size() * sizeof(T));
+    }
+    return offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class snapshot_string_table
+{
+    public:
+        void add(string_view text, uint32_t& offset, uint32_t& size)
+        {
+            offset = static_cast<uint32_t>(m_data.size());
+            size = static_cast<uint32_t>(text.size());
+            m_data.insert(m_data.end(), text.begin(), text.end());
+        }
+
+        const std::vector<char>& get_data() const { return m_data; }
+
+    private:
+        std::vector<char> m_data;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool create_image(std::vector<char>& buffer)
+{
+    const auto type_range = type::get_types();
+    std::vector<type> type_list(type_range.begin(), type_range.end());
+
+    std::vector<uint32_t> id_to_index;
+    for (std::size_t i = 0; i < type_list.size(); ++i)
+    {
+        const std::size_t id = type_list[i].get_id();
+        if (id >= id_to_index.size())
+            id_to_index.resize(id + 1, snapshot_invalid_index);
+        id_to_index[id] = static_cast<uint32_t>(i);
+    }
+
+    auto get_index = [&id_to_index](const type& t) -> uint32_t
+    {
+        const std::size_t id = t.get_id();
+        return (id < id_to_index.size() ? id_to_index[id] : snapshot_invalid_index);
+    };
+
+    snapshot_string_table string_table;
+    std::vector<snapshot_type_record> type_record_list(type_list.size());
+    std::vector<uint32_t> index_list;
+    std::vector<snapshot_property_record> property_record_list;
+    std::vector<snapshot_enum_record> enum_record_list;
+
+    const uint32_t bucket_count = static_cast<uint32_t>(type_list.size() > 0 ? type_list.size() * 2 : 1);
+    std::vector<uint32_t> bucket_list(bucket_count, snapshot_invalid_index);
+
+    auto append_type_indices = [&](const array_range<type>& range, uint32_t& begin, uint32_t& count)
+    {
+        begin = static_cast<uint32_t>(index_list.size());
+        for (const auto& t : range)
+        {
+            const uint32_t index = get_index(t);
+            if (index != snapshot_invalid_index)
+                index_list.push_back(index);
+        }
+        count = static_cast<uint32_t>(index_list.size()) - begin;
+    };
+
+    for (std::size_t i = 0; i < type_list.size(); ++i)
+    {
+        const type& t = type_list[i];
+        snapshot_type_record& record = type_record_list[i];
+        std::memset(&record, 0, sizeof(record));
+
+        const string_view name = t.get_name();
+        string_table.add(name, record.m_name_offset, record.m_name_size);
+        record.m_name_hash = get_snapshot_hash(name);
+
+        const uint32_t raw_index = get_index(t.get_raw_type());
+        record.m_raw_type = (raw_index != snapshot_invalid_index) ? raw_index : static_cast<uint32_t>(i);
+        record.m_flags = get_snapshot_flags(t);
+        record.m_size = static_cast<uint32_t>(t.get_sizeof());
+
+        append_type_indices(t.get_base_classes(), record.m_base_begin, record.m_base_count);
+        append_type_indices(t.get_derived_classes(), record.m_derived_begin, record.m_derived_count);
+
+        record.m_property_begin = static_cast<uint32_t>(property_record_list.size());
+        for (const auto& prop : t.get_properties())
+        {
+            const uint32_t type_index = get_index(prop.get_type());
+            const uint32_t declaring_index = get_index(prop.get_declaring_type());
+            if (type_index == snapshot_invalid_index || declaring_index == snapshot_invalid_index)
+                continue;
+
+            snapshot_property_record prop_record;
+            string_table.add(prop.get_name(), prop_record.m_name_offset, prop_record.m_name_size);
+            prop_record.m_type = type_index;
+            prop_record.m_declaring_type = declaring_index;
+            prop_record.m_flags = 0;
+            if (prop.is_readonly()) prop_record.m_flags |= SNAPSHOT_READONLY;
+            if (prop.is_static())   prop_record.m_flags |= SNAPSHOT_STATIC;
+            property_record_list.push_back(prop_record);
+        }
+        record.m_property_count = static_cast<uint32_t>(property_record_list.size()) - record.m_property_begin;
+
+        record.m_enum_begin = static_cast<uint32_t>(enum_record_list.size());
+        if (t.is_enumeration())
+        {
+            const enumeration enum_type = t.get_enumeration();
+            for (const auto& enum_name : enum_type.get_names())
+            {
+                bool ok = false;
+                const int64_t value = enum_type.name_to_value(enum_name).to_int64(&ok);
+                if (!ok)
+                    continue;
+
+                snapshot_enum_record enum_record;
+                string_table.add(enum_name, enum_record.m_name_offset, enum_record.m_name_size);
+                enum_record.m_value_low = static_cast<uint32_t>(static_cast<uint64_t>(value));
+                enum_record.m_value_high = static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32);
+                enum_record_list.push_back(enum_record);
+            }
+        }
+        record.m_enum_count = static_cast<uint32_t>(enum_record_list.size()) - record.m_enum_begin;
+    }
+
+    // the buckets are filled in reverse, so every chain holds its types in ascending order
+    for (std::size_t i = type_record_list.size(); i > 0; --i)
+    {
+        snapshot_type_record& record = type_record_list[i - 1];
+        const uint32_t bucket = record.m_name_hash % bucket_count;
+        record.m_next_in_bucket = bucket_list[bucket];
+        bucket_list[bucket] = static_cast<uint32_t>(i - 1);
+    }
+
+    snapshot_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, snapshot_magic, sizeof(snapshot_magic));
+    header.m_version            = snapshot_version;
+    header.m_byte_order_mark    = snapshot_byte_order_mark;
+    header.m_type_count         = static_cast<uint32_t>(type_record_list.size());
+    header.m_bucket_count       = bucket_count;
+    header.m_index_count        = static_cast<uint32_t>(index_list.size());
+    header.m_property_count     = static_cast<uint32_t>(property_record_list.size());
+    header.m_enum_count         = static_cast<uint32_t>(enum_record_list.size());
+    header.m_string_size        = static_cast<uint32_t>(string_table.get_data().size());
+
+    const uint64_t image_size = sizeof(header) + uint64_t(type_record_list.size()) * sizeof(snapshot_type_record) +
+                                uint64_t(bucket_list.size() + index_list.size()) * sizeof(uint32_t) +
+                                uint64_t(property_record_list.size()) * sizeof(snapshot_property_record) +
+                                uint64_t(enum_record_list.size()) * sizeof(snapshot_enum_record) + header.m_string_size;
+    if (image_size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    std::vector<char> image;
+    image.reserve(static_cast<std::size_t>(image_size));
+    image.resize(sizeof(header));
+    header.m_type_offset        = append_records(image, type_record_list);
+    header.m_bucket_offset      = append_records(image, bucket_list);
+    header.m_index_offset       = append_records(image, index_list);
+    header.m_property_offset    = append_records(image, property_record_list);
+    header.m_enum_offset        = append_records(image, enum_record_list);
+    header.m_string_offset      = append_records(image, string_table.get_data());
+    header.m_image_size         = static_cast<uint32_t>(image.size());
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    buffer.swap(image);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const char* map_file(const std::string& file_name, std::size_t& size)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    HANDLE file = ::CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER file_size;
+    const char* data = nullptr;
+    if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 &&
+        static_cast<uint64_t>(file_size.QuadPart) <= std::numeric_limits<std::size_t>::max())
+    {
+        // the view keeps the mapping alive, so both handles can be closed right away
+        HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            data = static_cast<const char*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = static_cast<std::size_t>(file_size.QuadPart);
+            ::CloseHandle(mapping);
+        }
+    }
+    ::CloseHandle(file);
+    return data;
+#else
+    const int file_descriptor = ::open(file_name.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+        return nullptr;
+
+    struct stat file_info;
+    const char* data = nullptr;
+    if (::fstat(file_descriptor, &file_info) == 0 && file_info.st_size > 0 &&
+        static_cast<uint64_t>(file_info.st_size) <= std::numeric_limits<std::size_t>::max())
+    {
+        size = static_cast<std::size_t>(file_info.st_size);
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (address != MAP_FAILED)
+            data = static_cast<const char*>(address);
+    }
+    // the mapping stays valid after closing the file
+    ::close(file_descriptor);
+    return data;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void unmap_file(const char* data, std::size_t size)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    (void)size;
+    ::UnmapViewOfFile(data);
+#else
+    ::munmap(const_cast<char*>(data), size);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_property::snapshot_property(const char* image, const detail::snapshot_property_record* record)
+:   m_image(image),
+    m_record(record)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_property::is_valid() const
+{
+    return (m_record != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view snapshot_property::get_name() const
+{
+    return (m_record ? detail::get_string(m_image, m_record->m_name_offset, m_record->m_name_size) : string_view());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type snapshot_property::get_type() const
+{
+    return (m_record ? snapshot_type(m_image, detail::get_type_record(m_image, m_record->m_type)) : snapshot_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type snapshot_property::get_declaring_type() const
+{
+    return (m_record ? snapshot_type(m_image, detail::get_type_record(m_image, m_record->m_declaring_type)) : snapshot_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_property::is_readonly() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_READONLY) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_property::is_static() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_STATIC) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type::snapshot_type()
+:   m_image(nullptr),
+    m_record(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type::snapshot_type(const char* image, const detail::snapshot_type_record* record)
+:   m_image(record ? image : nullptr),
+    m_record(record)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_valid() const
+{
+    return (m_record != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_index() const
+{
+    if (!m_record)
+        return 0;
+
+    return static_cast<std::size_t>(m_record - detail::get_type_record(m_image, 0));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view snapshot_type::get_name() const
+{
+    return (m_record ? detail::get_string(m_image, m_record->m_name_offset, m_record->m_name_size) : string_view());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type snapshot_type::get_raw_type() const
+{
+    return (m_record ? snapshot_type(m_image, detail::get_type_record(m_image, m_record->m_raw_type)) : snapshot_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_sizeof() const
+{
+    return (m_record ? m_record->m_size : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_class() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_CLASS) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_enumeration() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_ENUMERATION) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_array() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_ARRAY) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_pointer() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_POINTER) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_arithmetic() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_ARITHMETIC) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_wrapper() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_WRAPPER) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_function_pointer() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_FUNCTION_POINTER) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_member_object_pointer() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_MEMBER_OBJECT_POINTER) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_member_function_pointer() const
+{
+    return (m_record && (m_record->m_flags & detail::SNAPSHOT_MEMBER_FUNCTION_POINTER) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_base_class_count() const
+{
+    return (m_record ? m_record->m_base_count : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type snapshot_type::get_base_class(std::size_t index) const
+{
+    if (index >= get_base_class_count())
+        return snapshot_type();
+
+    const uint32_t type_index = detail::get_type_index(m_image, m_record->m_base_begin + static_cast<uint32_t>(index));
+    return snapshot_type(m_image, detail::get_type_record(m_image, type_index));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_derived_class_count() const
+{
+    return (m_record ? m_record->m_derived_count : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type snapshot_type::get_derived_class(std::size_t index) const
+{
+    if (index >= get_derived_class_count())
+        return snapshot_type();
+
+    const uint32_t type_index = detail::get_type_index(m_image, m_record->m_derived_begin + static_cast<uint32_t>(index));
+    return snapshot_type(m_image, detail::get_type_record(m_image, type_index));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::is_derived_from(const snapshot_type& other) const
+{
+    if (!m_record || !other.m_record)
+        return false;
+
+    if (*this == other)
+        return true;
+
+    for (std::size_t i = 0; i < get_base_class_count(); ++i)
+    {
+        if (get_base_class(i) == other)
+            return true;
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_property_count() const
+{
+    return (m_record ? m_record->m_property_count : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_property snapshot_type::get_property(std::size_t index) const
+{
+    if (index >= get_property_count())
+        return snapshot_property(nullptr, nullptr);
+
+    const auto& header = detail::get_header(m_image);
+    const auto* record_list = reinterpret_cast<const detail::snapshot_property_record*>(m_image + header.m_property_offset);
+    return snapshot_property(m_image, record_list + m_record->m_property_begin + index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_property snapshot_type::get_property(string_view name) const
+{
+    for (std::size_t i = 0; i < get_property_count(); ++i)
+    {
+        const snapshot_property prop = get_property(i);
+        if (prop.get_name() == name)
+            return prop;
+    }
+
+    return snapshot_property(nullptr, nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t snapshot_type::get_enum_count() const
+{
+    return (m_record ? m_record->m_enum_count : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view snapshot_type::get_enum_name(std::size_t index) const
+{
+    const auto* enum_record = detail::get_enum_record(m_image, m_record, index);
+    return (enum_record ? detail::get_string(m_image, enum_record->m_name_offset, enum_record->m_name_size) : string_view());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int64_t snapshot_type::get_enum_value(std::size_t index) const
+{
+    const auto* enum_record = detail::get_enum_record(m_image, m_record, index);
+    if (!enum_record)
+        return 0;
+
+    return static_cast<int64_t>((static_cast<uint64_t>(enum_record->m_value_high) << 32) | enum_record->m_value_low);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::operator==(const snapshot_type& other) const
+{
+    return (m_record == other.m_record);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool snapshot_type::operator!=(const snapshot_type& other) const
+{
+    return (m_record != other.m_record);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registry_snapshot::registry_snapshot()
+:   m_data(nullptr),
+    m_size(0),
+    m_is_mapped(false)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registry_snapshot::registry_snapshot(const void* data, std::size_t size)
+:   m_data(nullptr),
+    m_size(0),
+    m_is_mapped(false)
+{
+    set_image(static_cast<const char*>(data), size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registry_snapshot::registry_snapshot(registry_snapshot&& other)
+:   m_data(other.m_data),
+    m_size(other.m_size),
+    m_is_mapped(other.m_is_mapped)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_is_mapped = false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registry_snapshot& registry_snapshot::operator=(registry_snapshot&& other)
+{
+    if (this != &other)
+    {
+        close();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_is_mapped = other.m_is_mapped;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_is_mapped = false;
+    }
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registry_snapshot::~registry_snapshot()
+{
+    close();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registry_snapshot::save(std::vector<char>& buffer)
+{
+    return detail::create_image(buffer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registry_snapshot::save(const std::string& file_name)
+{
+    std::vector<char> buffer;
+    if (!detail::create_image(buffer))
+        return false;
+
+    std::FILE* file = std::fopen(file_name.c_str(), "wb");
+    if (!file)
+        return false;
+
+    const bool ok = (std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size());
+    return (std::fclose(file) == 0 && ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registry_snapshot::open(const std::string& file_name)
+{
+    close();
+
+    std::size_t size = 0;
+    const char* data = detail::map_file(file_name, size);
+    if (!data)
+        return false;
+
+    if (!set_image(data, size))
+    {
+        detail::unmap_file(data, size);
+        return false;
+    }
+
+    m_is_mapped = true;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registry_snapshot::close()
+{
+    if (m_is_mapped)
+        detail::unmap_file(m_data, m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_is_mapped = false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registry_snapshot::set_image(const char* data, std::size_t size)
+{
+    if (!data || !detail::is_image_valid(data, size))
+        return false;
+
+    m_data = data;
+    m_size = size;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registry_snapshot::is_valid() const
+{
+    return (m_data != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t registry_snapshot::get_type_count() const
+{
+    return (m_data ? detail::get_header(m_data).m_type_count : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type registry_snapshot::get_type(std::size_t index) const
+{
+    if (index >= get_type_count())
+        return snapshot_type();
+
+    return snapshot_type(m_data, detail::get_type_record(m_data, static_cast<uint32_t>(index)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+snapshot_type registry_snapshot::get_by_name(string_view name) const
+{
+    if (!m_data || get_type_count() == 0)
+        return snapshot_type();
+
+    const auto& header = detail::get_header(m_data);
+    const uint32_t hash = detail::get_snapshot_hash(name);
+    const uint32_t* bucket_list = reinterpret_cast<const uint32_t*>(m_data + header.m_bucket_offset);
+
+    // a corrupt chain could form a cycle, so it is never followed longer than the number of types
+    uint32_t index = bucket_list[hash % header.m_bucket_count];
+    for (uint32_t steps = 0; index != detail::snapshot_invalid_index && steps < header.m_type_count; ++steps)
+    {
+        const auto* record = detail::get_type_record(m_data, index);
+        if (record->m_name_hash == hash && detail::get_string(m_data, record->m_name_offset, record->m_name_size) == name)
+            return snapshot_type(m_data, record);
+
+        index = record->m_next_in_bucket;
+    }
+
+    return snapshot_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
@@ -0,0 +1,337 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_REGISTRY_SNAPSHOT_H_
+#define RTTR_REGISTRY_SNAPSHOT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+    struct snapshot_header;
+    struct snapshot_type_record;
+    struct snapshot_property_record;
+    struct snapshot_enum_record;
+}
+
+namespace io
+{
+
+class snapshot_type;
+class snapshot_property;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref snapshot_property class describes one property of a \ref snapshot_type.
+ *
+ * It is a light weight handle into the image of a \ref registry_snapshot; it is only valid as long as the snapshot is open.
+ */
+class RTTR_API snapshot_property
+{
+    public:
+        /*!
+         * \brief Returns true, when this object refers to a property of an image.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Returns the name of the property.
+         */
+        string_view get_name() const;
+
+        /*!
+         * \brief Returns the type of the property.
+         */
+        snapshot_type get_type() const;
+
+        /*!
+         * \brief Returns the class, which declared the property.
+         */
+        snapshot_type get_declaring_type() const;
+
+        /*!
+         * \brief Returns true, when the property is read only.
+         */
+        bool is_readonly() const;
+
+        /*!
+         * \brief Returns true, when the property is static.
+         */
+        bool is_static() const;
+
+    private:
+        snapshot_property(const char* image, const detail::snapshot_property_record* record);
+
+        friend class snapshot_type;
+
+        const char*                                 m_image;
+        const detail::snapshot_property_record*     m_record;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref snapshot_type class describes one type of a \ref registry_snapshot.
+ *
+ * It offers the read only part of the \ref type interface; every function directly reads from the image,
+ * without allocating memory. A \ref snapshot_type is a light weight handle, which can be copied freely;
+ * it is only valid as long as the snapshot is open.
+ */
+class RTTR_API snapshot_type
+{
+    public:
+        /*!
+         * \brief Creates an invalid snapshot_type.
+         */
+        snapshot_type();
+
+        /*!
+         * \brief Returns true, when this object refers to a type of an image.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Returns the index of the type in its snapshot.
+         */
+        std::size_t get_index() const;
+
+        /*!
+         * \brief Returns the name of the type, see \ref type::get_name().
+         */
+        string_view get_name() const;
+
+        /*!
+         * \brief Returns the raw type, see \ref type::get_raw_type().
+         */
+        snapshot_type get_raw_type() const;
+
+        /*!
+         * \brief Returns the size in bytes of the type, see \ref type::get_sizeof().
+         */
+        std::size_t get_sizeof() const;
+
+        bool is_class() const;
+        bool is_enumeration() const;
+        bool is_array() const;
+        bool is_pointer() const;
+        bool is_arithmetic() const;
+        bool is_wrapper() const;
+        bool is_function_pointer() const;
+        bool is_member_object_pointer() const;
+        bool is_member_function_pointer() const;
+
+        /*!
+         * \brief Returns the number of direct and indirect base classes, see \ref type::get_base_classes().
+         */
+        std::size_t get_base_class_count() const;
+
+        /*!
+         * \brief Returns the base class with the given \p index.
+         */
+        snapshot_type get_base_class(std::size_t index) const;
+
+        /*!
+         * \brief Returns the number of derived classes, see \ref type::get_derived_classes().
+         */
+        std::size_t get_derived_class_count() const;
+
+        /*!
+         * \brief Returns the derived class with the given \p index.
+         */
+        snapshot_type get_derived_class(std::size_t index) const;
+
+        /*!
+         * \brief Returns true, when this type is derived from \p other or is the same type.
+         */
+        bool is_derived_from(const snapshot_type& other) const;
+
+        /*!
+         * \brief Returns the number of properties of this type and all its base classes, see \ref type::get_properties().
+         */
+        std::size_t get_property_count() const;
+
+        /*!
+         * \brief Returns the property with the given \p index, in the order of \ref type::get_properties().
+         */
+        snapshot_property get_property(std::size_t index) const;
+
+        /*!
+         * \brief Returns the property with the given \p name, or an invalid property.
+         */
+        snapshot_property get_property(string_view name) const;
+
+        /*!
+         * \brief Returns the number of enumerators, when this type is an enumeration; otherwise zero.
+         */
+        std::size_t get_enum_count() const;
+
+        /*!
+         * \brief Returns the name of the enumerator with the given \p index.
+         */
+        string_view get_enum_name(std::size_t index) const;
+
+        /*!
+         * \brief Returns the value of the enumerator with the given \p index, converted to a 64 bit integer.
+         */
+        int64_t get_enum_value(std::size_t index) const;
+
+        bool operator==(const snapshot_type& other) const;
+        bool operator!=(const snapshot_type& other) const;
+
+    private:
+        snapshot_type(const char* image, const detail::snapshot_type_record* record);
+
+        friend class registry_snapshot;
+        friend class snapshot_property;
+
+        const char*                             m_image;
+        const detail::snapshot_type_record*     m_record;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref registry_snapshot class gives read only access to an image of the type registry.
+ *
+ * Tools, which only inspect the reflection data (e.g. schema dumpers, editors or code generators), would otherwise
+ * have to register all types on start up. Instead, a program with all registrations saves an image once,
+ * via \ref save(); the tools then open this image with \ref open(). The file is mapped into memory,
+ * so opening needs no parsing and all queries read directly from the mapped memory without allocations.
+ *
+ * \code{.cpp}
+ *  // in the program, which registered the types
+ *  io::registry_snapshot::save("types.rttr");
+ *
+ *  // in the tool
+ *  io::registry_snapshot snapshot;
+ *  if (snapshot.open("types.rttr"))
+ *  {
+ *      io::snapshot_type t = snapshot.get_by_name("MyStruct");
+ *      for (std::size_t i = 0; i < t.get_property_count(); ++i)
+ *          std::cout << t.get_property(i).get_name() << std::endl;
+ *  }
+ * \endcode
+ *
+ * The image contains the names, the flags and the size of all types, their base and derived classes,
+ * the names and types of their properties and the names and values of enumerations.
+ * All references inside the image are stored as offsets, so it can be mapped to any address.
+ * The image is bound to the byte order of the machine, which saved it.
+ */
+class RTTR_API registry_snapshot
+{
+    public:
+        /*!
+         * \brief Creates an empty snapshot.
+         */
+        registry_snapshot();
+
+        /*!
+         * \brief Creates a snapshot for the image in the given memory.
+         *
+         * \remark The memory is not copied; it has to outlive the snapshot and must be aligned to four bytes.
+         */
+        registry_snapshot(const void* data, std::size_t size);
+
+        registry_snapshot(registry_snapshot&& other);
+        registry_snapshot& operator=(registry_snapshot&& other);
+
+        /*!
+         * \brief Closes the snapshot.
+         */
+        ~registry_snapshot();
+
+        /*!
+         * \brief Writes an image of all currently registered types into \p buffer.
+         *
+         * \return True, when the image could be created; otherwise false.
+         */
+        static bool save(std::vector<char>& buffer);
+
+        /*!
+         * \brief Writes an image of all currently registered types into the file \p file_name.
+         *
+         * \return True, when the file could be written; otherwise false.
+         */
+        static bool save(const std::string& file_name);
+
+        /*!
+         * \brief Maps the image in the file \p file_name into memory. A previously opened image is closed.
+         *
+         * \return True, when the file contains a valid image; otherwise false.
+         */
+        bool open(const std::string& file_name);
+
+        /*!
+         * \brief Closes the image; all \ref snapshot_type objects of this snapshot become invalid.
+         */
+        void close();
+
+        /*!
+         * \brief Returns true, when the snapshot refers to a valid image.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Returns the number of types in the image.
+         */
+        std::size_t get_type_count() const;
+
+        /*!
+         * \brief Returns the type with the given \p index.
+         */
+        snapshot_type get_type(std::size_t index) const;
+
+        /*!
+         * \brief Returns the type with the given \p name, or an invalid type; see \ref type::get_by_name().
+         */
+        snapshot_type get_by_name(string_view name) const;
+
+    private:
+        registry_snapshot(const registry_snapshot& other);
+        registry_snapshot& operator=(const registry_snapshot& other);
+
+        bool set_image(const char* data, std::size_t size);
+
+        const char*     m_data;
+        std::size_t     m_size;
+        bool            m_is_mapped;
+};
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_REGISTRY_SNAPSHOT_H_
@@ -0,0 +1,137 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/metadata_key.h"
+
+#include "rttr/variant.h"
+#include "rttr/type.h"
+#include "rttr/detail/variant/variant_hash.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The hash and the equality of keys follow \ref variant_hash, except for enumerations:
+ * these are only equal to values of the same enumeration type,
+ * otherwise e.g. `compare_metadata::exclude` and `enumeration_metadata::flags` would be the same key.
+ */
+struct metadata_key_hash
+{
+    std::size_t operator()(const variant& key) const
+    {
+        const type t = key.get_type();
+        std::size_t seed = variant_hash(key);
+        if (t.is_enumeration())
+            seed ^= static_cast<std::size_t>(t.get_id()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+        return seed;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct metadata_key_equal
+{
+    bool operator()(const variant& lhs, const variant& rhs) const
+    {
+        const type lhs_type = lhs.get_type();
+        const type rhs_type = rhs.get_type();
+        if ((lhs_type.is_enumeration() || rhs_type.is_enumeration()) && lhs_type != rhs_type)
+            return false;
+
+        return variant_equal_as_key(lhs, rhs);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class metadata_key_table
+{
+    public:
+        static metadata_key_table& instance()
+        {
+            static metadata_key_table obj;
+            return obj;
+        }
+
+        std::uint32_t intern(const variant& key)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto ret = m_key_to_id.find(key);
+            if (ret != m_key_to_id.end())
+                return ret->second;
+
+            m_keys.push_back(key);
+            const auto id = static_cast<std::uint32_t>(m_keys.size());
+            m_key_to_id.insert(std::make_pair(key, id));
+            return id;
+        }
+
+        variant get_key(std::uint32_t id)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return (id > 0 && id <= m_keys.size()) ? m_keys[id - 1] : variant();
+        }
+
+    private:
+        std::mutex                                                                        m_mutex;
+        std::unordered_map<variant, std::uint32_t, metadata_key_hash, metadata_key_equal> m_key_to_id;
+        //! The key of id `n` is stored at index `n - 1`; the id `0` is reserved for invalid keys.
+        std::vector<variant>                                                              m_keys;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+metadata_key::metadata_key(const variant& key)
+:   m_id(key.is_valid() ? detail::metadata_key_table::instance().intern(key) : 0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant metadata_key::get_key() const
+{
+    return detail::metadata_key_table::instance().get_key(m_id);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,142 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METADATA_KEY_H_
+#define RTTR_METADATA_KEY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+
+namespace rttr
+{
+
+class variant;
+
+/*!
+ * The \ref metadata_key class represents an interned key of \ref rttr::metadata() "metadata".
+ *
+ * Every key, which is used during registration, gets a unique integer id.
+ * Creating a \ref metadata_key from a key returns this id, so that the lookup via
+ * \ref property::get_metadata(const metadata_key&) const "get_metadata(const metadata_key&)" compares
+ * only integers and does not need any comparison of \ref variant "variants".
+ *
+ * Arithmetic keys are equal, when they have the same numeric value (e.g. `1` and `1u`), string keys,
+ * when they have the same characters. Keys of enumeration type are only equal to values of the same enumeration.
+ * All other keys are compared as described in \ref variant_key_equal.
+ *
+ * A typical usage example is to create the key once and use it inside loops:
+ * \code{.cpp}
+ *  static const metadata_key serializable_key("serializable");
+ *
+ *  for (auto& prop : type::get<my_struct>().get_properties())
+ *  {
+ *      if (prop.get_metadata(serializable_key).to_bool())
+ *          write(prop);
+ *  }
+ * \endcode
+ *
+ * \remark Creating a \ref metadata_key is thread safe; but it involves a lookup in a global table.
+ *         So create it once and not for every call of `get_metadata()`.
+ */
+class RTTR_API metadata_key
+{
+    public:
+        /*!
+         * \brief Creates an invalid metadata_key.
+         */
+        metadata_key();
+
+        /*!
+         * \brief Creates a metadata_key from the given \p key.
+         *
+         * When the key was not used before, a new id will be assigned to it.
+         * An invalid \p key results in an invalid metadata_key.
+         */
+        explicit metadata_key(const variant& key);
+
+        /*!
+         * \brief Returns true, when this metadata_key is valid, otherwise false.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Convenience function to check if this metadata_key is valid or not.
+         */
+        explicit operator bool() const;
+
+        /*!
+         * \brief Returns the unique id of this key; `0` when the key is invalid.
+         */
+        std::uint32_t get_id() const;
+
+        /*!
+         * \brief Returns the original key, from which this metadata_key was created.
+         */
+        variant get_key() const;
+
+        /*!
+         * \brief Returns true when both metadata_key objects represent the same key.
+         */
+        bool operator==(const metadata_key& other) const;
+
+        /*!
+         * \brief Returns true when both metadata_key objects represent different keys.
+         */
+        bool operator!=(const metadata_key& other) const;
+
+    private:
+        std::uint32_t m_id;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE metadata_key::metadata_key() : m_id(0) { }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool metadata_key::is_valid() const { return (m_id != 0); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE metadata_key::operator bool() const { return (m_id != 0); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE std::uint32_t metadata_key::get_id() const { return m_id; }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool metadata_key::operator==(const metadata_key& other) const { return (m_id == other.m_id); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool metadata_key::operator!=(const metadata_key& other) const { return (m_id != other.m_id); }
+
+} // end namespace rttr
+
+#endif // RTTR_METADATA_KEY_H_
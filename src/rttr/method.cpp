@@ -150,6 +150,16 @@ variant method::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant method::get_metadata(const metadata_key& key) const
+{
+    if (is_valid())
+        return m_wrapper->get_metadata(key);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant method::invoke(instance object) const
 {
     if (is_valid())
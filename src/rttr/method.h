@@ -34,6 +34,7 @@
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/metadata_key.h"
 
 #include <string>
 #include <vector>
@@ -202,6 +203,19 @@ class RTTR_API method
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned key \p key.
+         *
+         * In contrast to \ref get_metadata(const variant&) const "get_metadata(const variant&)",
+         * only the integer ids of the keys are compared.
+         *
+         * \remark When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const metadata_key& key) const;
+
         /*!
          * \brief Invokes the method represented by the current instance \p object.
          *
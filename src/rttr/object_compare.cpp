@@ -0,0 +1,302 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/object_compare.h"
+
+#include "rttr/variant_ref.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/detail/type/compare_plan.h"
+#include "rttr/detail/type/type_database_p.h"
+#include "rttr/detail/type/type_hasher.h"
+#include "rttr/detail/misc/compare_equal.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE void hash_combine(std::size_t& seed, std::size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! FNV-1a with 64 bit, which adds eight bytes at once.
+static std::size_t hash_bytes(const void* data, std::size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = 14695981039346656037ULL;
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= (hash >> 32);
+    }
+
+    for (; size > 0; --size, ++bytes)
+        hash = (hash ^ *bytes) * 1099511628211ULL;
+
+    return static_cast<std::size_t>(hash);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the object, which is held by the pointer or wrapper, that \p object refers to; or \p object itself.
+static instance get_object_instance(const instance& object)
+{
+    instance wrapped = object.get_wrapped_instance();
+    return (wrapped.is_valid() ? wrapped : object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Hashes a value of type \p t at \p value, which is neither an array nor an object;
+ * for a pointer, \p value is the address it points to.
+ */
+static std::size_t hash_address(const void* value, const type& t, compare_value_kind kind, std::size_t size)
+{
+    if (kind == compare_value_kind::TRIVIAL)
+        return hash_bytes(value, size);
+    else if (kind == compare_value_kind::STRING)
+        return std::hash<std::string>()(*static_cast<const std::string*>(value));
+    else if (t.is_pointer())
+        return std::hash<const void*>()(value);
+    else if (const auto hasher = type_database::instance().get_hasher(t))
+        return hasher->hash(value);
+    else
+        return std::hash<type>()(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool address_equal(const void* lhs, const void* rhs, const type& t, compare_value_kind kind, std::size_t size)
+{
+    if (kind == compare_value_kind::TRIVIAL)
+        return trivial_equal(lhs, rhs, size);
+    else if (kind == compare_value_kind::STRING)
+        return (*static_cast<const std::string*>(lhs) == *static_cast<const std::string*>(rhs));
+    else if (t.is_pointer() || lhs == rhs)
+        return (lhs == rhs);
+    else
+        return compare_types_equal(lhs, rhs, t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t hash_object(instance& object, const compare_plan& plan);
+static std::size_t hash_array(const variant_array_view& view);
+
+static std::size_t hash_ref(const variant_ref& value, const type& t, compare_value_kind kind,
+                            std::size_t size, const compare_plan* plan)
+{
+    if (kind == compare_value_kind::ARRAY)
+        return hash_array(value.create_array_view());
+
+    instance object(value);
+    if (kind == compare_value_kind::OBJECT)
+        return hash_object(object, *plan);
+
+    return hash_address(get_object_address(object), t, kind, size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t hash_object(instance& object, const compare_plan& plan)
+{
+    std::size_t seed = 0;
+    for (const auto& step : plan.get_steps(object))
+    {
+        const compare_field& field = *step.m_field;
+        if (step.m_run_size)
+            hash_combine(seed, hash_bytes(field.m_wrapper->get_value_address(object), step.m_run_size));
+        else
+            hash_combine(seed, hash_ref(field.m_wrapper->get_ref(object), field.m_type, field.m_kind, field.m_size, field.m_plan));
+    }
+
+    return seed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t hash_array(const variant_array_view& view)
+{
+    const std::size_t size = view.get_size();
+    std::size_t seed = size;
+    if (size == 0)
+        return seed;
+
+    const type element_type = view.get_element_type();
+    const compare_value_kind kind = compare_plan::get_kind(element_type);
+    const std::size_t element_size = (kind == compare_value_kind::TRIVIAL) ? element_type.get_sizeof() : 0;
+    if (kind == compare_value_kind::TRIVIAL && view.is_contiguous() && view.get_stride() == element_size)
+    {
+        hash_combine(seed, hash_bytes(view.get_data(), size * element_size));
+        return seed;
+    }
+
+    const compare_plan* plan = (kind == compare_value_kind::OBJECT) ? &compare_plan::get(element_type) : nullptr;
+    for (const auto& element : view)
+        hash_combine(seed, hash_ref(element, element_type, kind, element_size, plan));
+
+    return seed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool objects_equal(instance& lhs, instance& rhs, const compare_plan& plan);
+static bool arrays_equal(const variant_array_view& lhs, const variant_array_view& rhs);
+
+static bool refs_equal(const variant_ref& lhs, const variant_ref& rhs, const type& t, compare_value_kind kind,
+                       std::size_t size, const compare_plan* plan)
+{
+    if (kind == compare_value_kind::ARRAY)
+        return arrays_equal(lhs.create_array_view(), rhs.create_array_view());
+
+    instance lhs_object(lhs);
+    instance rhs_object(rhs);
+    if (kind == compare_value_kind::OBJECT)
+        return objects_equal(lhs_object, rhs_object, *plan);
+
+    return address_equal(get_object_address(lhs_object), get_object_address(rhs_object), t, kind, size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool objects_equal(instance& lhs, instance& rhs, const compare_plan& plan)
+{
+    for (const auto& step : plan.get_steps(lhs))
+    {
+        const compare_field& field = *step.m_field;
+        if (step.m_run_size)
+        {
+            if (!trivial_equal(field.m_wrapper->get_value_address(lhs), field.m_wrapper->get_value_address(rhs), step.m_run_size))
+                return false;
+        }
+        else if (!refs_equal(field.m_wrapper->get_ref(lhs), field.m_wrapper->get_ref(rhs),
+                             field.m_type, field.m_kind, field.m_size, field.m_plan))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool arrays_equal(const variant_array_view& lhs, const variant_array_view& rhs)
+{
+    const std::size_t size = lhs.get_size();
+    if (size != rhs.get_size())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    const type element_type = lhs.get_element_type();
+    const compare_value_kind kind = compare_plan::get_kind(element_type);
+    const std::size_t element_size = (kind == compare_value_kind::TRIVIAL) ? element_type.get_sizeof() : 0;
+    if (kind == compare_value_kind::TRIVIAL && lhs.is_contiguous() && rhs.is_contiguous() &&
+        lhs.get_stride() == element_size && rhs.get_stride() == element_size)
+    {
+        return (std::memcmp(lhs.get_data(), rhs.get_data(), size * element_size) == 0);
+    }
+
+    const compare_plan* plan = (kind == compare_value_kind::OBJECT) ? &compare_plan::get(element_type) : nullptr;
+    for (auto lhs_itr = lhs.begin(), rhs_itr = rhs.begin(), end = lhs.end(); lhs_itr != end; ++lhs_itr, ++rhs_itr)
+    {
+        if (!refs_equal(*lhs_itr, *rhs_itr, element_type, kind, element_size, plan))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t hash_value(const instance& object)
+{
+    instance obj = detail::get_object_instance(object);
+    if (!obj.is_valid())
+        return 0;
+
+    const type t = obj.get_derived_type();
+    if (detail::compare_plan::get_kind(t) == detail::compare_value_kind::OBJECT)
+        return detail::hash_object(obj, detail::compare_plan::get(t));
+
+    // a value without properties is hashed as a whole
+    const type value_type = obj.get_type();
+    const detail::compare_value_kind kind = detail::compare_plan::get_kind(value_type);
+    return detail::hash_address(detail::get_object_address(obj), value_type, kind, value_type.get_sizeof());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool equals(const instance& lhs, const instance& rhs)
+{
+    instance lhs_obj = detail::get_object_instance(lhs);
+    instance rhs_obj = detail::get_object_instance(rhs);
+    if (!lhs_obj.is_valid() || !rhs_obj.is_valid())
+        return false;
+
+    const type t = lhs_obj.get_derived_type();
+    if (rhs_obj.get_derived_type() != t)
+        return false;
+
+    if (detail::compare_plan::get_kind(t) == detail::compare_value_kind::OBJECT)
+        return detail::objects_equal(lhs_obj, rhs_obj, detail::compare_plan::get(t));
+
+    // a value without properties is compared as a whole
+    const type value_type = lhs_obj.get_type();
+    if (rhs_obj.get_type() != value_type)
+        return false;
+
+    const detail::compare_value_kind kind = detail::compare_plan::get_kind(value_type);
+    return detail::address_equal(detail::get_object_address(lhs_obj), detail::get_object_address(rhs_obj),
+                                 value_type, kind, value_type.get_sizeof());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
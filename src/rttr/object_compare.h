@@ -0,0 +1,103 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_OBJECT_COMPARE_H_
+#define RTTR_OBJECT_COMPARE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref compare_metadata enum contains the keys of the \ref rttr::metadata() "metadata",
+ * which is evaluated by \ref hash_value() and \ref equals().
+ *
+ * A property is excluded from both functions, when it has the metadata `compare_metadata::exclude` with the value `true`:
+ *
+ * \code{.cpp}
+ *  registration::class_<mesh>("mesh")
+ *                  .property("vertices", &mesh::vertices)
+ *                  .property("gpu_buffer", &mesh::gpu_buffer)
+ *                  (
+ *                      metadata(compare_metadata::exclude, true)
+ *                  );
+ * \endcode
+ *
+ * \see hash_value(), equals()
+ */
+enum class compare_metadata
+{
+    /*!
+     * The property is not hashed and not compared.
+     */
+    exclude
+};
+
+/*!
+ * \brief Returns a hash value of the given \p object, which is computed from its properties.
+ *
+ * The object is hashed with the precompiled plan of its \ref instance::get_derived_type() "most derived type":
+ * every non-static property, which is not excluded with \ref compare_metadata::exclude, is hashed in the order
+ * of \ref type::get_properties(). Arithmetic values and enumerations are hashed by their bytes; the members,
+ * which are stored directly after each other in the object, are hashed in one pass. Strings are hashed by their
+ * characters, arrays by their elements and class members, which have registered properties, recursively.
+ * All other values are hashed with the function registered via \ref type::register_hasher(); pointers by their address.
+ *
+ * Two objects, which are \ref equals() "equal", have the same hash value.
+ *
+ * \return The hash value; `0`, when \p object is invalid.
+ *
+ * \see equals()
+ */
+RTTR_API std::size_t hash_value(const instance& object);
+
+/*!
+ * \brief Returns true, when the two objects \p lhs and \p rhs have the same \ref instance::get_derived_type() "most derived type"
+ *        and all of their properties are equal.
+ *
+ * The properties are compared in the same way, as they are hashed by \ref hash_value(): arithmetic values and
+ * enumerations, which are stored directly after each other in the object, are compared with one `memcmp`,
+ * contiguous arrays of arithmetic values as well. No \ref variant is created, except for properties, which are
+ * accessed via getter functions. All other values are compared like \ref variant::operator==() does it:
+ * with the comparator registered via \ref type::register_comparators(), otherwise by their bytes.
+ *
+ * \remark Floating point values are compared bitwise, like in \ref diff(); so `0.0` and `-0.0` are not equal,
+ *         while a `NaN` is equal to itself.
+ *
+ * \see hash_value()
+ */
+RTTR_API bool equals(const instance& lhs, const instance& rhs);
+
+} // end namespace rttr
+
+#endif // RTTR_OBJECT_COMPARE_H_
@@ -0,0 +1,102 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/object_pool.h"
+
+#include "rttr/type.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/detail/object_pool/object_pool_private.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_allocator::~object_allocator()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool::object_pool(std::size_t object_size, std::size_t alignment, std::size_t objects_per_chunk)
+:   m_private(detail::make_unique<detail::object_pool_private>(this, object_size, alignment, objects_per_chunk))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool::~object_pool()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* object_pool::allocate(std::size_t size, std::size_t alignment)
+{
+    if (!m_private->can_allocate(size, alignment))
+        return nullptr;
+
+    return m_private->allocate();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool::deallocate(void* ptr, std::size_t size, std::size_t alignment)
+{
+    if (ptr)
+        m_private->deallocate(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t object_pool::get_block_size() const
+{
+    return m_private->get_block_size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_statistics object_pool::get_statistics() const
+{
+    return m_private->get_statistics();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_statistics get_pool_statistics(const type& t)
+{
+    if (auto pool = detail::object_pool_private::find(t.get_allocator()))
+        return pool->get_statistics();
+
+    return pool_statistics();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
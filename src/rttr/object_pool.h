@@ -0,0 +1,180 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_OBJECT_POOL_H_
+#define RTTR_OBJECT_POOL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace rttr
+{
+class type;
+
+namespace detail
+{
+    class object_pool_private;
+}
+
+/*!
+ * The \ref object_allocator class is the interface for the memory of objects, which are created
+ * via a constructor with the policy \ref policy::ctor::as_raw_ptr or \ref policy::ctor::as_pooled.
+ *
+ * An allocator can be assigned to a type with \ref type::set_allocator(); afterwards these constructors
+ * place their objects in the memory of \ref allocate() and the registered \ref destructor releases it again
+ * via \ref deallocate().
+ *
+ * \see object_pool
+ */
+class RTTR_API object_allocator
+{
+    public:
+        virtual ~object_allocator();
+
+        /*!
+         * \brief Returns memory for one object with \p size bytes, which is aligned to \p alignment.
+         *
+         * \return A pointer to the memory; `nullptr`, when no memory could be provided.
+         */
+        virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+        /*!
+         * \brief Releases the memory at \p ptr, which was returned by \ref allocate() with the same \p size and \p alignment.
+         */
+        virtual void deallocate(void* ptr, std::size_t size, std::size_t alignment) = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref pool_statistics struct contains the counters of an \ref object_pool.
+ *
+ * \see object_pool::get_statistics(), get_pool_statistics()
+ */
+struct pool_statistics
+{
+    std::size_t m_block_size            = 0;    //!< The size in bytes of one block of the pool.
+    std::size_t m_allocation_count      = 0;    //!< The number of all allocations.
+    std::size_t m_deallocation_count    = 0;    //!< The number of all deallocations.
+    std::size_t m_live_count            = 0;    //!< The number of blocks, which are currently in use.
+    std::size_t m_free_count            = 0;    //!< The number of blocks, which are ready for reuse.
+    std::size_t m_chunk_count           = 0;    //!< The number of chunks, which were requested from the system.
+    std::size_t m_reserved_bytes        = 0;    //!< The number of bytes of all chunks.
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref object_pool class is an \ref object_allocator for objects of one fixed size.
+ *
+ * The memory is requested in chunks of several blocks from the system; released blocks are not given back,
+ * until the pool is destroyed, instead they are reused for the next allocations.
+ * Every thread keeps its own list of free blocks, so allocating and releasing does not need a lock in most cases.
+ * Only when the list of a thread is empty or grows too long, blocks are exchanged with a list, which is shared by all threads.
+ * The free blocks of a thread are handed over to the shared list, when the thread exits.
+ *
+ * A pool for every type, which has a constructor with the policy \ref policy::ctor::as_pooled, is created automatically.
+ *
+ * See following example code:
+ * \code{.cpp}
+ *   object_pool pool(type::get<particle>().get_sizeof(), type::get<particle>().get_alignof(), 1024);
+ *   type::get<particle>().set_allocator(&pool);
+ *
+ *   variant obj = type::get<particle>().create();   // contains a 'particle*', which was allocated from 'pool'
+ *   type::get<particle>().destroy(obj);             // the memory is given back to 'pool'
+ *
+ *   std::cout << pool.get_statistics().m_live_count; // prints '0'
+ * \endcode
+ *
+ * \remark The pool has to outlive all objects, which were allocated from it.
+ *         Without support for `thread_local` by the compiler, all threads use the shared list.
+ */
+class RTTR_API object_pool : public object_allocator
+{
+    public:
+        /*!
+         * \brief Creates a pool for objects with \p object_size bytes and the alignment \p alignment.
+         *
+         * The memory is requested in chunks of \p objects_per_chunk objects.
+         */
+        object_pool(std::size_t object_size, std::size_t alignment, std::size_t objects_per_chunk = 64);
+
+        /*!
+         * \brief Releases all memory of the pool.
+         */
+        ~object_pool();
+
+        /*!
+         * \brief Returns a free block of the pool.
+         *
+         * \return A pointer to the block; `nullptr`, when \p size or \p alignment is larger than the one of the pool.
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /*!
+         * \brief Puts the block \p ptr back into the free list of the current thread.
+         */
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment);
+
+        /*!
+         * \brief Returns the size in bytes of one block of the pool.
+         *
+         * \return The block size.
+         */
+        std::size_t get_block_size() const;
+
+        /*!
+         * \brief Returns the current counters of the pool.
+         *
+         * \remark The counters are updated concurrently, so the values are only a snapshot,
+         *         when the pool is used by several threads.
+         *
+         * \return The statistics of the pool.
+         */
+        pool_statistics get_statistics() const;
+
+    private:
+        object_pool(const object_pool& other);
+        object_pool& operator=(const object_pool& other);
+
+        std::unique_ptr<detail::object_pool_private> m_private;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns the statistics of the allocator of type \p t, when it is an \ref object_pool.
+ *
+ * \return The statistics of the pool; all counters are zero, when \p t has no pool.
+ */
+RTTR_API pool_statistics get_pool_statistics(const type& t);
+
+} // end namespace rttr
+
+#endif // RTTR_OBJECT_POOL_H_
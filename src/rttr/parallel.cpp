@@ -0,0 +1,307 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/parallel.h"
+
+#include "rttr/type.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/detail/parallel/thread_pool_private.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+using element_func  = std::function<void(std::size_t, const variant_ref&)>;
+using chunk_func    = std::function<void(std::size_t, const variant_array_view&)>;
+using visitor_func  = std::function<void(const instance&, const property&, const variant_ref&)>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Contains the partitioning logic of the parallel functions.
+ */
+class parallel_executor
+{
+    public:
+        static thread_pool_private& get_pool(parallel::thread_pool& pool)
+        {
+            return *pool.m_private;
+        }
+
+        //! Returns the number of elements per task; every thread gets a few tasks, so idle threads can steal the remaining ones.
+        static std::size_t get_chunk_size(std::size_t size, std::size_t thread_count, std::size_t min_chunk_size)
+        {
+            const std::size_t task_count = (thread_count + 1) * 4;
+            return std::max(min_chunk_size, (size + task_count - 1) / task_count);
+        }
+
+        static void for_each_chunk(const variant_array_view& array, const chunk_func& func, std::size_t chunk_size, thread_pool_private& pool)
+        {
+            const std::size_t size = array.get_size();
+            if (size == 0)
+                return;
+
+            // the slice of a node based container has to step over all preceding elements, so it is not partitioned
+            if (!array.is_contiguous() || size <= chunk_size)
+            {
+                func(0, array);
+                return;
+            }
+
+            task_group group(pool);
+            for (std::size_t offset = 0; offset < size; offset += chunk_size)
+            {
+                const std::size_t end = std::min(offset + chunk_size, size);
+                group.run([&array, &func, offset, end]() { func(offset, array.slice(offset, end)); });
+            }
+            group.wait();
+        }
+
+        static void for_each(const variant_array_view& array, const element_func& func, std::size_t min_chunk_size, thread_pool_private& pool)
+        {
+            const std::size_t size = array.get_size();
+            if (size == 0)
+                return;
+
+            const std::size_t chunk_size = get_chunk_size(size, pool.get_thread_count(), min_chunk_size);
+            if (array.is_contiguous())
+            {
+                for_each_chunk(array, [&func](std::size_t offset, const variant_array_view& chunk)
+                {
+                    for (auto itr = chunk.begin(), end = chunk.end(); itr != end; ++itr, ++offset)
+                        func(offset, *itr);
+                }, chunk_size, pool);
+                return;
+            }
+
+            // node based container: the calling thread walks once over the elements
+            // and hands every chunk over to the pool, as soon as its first element is reached
+            task_group group(pool);
+            auto itr = array.begin();
+            for (std::size_t offset = 0; offset < size; offset += chunk_size)
+            {
+                const std::size_t count = std::min(chunk_size, size - offset);
+                group.run([&func, itr, offset, count]()
+                {
+                    auto current = itr;
+                    for (std::size_t i = 0; i < count; ++i, ++current)
+                        func(offset + i, *current);
+                });
+
+                for (std::size_t i = 0; i < count; ++i)
+                    ++itr;
+            }
+            group.wait();
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Visits the properties of an object graph; see \ref parallel::for_each_property().
+ *
+ * Objects, which are reached via a pointer or a wrapper, are recorded in a set, so shared and cyclic references
+ * are visited only once. Objects, which are embedded by value, cannot be reached twice and are therefore not recorded.
+ */
+class object_graph_walker
+{
+    public:
+        object_graph_walker(thread_pool_private& pool, const visitor_func& visitor)
+        :   m_pool(pool),
+            m_visitor(visitor)
+        {
+        }
+
+        void walk_root(const instance& object)
+        {
+            if (object.is_valid() && mark_visited(object))
+                walk(object);
+        }
+
+    private:
+        using visited_key = std::pair<const void*, type::type_id>;
+
+        struct visited_key_hash
+        {
+            std::size_t operator()(const visited_key& key) const
+            {
+                return (std::hash<const void*>()(key.first) ^ static_cast<std::size_t>(key.second));
+            }
+        };
+
+        //! The set of visited objects is split, so the threads rarely wait for each other.
+        struct visited_bucket
+        {
+            std::mutex                                          m_mutex;
+            std::unordered_set<visited_key, visited_key_hash>   m_objects;
+        };
+
+        static bool may_contain_objects(const type& t)
+        {
+            if (t.is_array() || t.is_wrapper())
+                return true;
+
+            const type raw_type = t.get_raw_type();
+            return (raw_type.is_class() && raw_type != type::get<std::string>());
+        }
+
+        bool mark_visited(const instance& object)
+        {
+            const void* address = get_object_address(object);
+            const visited_key key(address, object.get_derived_type().get_id());
+            // the lower bits of an address are mostly equal, because of the alignment
+            auto& bucket = m_visited[(reinterpret_cast<std::uintptr_t>(address) >> 4) % m_visited.size()];
+
+            std::lock_guard<std::mutex> lock(bucket.m_mutex);
+            return bucket.m_objects.insert(key).second;
+        }
+
+        void walk(const instance& object)
+        {
+            task_group group(m_pool);
+            for (const auto& prop : object.get_derived_type().get_properties())
+            {
+                const variant_ref value = prop.get_ref(object);
+                m_visitor(object, prop, value);
+
+                // sibling sub objects are independent from each other
+                if (value.is_valid() && may_contain_objects(value.get_type()))
+                    group.run([this, value]() { visit_value(value); });
+            }
+            group.wait();
+        }
+
+        void visit_value(const variant_ref& value)
+        {
+            if (value.is_array())
+            {
+                const variant_array_view view = value.create_array_view();
+                if (may_contain_objects(view.get_element_type()))
+                    parallel_executor::for_each(view, [this](std::size_t, const variant_ref& item) { visit_value(item); }, 1, m_pool);
+
+                return;
+            }
+
+            const type value_type = value.get_type();
+            const instance object = value_type.is_wrapper() ? instance(value).get_wrapped_instance() : instance(value);
+            if (!object.is_valid())
+                return;
+
+            if ((value_type.is_pointer() || value_type.is_wrapper()) && !mark_visited(object))
+                return;
+
+            walk(object);
+        }
+
+    private:
+        thread_pool_private&            m_pool;
+        const visitor_func&             m_visitor;
+        std::array<visited_bucket, 16>  m_visited;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+namespace parallel
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t default_min_chunk_size = 256;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+thread_pool::thread_pool(std::size_t thread_count)
+:   m_private(detail::make_unique<detail::thread_pool_private>(thread_count > 0 ? thread_count
+                                                                                 : std::max(std::thread::hardware_concurrency(), 1u)))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+thread_pool::~thread_pool()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t thread_pool::get_thread_count() const
+{
+    return m_private->get_thread_count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+thread_pool& thread_pool::get_default()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void for_each(const variant_array_view& array, const std::function<void(std::size_t, const variant_ref&)>& func, thread_pool& pool)
+{
+    detail::parallel_executor::for_each(array, func, default_min_chunk_size, detail::parallel_executor::get_pool(pool));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void for_each_chunk(const variant_array_view& array, const std::function<void(std::size_t, const variant_array_view&)>& func,
+                    std::size_t chunk_size, thread_pool& pool)
+{
+    auto& pool_private = detail::parallel_executor::get_pool(pool);
+    if (chunk_size == 0)
+        chunk_size = detail::parallel_executor::get_chunk_size(array.get_size(), pool_private.get_thread_count(), default_min_chunk_size);
+
+    detail::parallel_executor::for_each_chunk(array, func, chunk_size, pool_private);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void for_each_property(const instance& object, const std::function<void(const instance&, const property&, const variant_ref&)>& visitor,
+                       thread_pool& pool)
+{
+    detail::object_graph_walker walker(detail::parallel_executor::get_pool(pool), visitor);
+    walker.walk_root(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace parallel
+} // end namespace rttr
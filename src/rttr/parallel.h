@@ -0,0 +1,187 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_PARALLEL_H_
+#define RTTR_PARALLEL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace rttr
+{
+namespace detail
+{
+    class thread_pool_private;
+    class parallel_executor;
+}
+
+namespace parallel
+{
+
+/*!
+ * The \ref thread_pool class owns a fixed number of worker threads, which execute the tasks of the
+ * functions in the namespace \ref rttr::parallel.
+ *
+ * Every worker has its own task queue. Tasks, which are spawned inside a task, are put into the queue of the
+ * current worker; a worker without any work left steals tasks from the queues of the others.
+ * The thread, which calls one of the parallel functions, takes part in the work too, until all tasks are finished.
+ *
+ * A default pool with one thread per hardware thread is available via \ref get_default().
+ *
+ * \remark The pool has to outlive all parallel calls, which use it.
+ */
+class RTTR_API thread_pool
+{
+    public:
+        /*!
+         * \brief Creates a pool with \p thread_count worker threads.
+         *
+         * When \p thread_count is `0`, one thread per hardware thread will be created.
+         */
+        explicit thread_pool(std::size_t thread_count = 0);
+
+        /*!
+         * \brief Waits until all worker threads have finished their current task and destroys them.
+         */
+        ~thread_pool();
+
+        /*!
+         * \brief Returns the number of worker threads of this pool.
+         *
+         * \return The number of worker threads.
+         */
+        std::size_t get_thread_count() const;
+
+        /*!
+         * \brief Returns the pool, which is used, when no pool is given to a parallel function.
+         *
+         * The pool will be created with the first call of this function.
+         *
+         * \return The default thread pool.
+         */
+        static thread_pool& get_default();
+
+    private:
+        thread_pool(const thread_pool& other);
+        thread_pool& operator=(const thread_pool& other);
+
+        friend class detail::parallel_executor;
+
+        std::unique_ptr<detail::thread_pool_private> m_private;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Calls \p func for every element of the first dimension of \p array, with its index and a reference to the element.
+ *
+ * The elements are processed in parallel by the threads of \p pool. A \ref variant_array_view::is_contiguous() "contiguous" array
+ * is partitioned into \ref variant_array_view::slice() "slices" of equal size, which are processed independently.
+ * A node based container is traversed once by the calling thread, while the already reached parts are processed by the pool.
+ *
+ * \code{.cpp}
+ *  std::vector<double> values = load_values();
+ *  variant var = &values;
+ *  std::atomic<int> invalid_count(0);
+ *  parallel::for_each(var.create_array_view(), [&](std::size_t index, const variant_ref& value)
+ *  {
+ *      if (std::isnan(value.get_value<double>()))
+ *          ++invalid_count;
+ *  });
+ * \endcode
+ *
+ * \remark \p func is called concurrently from different threads, so it has to be thread safe.
+ *         The array must not be resized, until the function returns.
+ *         When \p func throws an exception, the remaining elements might be skipped;
+ *         the first exception is rethrown, after all running tasks are finished.
+ */
+RTTR_API void for_each(const variant_array_view& array, const std::function<void(std::size_t, const variant_ref&)>& func,
+                       thread_pool& pool = thread_pool::get_default());
+
+/*!
+ * \brief Partitions the first dimension of \p array into \ref variant_array_view::slice() "slices" of \p chunk_size elements
+ *        and calls \p func for every slice in parallel, together with the index of its first element.
+ *
+ * This is the fastest way to process a big \ref variant_array_view::is_contiguous() "contiguous" array,
+ * because \p func can access the elements of a slice directly via \ref variant_array_view::get_data().
+ * When \p chunk_size is `0`, the array will be partitioned into a few chunks per thread.
+ *
+ * \code{.cpp}
+ *  std::vector<float> samples = load_samples();
+ *  variant var = &samples;
+ *  std::atomic<std::uint64_t> checksum(0);
+ *  parallel::for_each_chunk(var.create_array_view(), [&](std::size_t offset, const variant_array_view& chunk)
+ *  {
+ *      checksum += compute_checksum(chunk.get_data(), chunk.get_size() * chunk.get_stride());
+ *  });
+ * \endcode
+ *
+ * \remark An array, which is not contiguous, will not be partitioned; then \p func is called once with the whole array.
+ *         \p func is called concurrently from different threads, so it has to be thread safe.
+ */
+RTTR_API void for_each_chunk(const variant_array_view& array, const std::function<void(std::size_t, const variant_array_view&)>& func,
+                             std::size_t chunk_size = 0, thread_pool& pool = thread_pool::get_default());
+
+/*!
+ * \brief Visits all properties of \p object and of every object, which is reachable from it.
+ *
+ * For every property, \p visitor is called with the object, the property and a \ref property::get_ref() "reference" to its value.
+ * Afterwards, the walker descends into the value, when it is an object of a class type, a pointer or a
+ * \ref type::is_wrapper() "wrapper" to such an object, or an array of them. The properties are taken from the
+ * \ref instance::get_derived_type() "most derived type" of every object.
+ *
+ * The sub objects of one object are visited in parallel; elements of big arrays of objects are processed in chunks.
+ * An object, which is reachable via several pointers, will be visited only once; so cyclic object graphs are supported.
+ * However, an object which is a member of another object and is additionally referenced by a pointer, will be visited twice.
+ *
+ * \code{.cpp}
+ *  parallel::for_each_property(scene, [&](const instance& obj, const property& prop, const variant_ref& value)
+ *  {
+ *      if (!is_valid_value(prop, value))
+ *          report_error(obj.get_derived_type(), prop.get_name());
+ *  });
+ * \endcode
+ *
+ * \remark \p visitor is called concurrently from different threads, so it has to be thread safe.
+ *         The visited objects must not be modified, until the function returns.
+ */
+RTTR_API void for_each_property(const instance& object,
+                                const std::function<void(const instance&, const property&, const variant_ref&)>& visitor,
+                                thread_pool& pool = thread_pool::get_default());
+
+} // end namespace parallel
+} // end namespace rttr
+
+#endif // RTTR_PARALLEL_H_
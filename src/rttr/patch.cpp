@@ -0,0 +1,345 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/patch.h"
+
+#include "rttr/detail/io/binary_writer_p.h"
+#include "rttr/detail/io/binary_reader_p.h"
+#include "rttr/detail/type/compare_plan.h"
+
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t g_patch_header_size = sizeof(uint64_t);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE void write_patch_index(std::vector<char>& buffer, std::size_t index)
+{
+    uint64_t value = static_cast<uint64_t>(index);
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool read_patch_index(binary_source& source, std::size_t& index)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        unsigned char byte = 0;
+        if (!source.read(&byte, 1))
+            return false;
+
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            if (value > static_cast<uint64_t>(SIZE_MAX))
+                return false;
+
+            index = static_cast<std::size_t>(value);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool objects_equal(instance lhs, instance rhs, const binary_plan& plan);
+static bool arrays_equal(const variant_array_view& lhs, const variant_array_view& rhs);
+
+static bool values_equal(const variant_ref& lhs, const variant_ref& rhs, binary_value_kind kind,
+                         std::size_t size, const binary_plan* plan)
+{
+    switch (kind)
+    {
+        case binary_value_kind::TRIVIAL:
+        {
+            return trivial_equal(get_object_address(instance(lhs)), get_object_address(instance(rhs)), size);
+        }
+        case binary_value_kind::STRING:
+        {
+            return (*static_cast<const std::string*>(get_object_address(instance(lhs))) ==
+                    *static_cast<const std::string*>(get_object_address(instance(rhs))));
+        }
+        case binary_value_kind::ARRAY:
+        {
+            return arrays_equal(lhs.create_array_view(), rhs.create_array_view());
+        }
+        case binary_value_kind::OBJECT:
+        {
+            return objects_equal(instance(lhs), instance(rhs), *plan);
+        }
+        case binary_value_kind::UNSUPPORTED:
+        {
+            return true;
+        }
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Compares one property of two objects; the value is only copied, when it is returned by a getter function.
+static bool fields_equal(instance& lhs, instance& rhs, const binary_field& field)
+{
+    if (field.m_kind == binary_value_kind::TRIVIAL || field.m_kind == binary_value_kind::STRING)
+    {
+        const void* lhs_address = field.m_wrapper->get_value_address(lhs);
+        const void* rhs_address = field.m_wrapper->get_value_address(rhs);
+        if (lhs_address && rhs_address)
+        {
+            if (field.m_kind == binary_value_kind::TRIVIAL)
+                return trivial_equal(lhs_address, rhs_address, field.m_size);
+            else
+                return (*static_cast<const std::string*>(lhs_address) == *static_cast<const std::string*>(rhs_address));
+        }
+    }
+
+    return values_equal(field.m_wrapper->get_ref(lhs), field.m_wrapper->get_ref(rhs), field.m_kind, field.m_size, field.m_plan);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool objects_equal(instance lhs, instance rhs, const binary_plan& plan)
+{
+    for (const auto& field : plan.get_fields())
+    {
+        if (!fields_equal(lhs, rhs, field))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool arrays_equal(const variant_array_view& lhs, const variant_array_view& rhs)
+{
+    const std::size_t size = lhs.get_size();
+    if (size != rhs.get_size())
+        return false;
+
+    const type element_type = lhs.get_element_type();
+    const binary_value_kind kind = binary_plan::get_kind(element_type);
+    if (size == 0 || kind == binary_value_kind::UNSUPPORTED)
+        return true;
+
+    const std::size_t element_size = (kind == binary_value_kind::TRIVIAL) ? element_type.get_sizeof() : 0;
+    if (kind == binary_value_kind::TRIVIAL && lhs.is_contiguous() && rhs.is_contiguous() &&
+        lhs.get_stride() == element_size && rhs.get_stride() == element_size)
+    {
+        return (std::memcmp(lhs.get_data(), rhs.get_data(), size * element_size) == 0);
+    }
+
+    const binary_plan* plan = (kind == binary_value_kind::OBJECT) ? &binary_plan::get(element_type) : nullptr;
+    for (auto lhs_itr = lhs.begin(), rhs_itr = rhs.begin(), end = lhs.end(); lhs_itr != end; ++lhs_itr, ++rhs_itr)
+    {
+        if (!values_equal(*lhs_itr, *rhs_itr, kind, element_size, plan))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the changed properties of \p to into \p buffer; returns false, when nothing changed.
+ * A changed class member is written as the nested list of its own changes.
+ */
+static bool diff_object(instance from, instance to, const binary_plan& plan,
+                        std::vector<char>& buffer, binary_writer_private& writer)
+{
+    const std::size_t start = buffer.size();
+    std::size_t index = 0;
+    for (const auto& field : plan.get_fields())
+    {
+        ++index;
+        if (field.m_is_readonly || field.m_kind == binary_value_kind::UNSUPPORTED)
+            continue;
+
+        if (field.m_kind == binary_value_kind::OBJECT)
+        {
+            const std::size_t field_start = buffer.size();
+            write_patch_index(buffer, index);
+            if (!diff_object(instance(field.m_wrapper->get_ref(from)), instance(field.m_wrapper->get_ref(to)),
+                             *field.m_plan, buffer, writer))
+            {
+                buffer.resize(field_start);
+            }
+        }
+        else if (!fields_equal(from, to, field))
+        {
+            write_patch_index(buffer, index);
+            writer.write_field(to, field);
+        }
+    }
+
+    const bool changed = (buffer.size() != start);
+    write_patch_index(buffer, 0);
+    return changed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool apply_object(instance object, const binary_plan& plan, binary_reader_private& reader)
+{
+    const auto& fields = plan.get_fields();
+    std::size_t index = 0;
+    while (read_patch_index(reader.get_source(), index) && index != 0)
+    {
+        if (index > fields.size())
+            return false;
+
+        const binary_field& field = fields[index - 1];
+        if (field.m_is_readonly || field.m_kind == binary_value_kind::UNSUPPORTED)
+            return false;
+
+        if (field.m_kind != binary_value_kind::OBJECT)
+        {
+            if (!reader.read_field(object, field))
+                return false;
+        }
+        else if (field.m_wrapper->get_value_address(object))
+        {
+            if (!apply_object(instance(field.m_wrapper->get_ref(object)), *field.m_plan, reader))
+                return false;
+        }
+        else
+        {
+            // the member is returned by a getter; the changes are applied to a copy, which is set afterwards
+            variant value = field.m_wrapper->get_value(object);
+            if (!value.is_valid() || !apply_object(instance(value), *field.m_plan, reader))
+                return false;
+
+            argument arg(value);
+            field.m_wrapper->set_value(object, arg);
+        }
+    }
+
+    return (index == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+patch::patch()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+patch::patch(const void* data, std::size_t size)
+:   m_data(static_cast<const char*>(data), static_cast<const char*>(data) + size)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool patch::is_valid() const
+{
+    return (m_data.size() > detail::g_patch_header_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool patch::empty() const
+{
+    return (m_data.size() <= detail::g_patch_header_size + 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<char>& patch::get_data() const
+{
+    return m_data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+patch diff(const instance& from, const instance& to)
+{
+    patch result;
+    if (!from.is_valid() || !to.is_valid())
+        return result;
+
+    const type t = to.get_derived_type();
+    if (from.get_derived_type() != t)
+        return result;
+
+    const uint64_t fingerprint = t.get_fingerprint();
+    std::vector<char>& buffer = result.m_data;
+    buffer.resize(sizeof(fingerprint));
+    std::memcpy(buffer.data(), &fingerprint, sizeof(fingerprint));
+
+    detail::binary_writer_private writer(buffer);
+    detail::diff_object(from, to, detail::binary_plan::get(t), buffer, writer);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool apply_patch(const instance& object, const patch& p)
+{
+    if (!object.is_valid() || !p.is_valid())
+        return false;
+
+    const auto& data = p.get_data();
+    const type t = object.get_derived_type();
+    uint64_t fingerprint = 0;
+    std::memcpy(&fingerprint, data.data(), sizeof(fingerprint));
+    if (fingerprint != t.get_fingerprint())
+        return false;
+
+    detail::binary_reader_private reader(data.data() + detail::g_patch_header_size, data.size() - detail::g_patch_header_size);
+    return (detail::apply_object(object, detail::binary_plan::get(t), reader) && reader.at_end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,134 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_PATCH_H_
+#define RTTR_PATCH_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace rttr
+{
+
+/*!
+ * The \ref patch class contains the changes between two objects of the same type, as created by \ref diff().
+ * Apply it with \ref apply_patch() to another object, which has the state of the first one.
+ *
+ * The patch is a compact byte stream, which can be sent over the network as it is,
+ * and turned back into a patch on the receiving side:
+ *
+ * \code{.cpp}
+ *  patch p = diff(last_sent_state, player);
+ *  if (!p.empty())
+ *      send(p.get_data().data(), p.get_data().size());
+ *  ...
+ *  apply_patch(remote_player, patch(received_data, received_size));
+ * \endcode
+ *
+ * Format
+ * ------
+ * The data starts with the \ref type::get_fingerprint() "fingerprint" of the patched type, followed by the changes.
+ * Every changed property is stored as its index in the list of serialized properties plus one,
+ * encoded as variable length integer, followed by the new value in the format of \ref io::binary_writer.
+ * A changed class member stores only its changed properties, in the same way. Every list of changes
+ * ends with a zero.
+ *
+ * Like for the binary format, the patch has to be applied by a program, which registered the same properties.
+ *
+ * \see diff(), apply_patch()
+ */
+class RTTR_API patch
+{
+    public:
+        /*!
+         * \brief Creates an invalid patch.
+         */
+        patch();
+
+        /*!
+         * \brief Creates a patch from the given data, which was previously taken from \ref get_data().
+         *
+         * The data is copied; it will be validated, when the patch is applied.
+         */
+        patch(const void* data, std::size_t size);
+
+        /*!
+         * \brief Returns true, when the patch contains data.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Returns true, when the patch does not contain any change.
+         *        Then there is nothing to send, the compared objects were equal.
+         */
+        bool empty() const;
+
+        /*!
+         * \brief Returns the byte stream of this patch.
+         */
+        const std::vector<char>& get_data() const;
+
+    private:
+        friend RTTR_API patch diff(const instance& from, const instance& to);
+
+        std::vector<char> m_data;
+};
+
+/*!
+ * \brief Returns the changes, which turn the object \p from into the object \p to.
+ *
+ * Both objects have to be of the same \ref instance::get_derived_type() "most derived type";
+ * otherwise an invalid patch is returned.
+ *
+ * The properties are compared in the order of their serialization plan, directly on the objects:
+ * arithmetic values and enumerations by their bytes, strings by their characters,
+ * contiguous arrays of arithmetic values with one `memcmp`. No \ref variant is created, except for properties,
+ * which are accessed via getter functions. A class member, which did not change, does not occupy
+ * any space in the patch. Read only properties are not compared.
+ *
+ * \remark Floating point values are compared bitwise; a change from `0.0` to `-0.0` is a change,
+ *         while a `NaN`, which was not modified, is not.
+ */
+RTTR_API patch diff(const instance& from, const instance& to);
+
+/*!
+ * \brief Applies the changes of the given patch \p p to \p object.
+ *
+ * \return True, when the patch was applied; false, when the patch is invalid, was created for another type
+ *         or its data is corrupt. When the data turns out to be corrupt in the middle of the patch,
+ *         the preceding changes are already applied.
+ */
+RTTR_API bool apply_patch(const instance& object, const patch& p);
+
+} // end namespace rttr
+
+#endif // RTTR_PATCH_H_
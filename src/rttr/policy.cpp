@@ -46,6 +46,8 @@ const detail::as_std_shared_ptr policy::ctor::as_std_shared_ptr = {};
 
 const detail::as_object policy::ctor::as_object = {};
 
+const detail::as_pooled policy::ctor::as_pooled = {};
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 } // end namespace rttr
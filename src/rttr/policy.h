@@ -269,6 +269,47 @@ struct RTTR_API policy
          * \endcode
          */
         static const detail::as_object              as_object;
+
+        /*!
+         * The \ref as_pooled policy will create an instance of a class as raw pointer, like \ref as_raw_ptr,
+         * but the memory is taken from an \ref object_pool of the class.
+         *
+         * The pool is created during registration and is sized from \ref type::get_sizeof() and \ref type::get_alignof().
+         * Every thread keeps its own list of free blocks, so creating and destroying objects concurrently rarely needs a lock.
+         * The corresponding \ref destructor gives the memory back to the pool. The counters of the pool
+         * can be retrieved via \ref get_pool_statistics().
+         *
+         * See following example code:
+         * \code{.cpp}
+         * using namespace rttr;
+         * struct Foo
+         * {
+         * };
+         *
+         * RTTR_REGISTRATION
+         * {
+         *      registration::class_<Foo>("Foo")
+         *                   .constructor<>()
+         *                    (
+         *                        policy::ctor::as_pooled
+         *                    );
+         * }
+         *
+         * int main()
+         * {
+         *   variant var = type::get<Foo>().create();
+         *   std::cout << var.is_type<Foo*>();                                  // prints "true"
+         *   var.get_type().destroy(var);                                       // the memory is given back to the pool
+         *   std::cout << get_pool_statistics(type::get<Foo>()).m_live_count;  // prints "0"
+         *   return 0;
+         * }
+         * \endcode
+         *
+         * \remark The pool is shared by all constructors of the class with the policy \ref as_raw_ptr,
+         *         because they are destroyed by the same destructor.
+         *         When an allocator was already set via \ref type::set_allocator(), no pool will be created.
+         */
+        static const detail::as_pooled              as_pooled;
     };
 };
 
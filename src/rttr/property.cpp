@@ -29,6 +29,7 @@
 
 #include "rttr/detail/property/property_wrapper_base.h"
 #include "rttr/variant.h"
+#include "rttr/variant_ref.h"
 #include "rttr/argument.h"
 #include "rttr/instance.h"
 #include "rttr/enumeration.h"
@@ -47,6 +48,12 @@ property create_item(const property_wrapper_base* wrapper)
     return property(wrapper);
 }
 
+template<>
+const property_wrapper_base* get_wrapper(const property& item)
+{
+    return item.m_wrapper;
+}
+
 } // end namespace detail;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +190,16 @@ variant property::get_value(instance object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_ref property::get_ref(instance object) const
+{
+    if (is_valid())
+        return m_wrapper->get_ref(object);
+    else
+        return variant_ref();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant property::get_metadata(const variant& key) const
 {
     if (is_valid())
@@ -193,6 +210,16 @@ variant property::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant property::get_metadata(const metadata_key& key) const
+{
+    if (is_valid())
+        return m_wrapper->get_metadata(key);
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool property::operator==(const property& other) const
 {
     return (m_wrapper == other.m_wrapper);
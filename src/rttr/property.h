@@ -33,12 +33,14 @@
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
+#include "rttr/metadata_key.h"
 
 #include <string>
 
 namespace rttr
 {
 class variant;
+class variant_ref;
 class type;
 class enumeration;
 class instance;
@@ -241,6 +243,23 @@ class RTTR_API property
          */
         variant get_value(instance object) const;
 
+        /*!
+         * \brief Returns a reference to the current property value of the given instance \p object.
+         *
+         * In contrast to \ref get_value(), the property value will not be copied;
+         * the returned \ref variant_ref refers directly to the value inside \p object.
+         * This is useful for reading big values, e.g. strings or containers, without copying them.
+         *
+         * \remark When the property value has no addressable storage (e.g. it is retrieved via a getter function, which returns by value),
+         *         the returned \ref variant_ref will hold a copy of the value.
+         *         When the property is static, you can forward an empty instance.
+         *
+         * \see get_value().
+         *
+         * \return A reference to the property value of the given instance \p object.
+         */
+        variant_ref get_ref(instance object) const;
+
         /*!
          * \brief Returns the meta data for the given key \p key.
          *
@@ -251,6 +270,19 @@ class RTTR_API property
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned key \p key.
+         *
+         * In contrast to \ref get_metadata(const variant&) const "get_metadata(const variant&)",
+         * only the integer ids of the keys are compared.
+         *
+         * \remark When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const metadata_key& key) const;
+
         /*!
          * \brief Returns true if this property is the same like the \p other.
          *
@@ -272,6 +304,8 @@ class RTTR_API property
 
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
+        template<typename T>
+        friend const detail::class_item_to_wrapper_t<T>* detail::get_wrapper(const T& item);
 
     private:
         const detail::property_wrapper_base* m_wrapper;
@@ -29,14 +29,26 @@ set(HEADER_FILES access_levels.h
                  argument.h
                  array_mapper.h
                  array_range.h
+                 associative_mapper.h
+                 clone_mode.h
                  constructor.h
                  destructor.h
                  enumeration.h
                  instance.h
+                 metadata_key.h
                  method.h
+                 object_compare.h
+                 object_pool.h
                  policy.h
                  property.h
                  parameter_info.h
+                 parallel.h
+                 patch.h
+                 io/binary_reader.h
+                 io/binary_writer.h
+                 io/json_reader.h
+                 io/json_writer.h
+                 io/registry_snapshot.h
                  registration
                  registration.h
                  string_view.h
@@ -46,12 +58,30 @@ set(HEADER_FILES access_levels.h
                  type.h
                  variant.h
                  variant_array_view.h
+                 variant_ndarray_view.h
+                 variant_associative_view.h
+                 variant_ref.h
                  wrapper_mapper.h
                  detail/array/array_accessor.h
                  detail/array/array_accessor_impl.h
+                 detail/array/array_iterator_accessor.h
+                 detail/array/array_bulk_accessor.h
+                 detail/array/array_element_accessor.h
+                 detail/array/array_converter.h
+                 detail/array/array_slice_wrapper.h
+                 detail/parallel/thread_pool_private.h
+                 detail/object_pool/object_pool_private.h
+                 detail/io/binary_plan.h
+                 detail/io/binary_reader_p.h
+                 detail/io/binary_stream.h
+                 detail/io/binary_writer_p.h
+                 detail/io/json_plan.h
                  detail/array/array_mapper_impl.h
                  detail/array/array_wrapper.h
                  detail/array/array_wrapper_base.h
+                 detail/associative/associative_mapper_impl.h
+                 detail/associative/associative_wrapper.h
+                 detail/associative/associative_wrapper_base.h
                  detail/base/core_prerequisites.h
                  detail/base/version.h.in
                  detail/base/version.rc.in
@@ -66,6 +96,7 @@ set(HEADER_FILES access_levels.h
                  detail/destructor/destructor_wrapper.h
                  detail/destructor/destructor_wrapper_base.h
                  detail/enumeration/enumeration_helper.h
+                 detail/enumeration/enumeration_index.h
                  detail/enumeration/enumeration_wrapper.h
                  detail/enumeration/enumeration_wrapper_base.h
                  detail/enumeration/enum_data.h
@@ -92,7 +123,9 @@ set(HEADER_FILES access_levels.h
                  detail/misc/flat_map.h
                  detail/misc/flat_multimap.h
                  detail/misc/function_traits.h
+                 detail/misc/iterator_storage.h
                  detail/misc/misc_type_traits.h
+                 detail/misc/plan_cache.h
                  detail/misc/std_type_traits.h
                  detail/misc/utility.h
                  detail/parameter_info/parameter_infos.h
@@ -120,31 +153,56 @@ set(HEADER_FILES access_levels.h
                  detail/type/get_derived_info_func.h
                  detail/type/type_converter.h
                  detail/type/type_comparator.h
+                 detail/type/type_hasher.h
                  detail/type/type_database_p.h
+                 detail/type/clone_plan.h
+                 detail/type/compare_plan.h
                  detail/type/type_register.h
                  detail/type/type_impl.h
                  detail/variant/variant_compare.h
+                 detail/variant/variant_conversion_table.h
                  detail/variant/variant_data.h
                  detail/variant/variant_data_converter.h
                  detail/variant/variant_data_policy.h
+                 detail/variant/variant_hash.h
+                 detail/variant/variant_numeric_key.h
+                 detail/variant/variant_sort_key.h
                  detail/variant/variant_impl.h
+                 detail/variant/variant_ref_impl.h
                  detail/variant_array_view/variant_array_view_impl.h
                  detail/variant_array_view/variant_array_view_creator.h
                  detail/variant_array_view/variant_array_view_creator_impl.h
                  detail/variant_array_view/variant_array_view_traits.h
+                 detail/variant_array_view/variant_ndarray_view_impl.h
+                 detail/variant_associative_view/variant_associative_view_creator.h
+                 detail/variant_associative_view/variant_associative_view_creator_impl.h
+                 detail/variant_associative_view/variant_associative_view_traits.h
                 )
 
 set(SOURCE_FILES constructor.cpp
                  destructor.cpp
                  enumeration.cpp
+                 metadata_key.cpp
                  method.cpp
+                 object_compare.cpp
+                 object_pool.cpp
                  parameter_info.cpp
+                 parallel.cpp
+                 patch.cpp
+                 io/binary_reader.cpp
+                 io/binary_writer.cpp
+                 io/json_reader.cpp
+                 io/json_writer.cpp
+                 io/registry_snapshot.cpp
                  policy.cpp
                  property.cpp
                  registration.cpp
                  type.cpp
                  variant.cpp
                  variant_array_view.cpp
+                 variant_ndarray_view.cpp
+                 variant_associative_view.cpp
+                 variant_ref.cpp
                  detail/misc/compare_equal.cpp
                  detail/misc/compare_less.cpp
                  detail/misc/standard_types.cpp
@@ -152,12 +210,25 @@ set(SOURCE_FILES constructor.cpp
                  detail/constructor/constructor_wrapper_base.cpp
                  detail/destructor/destructor_wrapper_base.cpp
                  detail/enumeration/enumeration_helper.cpp
+                 detail/enumeration/enumeration_index.cpp
                  detail/enumeration/enumeration_wrapper_base.cpp
                  detail/method/method_wrapper_base.cpp
                  detail/parameter_info/parameter_info_wrapper_base.cpp
                  detail/property/property_wrapper_base.cpp
                  detail/registration/registration_executer.cpp
                  detail/type/type_database.cpp
+                 detail/type/clone_plan.cpp
+                 detail/type/compare_plan.cpp
                  detail/type/type_register.cpp
                  detail/variant/variant_compare.cpp
+                 detail/variant/variant_conversion_table.cpp
+                 detail/variant/variant_hash.cpp
+                 detail/array/array_slice_wrapper.cpp
+                 detail/parallel/thread_pool_private.cpp
+                 detail/object_pool/object_pool_private.cpp
+                 detail/io/binary_plan.cpp
+                 detail/io/binary_stream.cpp
+                 detail/io/json_plan.cpp
+                 detail/variant/variant_numeric_key.cpp
+                 detail/variant/variant_sort_key.cpp
                  )
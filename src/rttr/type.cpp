@@ -41,6 +41,7 @@
 #include "rttr/rttr_enable.h"
 
 #include "rttr/detail/type/type_database_p.h"
+#include "rttr/detail/type/clone_plan.h"
 
 #include <algorithm>
 #include <unordered_map>
@@ -75,9 +76,12 @@ RTTR_DECL_DB_TYPE(m_conversion_list, g_conversion_list)
 RTTR_DECL_DB_TYPE(m_raw_type_list, g_raw_type_list)
 RTTR_DECL_DB_TYPE(m_wrapped_type_list, g_wrapped_type_list)
 RTTR_DECL_DB_TYPE(m_array_raw_type_list, g_array_raw_type_list)
+RTTR_DECL_DB_TYPE(m_array_element_type_list, g_array_element_type_list)
 RTTR_DECL_DB_TYPE(m_variant_create_func_list, g_variant_create_func_list)
 
 RTTR_DECL_DB_TYPE(m_type_size, g_type_size)
+RTTR_DECL_DB_TYPE(m_type_alignment, g_type_alignment)
+RTTR_DECL_DB_TYPE(m_type_allocator, g_type_allocator)
 RTTR_DECL_DB_TYPE(m_type_list, g_type_list)
 
 RTTR_DECL_DB_TYPE(m_is_class_list, g_is_class_list)
@@ -116,9 +120,12 @@ void type::init_globals()
     RTTR_SET_DB_TYPE(m_raw_type_list, g_raw_type_list)
     RTTR_SET_DB_TYPE(m_wrapped_type_list, g_wrapped_type_list)
     RTTR_SET_DB_TYPE(m_array_raw_type_list, g_array_raw_type_list)
+    RTTR_SET_DB_TYPE(m_array_element_type_list, g_array_element_type_list)
     RTTR_SET_DB_TYPE(m_variant_create_func_list, g_variant_create_func_list)
 
     RTTR_SET_DB_TYPE(m_type_size, g_type_size)
+    RTTR_SET_DB_TYPE(m_type_alignment, g_type_alignment)
+    RTTR_SET_DB_TYPE(m_type_allocator, g_type_allocator)
     RTTR_SET_DB_TYPE(m_type_list, g_type_list)
 
     RTTR_SET_DB_TYPE(m_is_class_list, g_is_class_list)
@@ -339,6 +346,13 @@ array_range<type> type::get_derived_classes() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+uint64_t type::get_fingerprint() const
+{
+    return detail::type_database::instance().get_fingerprint(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::size_t type::get_sizeof() const
 {
     return (*g_type_size)[m_id];
@@ -346,6 +360,13 @@ std::size_t type::get_sizeof() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::size_t type::get_alignof() const
+{
+    return (*g_type_alignment)[m_id];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool type::is_class() const
 {
     return (*g_is_class_list)[m_id];
@@ -438,6 +459,13 @@ variant type::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant type::get_metadata(const metadata_key& key) const
+{
+    return detail::type_database::instance().get_metadata(*this, key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 constructor type::get_constructor(const std::vector<type>& args) const
 {
     return constructor(detail::type_database::instance().get_constructor(*this, args));
@@ -460,6 +488,14 @@ variant type::create(vector<argument> args) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant type::create_at(void* storage, vector<argument> args) const
+{
+    auto ctor = detail::type_database::instance().get_constructor(*this, args);
+    return ctor.invoke_variadic_at(storage, std::move(args));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 destructor type::get_destructor() const
 {
     return destructor(detail::type_database::instance().get_destructor(get_raw_type()));
@@ -474,6 +510,71 @@ bool type::destroy(variant& obj) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool type::destroy_at(void* storage) const
+{
+    return detail::type_database::instance().get_destructor(get_raw_type()).invoke_at(storage);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type::set_allocator(object_allocator* allocator) const
+{
+    (*g_type_allocator)[m_id] = allocator;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_allocator* type::get_allocator() const
+{
+    return (*g_type_allocator)[m_id];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! Returns true, when \p object, or the object held by the pointer or wrapper \p object refers to, is derived from \p t.
+static bool is_object_derived_from(const instance& object, const type& t)
+{
+    if (object.get_type() == t)
+        return true;
+
+    const instance wrapped = object.get_wrapped_instance();
+    return (wrapped.is_valid() ? wrapped : object).get_derived_type().is_derived_from(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::clone(const instance& object, clone_mode mode) const
+{
+    if (!object.is_valid() || !is_object_derived_from(object, *this))
+        return variant();
+
+    variant result = create();
+    if (result.is_valid() && !clone_into(object, result, mode))
+    {
+        destroy(result);
+        return variant();
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type::clone_into(const instance& source, const instance& target, clone_mode mode) const
+{
+    const type raw_type = get_raw_type();
+    if (!source.is_valid() || !target.is_valid() || !raw_type.is_class())
+        return false;
+
+    if (!is_object_derived_from(source, raw_type) || !is_object_derived_from(target, raw_type))
+        return false;
+
+    detail::object_cloner cloner(mode);
+    return cloner.clone_object(source, target, detail::clone_plan::get(raw_type));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 property type::get_property(string_view name) const
 {
     return detail::type_database::instance().get_class_property(get_raw_type(), name);
@@ -30,7 +30,9 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
+#include "rttr/metadata_key.h"
 #include "rttr/array_range.h"
+#include "rttr/clone_mode.h"
 
 #include <type_traits>
 #include <vector>
@@ -49,6 +51,7 @@ class enumeration;
 class type;
 class instance;
 class argument;
+class object_allocator;
 
 template<typename Target_Type, typename Source_Type>
 Target_Type rttr_cast(Source_Type object);
@@ -328,6 +331,13 @@ class RTTR_API type
          */
         std::size_t get_sizeof() const;
 
+        /*!
+         * \brief Returns the alignment requirement in bytes of the current type (i.e. `alignof(T)`).
+         *
+         * \return The alignment of the type in bytes; `0` for `void` and function types.
+         */
+        std::size_t get_alignof() const;
+
         /*!
          * \brief Returns true whether the given type is class; that is not an atomic type or a method.
          *
@@ -469,6 +479,28 @@ class RTTR_API type
          */
         array_range<type> get_derived_classes() const;
 
+        /*!
+         * \brief Returns a structural hash of this type.
+         *
+         * The fingerprint covers everything, which determines the layout of serialized values of this type:
+         * - classes: the fingerprints of the base classes and the names and the fingerprints of the types
+         *   of all non-static properties, in the order of \ref get_properties()
+         * - enumerations: the underlying type and the names and values of the enumerators
+         * - arrays: the fingerprint of the element type
+         * - pointers and wrappers: the fingerprint of the type they refer to
+         * - all other types (e.g. arithmetic types or classes without registered properties): the name of the type
+         *
+         * The name of a class or an enumeration itself is not part of its fingerprint; so two types with the same structure
+         * have the same fingerprint. The value is stable between runs of a program, so serializers can store it and
+         * compare it on load, to skip the matching of property names when the structure did not change.
+         *
+         * \remark The fingerprint is computed on the first call and cached; so all properties and enumerators
+         *         of the type have to be registered before.
+         *
+         * \return The fingerprint; zero for an invalid type.
+         */
+        uint64_t get_fingerprint() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////
         /////////////////////////////////////////////////////////////////////////////////////////
         /////////////////////////////////////////////////////////////////////////////////////////
@@ -483,6 +515,19 @@ class RTTR_API type
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned key \p key.
+         *
+         * In contrast to \ref get_metadata(const variant&) const "get_metadata(const variant&)",
+         * only the integer ids of the keys are compared.
+         *
+         * \remark When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const metadata_key& key) const;
+
         /*!
          * \brief Returns a public constructor whose parameters match the types in the specified list.
          *
@@ -510,6 +555,31 @@ class RTTR_API type
          */
         variant create(std::vector<argument> args = std::vector<argument>()) const;
 
+        /*!
+         * \brief Creates an instance of the current type in the memory at \p storage, which is owned by the caller,
+         *        with the given arguments \p args for the constructor.
+         *
+         * The memory has to provide at least \ref get_sizeof() bytes and has to be aligned to \ref get_alignof().
+         * Independent of the policy, which was used to register the constructor, no memory is allocated.
+         * The object has to be destroyed with \ref destroy_at(), before the memory is released or reused.
+         *
+         * See following example code:
+         * \code{.cpp}
+         *   type t = type::get_by_name("entity");
+         *   void* storage = arena.allocate(t.get_sizeof(), t.get_alignof());
+         *   variant obj = t.create_at(storage, {std::string("player")}); // contains an 'entity*' with the address 'storage'
+         *   // ...
+         *   t.destroy_at(storage);
+         * \endcode
+         *
+         * \remark When the argument types does not match the parameter list of the constructor, then it will not be invoked.
+         *         Constructors with registered \ref default_arguments will be honored; constructors,
+         *         which are registered via a function, cannot be used.
+         *
+         * \return Returns a pointer to the new object; an invalid variant, when no object could be created.
+         */
+        variant create_at(void* storage, std::vector<argument> args = std::vector<argument>()) const;
+
         /*!
          * \brief Returns the corresponding destructor for this type.
          *
@@ -530,6 +600,61 @@ class RTTR_API type
          */
         bool destroy(variant& obj) const;
 
+        /*!
+         * \brief Destroys the object at the address \p storage, which was created with \ref create_at(),
+         *        without releasing the memory.
+         *
+         * \return True if the destructor of the object could be invoked, otherwise false.
+         */
+        bool destroy_at(void* storage) const;
+
+        /*!
+         * \brief Sets the \p allocator for the objects of this type, which are created via a constructor
+         *        with the policy \ref policy::ctor::as_raw_ptr or \ref policy::ctor::as_pooled.
+         *
+         * The memory of these objects is requested from \p allocator and the registered \ref destructor gives it back.
+         * With `nullptr` the objects are allocated with `new` again.
+         *
+         * \remark The allocator has to be set, before the first object is created; objects, which were created
+         *         before, must not be destroyed afterwards via the destructor of this type.
+         *         The allocator is not owned by the type, so it has to outlive all objects of this type.
+         *         This function is not thread safe.
+         */
+        void set_allocator(object_allocator* allocator) const;
+
+        /*!
+         * \brief Returns the allocator of this type, which was set via \ref set_allocator()
+         *        or via a constructor with the policy \ref policy::ctor::as_pooled.
+         *
+         * \return The allocator; `nullptr`, when the objects are allocated with `new`.
+         */
+        object_allocator* get_allocator() const;
+
+        /*!
+         * \brief Creates a new object of the current type and copies the properties of \p object into it.
+         *
+         * The new object is created via the default constructor (see \ref create()),
+         * afterwards the properties are copied with \ref clone_into().
+         *
+         * \return The new object, with the same policy as \ref create() returns it; an invalid variant, when
+         *         no default constructor is registered or \p object is not derived from this type.
+         */
+        variant clone(const instance& object, clone_mode mode = clone_mode::share_pointees) const;
+
+        /*!
+         * \brief Copies the values of all non-static, writable properties of the current type
+         *        from \p source to \p target.
+         *
+         * For every class, a copy plan is compiled once. Every member is assigned directly with the copy assignment
+         * of its own type, without creating a \ref variant; members of class type, which have registered properties,
+         * are copied recursively, property by property. Only properties, which are accessed via getter
+         * and setter functions, are copied via a \ref variant.
+         * How shared pointers are treated is selected with \p mode.
+         *
+         * \return True, when both objects are derived from this type; otherwise false.
+         */
+        bool clone_into(const instance& source, const instance& target, clone_mode mode = clone_mode::share_pointees) const;
+
 
         /*!
          * \brief Returns a property with the name \p name.
@@ -735,6 +860,28 @@ class RTTR_API type
         template<typename T>
         static void register_comparators();
 
+        /*!
+         * \brief Register the hash function `std::hash<T>` for type \p T.
+         *        This requires a valid specialization of `std::hash` for type \p T.
+         *
+         * The registered hash function will be used by `std::hash<variant>`,
+         * when the variant contains a value of type \p T. Without a registered hash function,
+         * all values of a custom type will have the same hash value.
+         *
+         * See following example code:
+         *  \code{.cpp}
+         *   type::register_hasher<my_struct>();
+         *   type::register_comparators<my_struct>();
+         *
+         *   std::unordered_set<variant, std::hash<variant>, variant_key_equal> cache;
+         *   cache.insert(my_struct{});
+         *  \endcode
+         *
+         * \see std::hash<variant>, variant_key_equal
+         */
+        template<typename T>
+        static void register_hasher();
+
     private:
 
         /*!
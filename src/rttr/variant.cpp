@@ -28,7 +28,10 @@
 #include "rttr/variant.h"
 
 #include "rttr/detail/variant/variant_data_policy.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+#include "rttr/detail/variant/variant_sort_key.h"
 #include "rttr/variant_array_view.h"
+#include "rttr/variant_associative_view.h"
 #include "rttr/argument.h"
 
 #include <algorithm>
@@ -135,6 +138,13 @@ bool variant::compare_less(const variant& other) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::string variant::sort_key() const
+{
+    return detail::variant_sort_key(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void variant::clear()
 {
     m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
@@ -164,6 +174,13 @@ bool variant::is_array() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool variant::is_associative_container() const
+{
+    return m_policy(detail::variant_policy_operation::IS_ASSOCIATIVE_CONTAINER, m_data, detail::argument_wrapper());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type variant::get_type() const
 {
     type src_type(type::m_invalid_id);
@@ -182,6 +199,15 @@ variant_array_view variant::create_array_view() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_associative_view variant::create_associative_view() const
+{
+    variant_associative_view result;
+    m_policy(detail::variant_policy_operation::TO_ASSOCIATIVE_CONTAINER, m_data, result.m_wrapper);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant::can_convert(const type& target_type) const
 {
     if (!is_valid())
@@ -192,6 +218,10 @@ bool variant::can_convert(const type& target_type) const
     if (source_type == target_type)
         return true;
 
+    using table = detail::variant_conversion_table;
+    if (table::get_conversion_func(table::get_kind(source_type), table::get_kind(target_type)))
+        return true;
+
     if (source_type.get_pointer_dimension() == 1 && target_type.get_pointer_dimension() == 1)
     {
         if (void * ptr = type::apply_offset(get_raw_ptr(), source_type, target_type))
@@ -204,17 +234,7 @@ bool variant::can_convert(const type& target_type) const
     if (target_type == type::get<std::nullptr_t>() && is_nullptr())
         return true;
 
-    const bool source_is_arithmetic = source_type.is_arithmetic();
-    const bool target_is_arithmetic = target_type.is_arithmetic();
-    const bool target_is_enumeration = target_type.is_enumeration();
-    const type string_type = type::get<std::string>();
-
-    return ((source_is_arithmetic && target_is_arithmetic) ||
-            (source_is_arithmetic && target_type == string_type) ||
-            (source_type == string_type && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_is_arithmetic) ||
-            (source_is_arithmetic && target_is_enumeration) ||
-            (source_type == string_type && target_is_enumeration));
+    return false;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -227,131 +247,38 @@ bool variant::convert(const type& target_type, variant& target_var) const
     bool ok = false;
 
     const type source_type = get_type();
-    const bool source_is_arithmetic = source_type.is_arithmetic();
-    const bool target_is_arithmetic = target_type.is_arithmetic();
-    const type string_type = type::get<std::string>();
     if (target_type == source_type)
     {
         target_var = *this;
         return true; // the current variant is already the target type, we don't need to do anything
     }
-    else if ((source_is_arithmetic && target_is_arithmetic) ||
-            (source_is_arithmetic && target_type == string_type) ||
-            (source_type == string_type && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_type == string_type))
+
+    using table = detail::variant_conversion_table;
+    if (const auto convert_func = table::get_conversion_func(table::get_kind(source_type), table::get_kind(target_type)))
     {
-        if (target_type == type::get<bool>())
-        {
-            bool value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<char>())
-        {
-            char value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int8_t>())
-        {
-            int8_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int16_t>())
-        {
-            int16_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int32_t>())
-        {
-            int32_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<int64_t>())
-        {
-            int64_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint8_t>())
-        {
-            uint8_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint16_t>())
-        {
-            uint16_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint32_t>())
-        {
-            uint32_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<uint64_t>())
-        {
-            uint64_t value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<float>())
-        {
-            float value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == type::get<double>())
-        {
-            double value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = value;
-        }
-        else if (target_type == string_type)
-        {
-            std::string value;
-            if ((ok = try_basic_type_conversion(value)))
-                target_var = std::move(value);
-        }
+        ok = convert_func(*this, target_type, target_var);
     }
-    else if ((source_is_arithmetic || source_type == string_type)
-             && target_type.is_enumeration())
+    else if (const auto& converter = source_type.get_type_converter(target_type))
     {
-        variant var = target_type;
-        auto wrapper = std::ref(var);
-        if ((ok = try_basic_type_conversion(wrapper)))
-            target_var = std::move(var);
+        void* ptr = get_ptr();
+        target_var = converter->to_variant(ptr, ok);
     }
-    else
+    else if (target_type == type::get<std::nullptr_t>() && is_nullptr())
     {
-        if (const auto& converter = source_type.get_type_converter(target_type))
-        {
-            void* ptr = get_ptr();
-            target_var = converter->to_variant(ptr, ok);
-        }
-        else if (target_type == type::get<std::nullptr_t>() && is_nullptr())
-        {
-            target_var = nullptr;
-            ok = true;
-        }
-        else if (source_type.is_pointer() &&
-                 (source_type.get_pointer_dimension() == 1 && target_type.get_pointer_dimension() == 1))
+        target_var = nullptr;
+        ok = true;
+    }
+    else if (source_type.is_pointer() &&
+             (source_type.get_pointer_dimension() == 1 && target_type.get_pointer_dimension() == 1))
+    {
+        void* raw_ptr = get_raw_ptr();
+        if (void* casted_ptr = type::apply_offset(raw_ptr, source_type, target_type))
         {
-            void* raw_ptr = get_raw_ptr();
-            if (void* casted_ptr = type::apply_offset(raw_ptr, source_type, target_type))
-            {
-                // although we forward a void* to create a variant,
-                // it will create a variant for the specific class type
-                target_var = target_type.create_variant(casted_ptr);
-                if (target_var.is_valid())
-                    ok = true;
-            }
+            // although we forward a void* to create a variant,
+            // it will create a variant for the specific class type
+            target_var = target_type.create_variant(casted_ptr);
+            if (target_var.is_valid())
+                ok = true;
         }
     }
 
@@ -33,6 +33,7 @@
 #include "rttr/detail/variant/variant_data.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant/variant_compare.h"
+#include "rttr/detail/variant/variant_hash.h"
 
 #include <type_traits>
 #include <cstddef>
@@ -43,6 +44,8 @@ namespace rttr
 {
 
 class variant_array_view;
+class variant_associative_view;
+class variant_ref;
 class type;
 class variant;
 class argument;
@@ -57,6 +60,7 @@ namespace detail
     template<typename T, typename Tp, typename Converter = empty_type_converter<T>>
     struct variant_data_base_policy;
     struct variant_data_policy_nullptr_t;
+    struct variant_conversion_table;
 
     enum class variant_policy_operation : uint8_t;
 
@@ -288,6 +292,25 @@ class RTTR_API variant
          */
         RTTR_INLINE bool operator<(const variant& other) const;
 
+        /*!
+         * \brief Returns a key for sorting, which can be compared byte wise (e.g. with `std::string::operator<`),
+         *        instead of comparing the variants itself with \ref variant::operator<(const variant&) const "operator<".
+         *
+         * The key consists of a tag for the class of the value and the normalized value:
+         *  - arithmetic types and enumerations are ordered by their numeric value, independent of the concrete type
+         *  - `std::string` values are ordered like `std::string::operator<`
+         *
+         * For values of the same class, two keys have the same order as the variants itself.
+         * Values of different classes are ordered: invalid variants, numeric values, strings, all other types.
+         * Keys of all other types only contain the type, these values have to be ordered with
+         * \ref variant::operator<(const variant&) const "operator<"; \ref sort_variants() will do this automatically.
+         *
+         * \see sort_variants()
+         *
+         * \return The sort key of this variant.
+         */
+        std::string sort_key() const;
+
         /*!
          * \brief When the variant contains a value, then this function will clear the content.
          *
@@ -348,6 +371,17 @@ class RTTR_API variant
          */
         bool is_array() const;
 
+        /*!
+         * \brief When the \ref variant::get_type "type" or its \ref type::get_raw_type() "raw type"
+         *        or the \ref type::get_wrapped_type() "wrapped type" is an associative container (e.g. `std::map<Key, T>`),
+         *        then this function will return true, otherwise false.
+         *
+         * \see associative_mapper, create_associative_view()
+         *
+         * \return True if the containing value is an associative container; otherwise false.
+         */
+        bool is_associative_container() const;
+
         /*!
          * \brief Returns a reference to the containing value as type \p T.
          *
@@ -499,6 +533,27 @@ class RTTR_API variant
          */
         variant_array_view create_array_view() const;
 
+        /*!
+         * \brief Creates a \ref variant_associative_view from the containing value,
+         *        when the \ref variant::get_type "type" or its \ref type::get_raw_type() "raw type"
+         *        or the \ref type::get_wrapped_type() "wrapped type" is an associative container.
+         *        Otherwise a default constructed variant_associative_view will be returned.
+         *        For shorten this check, use the function \ref is_associative_container().
+         *
+         * \code{.cpp}
+         *   std::map<int, std::string> obj = { {1, "one"}, {2, "two"} };
+         *   variant var = &obj;                                            // stores only the address of obj
+         *   variant_associative_view view = var.create_associative_view();
+         *   view.insert(3, std::string("three"));                         // inserts the element into obj
+         * \endcode
+         *
+         * \remark This function will return an \ref variant_associative_view::is_valid() "invalid" object,
+         *         when the \ref variant::get_type "type" is no associative container.
+         *
+         * \return A variant_associative_view object.
+         */
+        variant_associative_view create_associative_view() const;
+
         /*!
          * \brief Returns the variant as a `bool` if this variant is of \ref is_type() "type" `bool`.
          *
@@ -846,11 +901,15 @@ class RTTR_API variant
     private:
         friend class argument;
         friend class instance;
+        friend class variant_ref;
 
         template<typename T, typename Tp, typename Converter>
         friend struct detail::variant_data_base_policy;
         friend struct detail::variant_data_policy_nullptr_t;
+        friend struct detail::variant_conversion_table;
         friend RTTR_API bool detail::variant_compare_less(const variant&, const type&, const variant&, const type&);
+        friend RTTR_API std::size_t detail::variant_hash(const variant&);
+        friend RTTR_API bool detail::variant_equal_as_key(const variant&, const variant&);
 
         detail::variant_data            m_data;
         detail::variant_policy_func     m_policy;
@@ -858,6 +917,66 @@ class RTTR_API variant
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * The \ref variant_key_equal class is a function object for comparing variants,
+ * which are used as keys in hash based containers together with `std::hash<variant>`.
+ *
+ * Arithmetic values and enumerations are equal, when they have the same numeric value,
+ * independent of their concrete type (e.g. `1`, `1u`, `1.0` and an enum value `1`).
+ * All other values are only equal, when they have the same type and compare equal.
+ *
+ * \remark In contrast to \ref variant::operator==() "operator==", no conversions are performed,
+ *         e.g. `std::string("1")` and `1` are not equal. Also floating point values
+ *         are compared exactly. This keeps the comparison consistent with the hash value.
+ *
+ * See following example code:
+ *  \code{.cpp}
+ *   std::unordered_map<variant, std::string, std::hash<variant>, variant_key_equal> cache;
+ *   cache[42] = "forty-two";
+ *   cache.find(int64_t(42)) != cache.end();  // yields to true
+ *   cache.find(42.0) != cache.end();         // yields to true
+ *  \endcode
+ *
+ * \see type::register_hasher()
+ */
+struct variant_key_equal
+{
+    RTTR_INLINE bool operator()(const variant& lhs, const variant& rhs) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Sorts the variants in the range [\p first, \p last) in ascending order.
+ *
+ * The \ref variant::sort_key() "sort key" of every variant is created only once and the sorting is done on these keys,
+ * which is much faster than sorting with \ref variant::operator<(const variant&) const "operator<",
+ * especially for variants of different types. Only values which are neither arithmetic, enumerations nor strings
+ * are compared with \ref variant::operator<(const variant&) const "operator<".
+ * The order of equal variants is preserved.
+ *
+ * See following example code:
+ *  \code{.cpp}
+ *   std::vector<variant> values = { 3, 1.5, std::string("b"), int64_t(2), std::string("a") };
+ *   sort_variants(values.begin(), values.end());
+ *   // values: 1.5, 2, 3, "a", "b"
+ *  \endcode
+ *
+ * \see variant::sort_key()
+ */
+template<typename Iter>
+void sort_variants(Iter first, Iter last);
+
+/*!
+ * \brief Sorts all variants of the given \p range in ascending order.
+ *
+ * \see sort_variants(Iter, Iter)
+ */
+template<typename Range>
+void sort_variants(Range& range);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 #include "rttr/detail/variant/variant_impl.h"
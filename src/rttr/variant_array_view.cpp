@@ -29,11 +29,34 @@
 
 #include "rttr/argument.h"
 #include "rttr/instance.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/variant/variant_conversion_table.h"
+#include "rttr/detail/array/array_slice_wrapper.h"
+
+#include <cstdint>
 
 using namespace std;
 
 namespace rttr
 {
+namespace detail
+{
+
+// the per element conversion for element types, which are not arithmetic, e.g. enumerations
+template<typename T>
+static bool convert_array_elements(const variant_array_view& view, T* out, std::size_t count)
+{
+    std::size_t index = 0;
+    for (auto itr = view.begin(); index < count; ++itr, ++index)
+    {
+        if (!(*itr).convert(out[index]))
+            return false;
+    }
+
+    return true;
+}
+
+} // end namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,6 +102,76 @@ type variant_array_view::get_type() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool variant_array_view::is_contiguous() const
+{
+    return m_array_wrapper->is_contiguous();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_array_view::get_element_type() const
+{
+    return m_array_wrapper->get_element_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_array_view::get_stride() const
+{
+    return m_array_wrapper->get_stride();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* variant_array_view::get_data() const
+{
+    return m_array_wrapper->get_data();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::convert_to(const type& target_type, void* out, std::size_t count) const
+{
+    using namespace detail;
+    if (count > get_size() || (out == nullptr && count > 0))
+        return false;
+
+    // arithmetic elements are converted by the array wrapper without any temporary variant
+    if (variant_conversion_table::get_kind(get_element_type()) < basic_type_kind::STRING)
+        return m_array_wrapper->convert_to(target_type, out, 0, count);
+
+    switch (variant_conversion_table::get_kind(target_type))
+    {
+        case basic_type_kind::BOOL:     return convert_array_elements(*this, static_cast<bool*>(out), count);
+        case basic_type_kind::CHAR:     return convert_array_elements(*this, static_cast<char*>(out), count);
+        case basic_type_kind::INT8:     return convert_array_elements(*this, static_cast<int8_t*>(out), count);
+        case basic_type_kind::INT16:    return convert_array_elements(*this, static_cast<int16_t*>(out), count);
+        case basic_type_kind::INT32:    return convert_array_elements(*this, static_cast<int32_t*>(out), count);
+        case basic_type_kind::INT64:    return convert_array_elements(*this, static_cast<int64_t*>(out), count);
+        case basic_type_kind::UINT8:    return convert_array_elements(*this, static_cast<uint8_t*>(out), count);
+        case basic_type_kind::UINT16:   return convert_array_elements(*this, static_cast<uint16_t*>(out), count);
+        case basic_type_kind::UINT32:   return convert_array_elements(*this, static_cast<uint32_t*>(out), count);
+        case basic_type_kind::UINT64:   return convert_array_elements(*this, static_cast<uint64_t*>(out), count);
+        case basic_type_kind::FLOAT:    return convert_array_elements(*this, static_cast<float*>(out), count);
+        case basic_type_kind::DOUBLE:   return convert_array_elements(*this, static_cast<double*>(out), count);
+        default:                        return false;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view variant_array_view::slice(std::size_t begin, std::size_t end) const
+{
+    variant_array_view result;
+    if (!is_valid() || begin > end || end > get_size())
+        return result;
+
+    result.m_array_wrapper = detail::make_unique<detail::array_slice_wrapper>(m_array_wrapper->clone(), begin, end);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::size_t variant_array_view::get_size() const
 {
     return m_array_wrapper->get_size();
@@ -135,6 +228,73 @@ bool variant_array_view::set_size_variadic(std::size_t new_size, const std::vect
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool variant_array_view::reserve(std::size_t new_capacity)
+{
+    return m_array_wrapper->reserve(new_capacity);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::append_range(const variant_array_view& source)
+{
+    if (source.get_element_type() != get_element_type() || source.m_array_wrapper.get() == m_array_wrapper.get())
+        return false;
+
+    if (source.is_contiguous())
+        return m_array_wrapper->append_range(source.get_data(), source.get_size(), source.get_element_type(), false);
+
+    if (!is_dynamic())
+        return false;
+
+    reserve(get_size() + source.get_size());
+    for (auto itr = source.begin(); itr != source.end(); ++itr)
+    {
+        const const_iterator pos = insert_value(end(), (*itr).to_variant());
+        if (pos == end())
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::assign(const variant_array_view& source)
+{
+    if (source.get_element_type() != get_element_type() || source.m_array_wrapper.get() == m_array_wrapper.get())
+        return false;
+
+    if (source.is_contiguous())
+        return m_array_wrapper->assign(source.get_data(), source.get_size(), source.get_element_type(), false);
+
+    if (is_dynamic())
+    {
+        return (set_size(0) && append_range(source));
+    }
+    else if (get_size() != source.get_size())
+    {
+        return false;
+    }
+
+    auto target_itr = begin();
+    for (auto itr = source.begin(); itr != source.end(); ++itr, ++target_itr)
+    {
+        if (!set_value(target_itr, (*itr).to_variant()))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::assign(const type& element_type, const void* data, std::size_t count)
+{
+    return m_array_wrapper->assign(data, count, element_type, false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant_array_view::set_value(argument arg)
 {
     return m_array_wrapper->set_value(arg);
@@ -254,4 +414,192 @@ bool variant_array_view::remove_value_variadic(const std::vector<std::size_t>& i
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_array_view::const_iterator variant_array_view::begin() const
+{
+    return const_iterator(m_array_wrapper.get(), false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::end() const
+{
+    return const_iterator(m_array_wrapper.get(), true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_reverse_iterator variant_array_view::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_reverse_iterator variant_array_view::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::set_value(const const_iterator& pos, argument arg)
+{
+    if (pos.m_wrapper != m_array_wrapper.get())
+        return false;
+
+    const_iterator itr(pos);
+    return m_array_wrapper->set_value(itr.m_itr, arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::insert_value(const const_iterator& pos, argument arg)
+{
+    if (pos.m_wrapper != m_array_wrapper.get())
+        return end();
+
+    const_iterator itr(pos);
+    if (m_array_wrapper->insert_value(itr.m_itr, arg))
+        return itr;
+    else
+        return end();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::remove_value(const const_iterator& pos)
+{
+    if (pos.m_wrapper != m_array_wrapper.get() || pos == end())
+        return end();
+
+    const_iterator itr(pos);
+    if (m_array_wrapper->remove_value(itr.m_itr))
+        return itr;
+    else
+        return end();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::const_iterator()
+:   m_wrapper(nullptr),
+    m_manager(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::const_iterator(const detail::array_wrapper_base* wrapper, bool at_end)
+:   m_wrapper(wrapper),
+    m_manager(wrapper->create_iterator(m_itr, at_end))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::const_iterator(const const_iterator& other)
+:   m_wrapper(other.m_wrapper),
+    m_manager(other.m_manager)
+{
+    if (m_manager)
+        m_manager->copy(other.m_itr, m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::~const_iterator()
+{
+    if (m_manager)
+        m_manager->destroy(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator& variant_array_view::const_iterator::operator=(const const_iterator& other)
+{
+    if (this == &other)
+        return *this;
+
+    if (m_manager)
+        m_manager->destroy(m_itr);
+
+    m_wrapper = other.m_wrapper;
+    m_manager = other.m_manager;
+
+    if (m_manager)
+        m_manager->copy(other.m_itr, m_itr);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref variant_array_view::const_iterator::operator*() const
+{
+    variant_ref result;
+    if (m_wrapper)
+        m_wrapper->get_value(m_itr, result);
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator& variant_array_view::const_iterator::operator++()
+{
+    if (m_wrapper)
+        m_wrapper->advance_iterator(m_itr, true);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::const_iterator::operator++(int)
+{
+    const_iterator result(*this);
+    ++(*this);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator& variant_array_view::const_iterator::operator--()
+{
+    if (m_wrapper)
+        m_wrapper->advance_iterator(m_itr, false);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::const_iterator::operator--(int)
+{
+    const_iterator result(*this);
+    --(*this);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::const_iterator::operator==(const const_iterator& other) const
+{
+    if (m_wrapper != other.m_wrapper)
+        return false;
+
+    return (!m_wrapper || m_wrapper->equal_iterator(m_itr, other.m_itr));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::const_iterator::operator!=(const const_iterator& other) const
+{
+    return !(*this == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
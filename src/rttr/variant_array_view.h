@@ -31,10 +31,12 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/variant.h"
+#include "rttr/detail/array/array_wrapper_base.h"
 
 #include <cstddef>
 #include <vector>
 #include <memory>
+#include <iterator>
 
 namespace rttr
 {
@@ -42,6 +44,7 @@ namespace rttr
     class variant_array_view;
     class instance;
     class argument;
+    class variant_ref;
 
 namespace detail
 {
@@ -92,7 +95,8 @@ namespace detail
  *
  * When you have arrays bigger then rank count three, use the counterpart functions:
  * \ref variant_array_view::get_value_variadic "get_value_variadic" and \ref variant_array_view::set_value_variadic "set_value_variadic"
- * which expects a list of indices. When the array is dynamic it is also possible to
+ * which expects a list of indices. A \ref variant_ndarray_view provides an allocation free access via one index per dimension
+ * and describes the shape of the whole array. When the array is dynamic it is also possible to
  * \ref variant_array_view::insert_value "insert" or \ref variant_array_view::remove_value "remove" values.
  *
  * RTTR recognize whether a type is an array or not with the help of the \ref array_mapper class template.
@@ -101,6 +105,21 @@ namespace detail
  * `std::array<T, N>`, `std::vector<T>`, `std::list<T>` and raw-arrays `T[N]`.
  *
  *
+ * Iterating
+ * ----------------------
+ * The elements of the first dimension can also be traversed with a \ref variant_array_view::const_iterator "const_iterator",
+ * which yields a \ref variant_ref for every element, so no element will be copied.
+ * Instead of an index, the iterator holds the position inside the underlying container; that makes a traversal of
+ * e.g. a `std::list<T>` linear in time. With \ref set_value(), \ref insert_value() and \ref remove_value()
+ * the array can be modified at the position of an iterator.
+ * \code{.cpp}
+ *  std::list<int> list = {1, 2, 3};
+ *  variant var = &list;
+ *  variant_array_view array = var.create_array_view();
+ *  for (auto itr = array.begin(); itr != array.end(); ++itr)
+ *      std::cout << (*itr).to_string();
+ * \endcode
+ *
  * Copying and Assignment
  * ----------------------
  * A \ref variant_array_view object can be copied and assigned,
@@ -137,6 +156,9 @@ namespace detail
 class RTTR_API variant_array_view
 {
     public:
+        class const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
         /*!
          * \brief Constructs an invalid variant_array_view object.
          *
@@ -235,6 +257,126 @@ class RTTR_API variant_array_view
          */
         type get_type() const;
 
+        /*!
+         * \brief Returns true, when the elements of the first dimension are stored contiguously in memory.
+         *
+         * This is the case for raw arrays, `std::array<T, N>` and `std::vector<T>`;
+         * `std::vector<bool>` and `std::list<T>` are not contiguous.
+         * For a custom \ref array_mapper, provide the static function `get_data()`.
+         *
+         * \return True, when the array is contiguous; otherwise false.
+         */
+        bool is_contiguous() const;
+
+        /*!
+         * \brief Returns the \ref type object of the elements from the first dimension.
+         *
+         * E.g. for `int[2][10]` the element type is `int[10]`.
+         *
+         * \return The element type, or an invalid type, when the view is not valid.
+         */
+        type get_element_type() const;
+
+        /*!
+         * \brief Returns the distance in bytes between two consecutive elements of the first dimension.
+         *
+         * \return The stride in bytes, or `0` when the array is not \ref is_contiguous() "contiguous".
+         */
+        std::size_t get_stride() const;
+
+        /*!
+         * \brief Returns a pointer to the first element of the underlying storage.
+         *
+         * The returned memory holds \ref get_size() elements of type \ref get_element_type(),
+         * placed \ref get_stride() bytes apart. The pointer is invalidated by any operation, which changes
+         * the size of the array.
+         *
+         * \remark When the view was created from a const array, the memory must not be modified.
+         *
+         * \return A pointer to the data, or `nullptr` when the array is not \ref is_contiguous() "contiguous".
+         */
+        void* get_data() const;
+
+        /*!
+         * \brief Returns a typed pointer to the first element of the underlying storage.
+         *
+         * \code{.cpp}
+         *  std::vector<float> vec(1024, 1.0f);
+         *  variant var = &vec;
+         *  auto view = var.create_array_view();
+         *  if (float* data = view.get_data<float>())
+         *      std::fill(data, data + view.get_size(), 0.0f);
+         * \endcode
+         *
+         * \return A pointer to the data, or `nullptr` when the array is not contiguous
+         *         or the element type is not exactly \p T.
+         */
+        template<typename T>
+        T* get_data() const;
+
+        /*!
+         * \brief Converts the first \p count elements of the array to the arithmetic type \p target_type
+         *        and writes them into the buffer \p out.
+         *
+         * When the element type is arithmetic, the conversion is done in one pass over the underlying storage,
+         * without creating a \ref variant for every element.
+         * All other element types, e.g. enumerations or `std::string`, are converted element by element.
+         * Narrowing conversions are checked, i.e. a value which does not fit into the target type lets the conversion fail.
+         *
+         * \code{.cpp}
+         *  std::vector<int32_t> vec = {1, 2, 3};
+         *  variant var = &vec;
+         *  auto view = var.create_array_view();
+         *  std::vector<double> result(view.get_size());
+         *  view.convert_to(type::get<double>(), result.data(), result.size());
+         * \endcode
+         *
+         * \remark \p out has to point to a buffer of at least \p count objects of the type \p target_type.
+         *         When the conversion fails, the content of the buffer is unspecified.
+         *
+         * \return True, when all elements could be converted; otherwise false,
+         *         e.g. \p count is bigger than the \ref get_size() "size" of the array or \p target_type is not arithmetic.
+         */
+        bool convert_to(const type& target_type, void* out, std::size_t count) const;
+
+        /*!
+         * \brief Converts the first \p count elements of the array to \p T and writes them into the buffer \p out.
+         *
+         * \see convert_to()
+         */
+        template<typename T>
+        bool copy_to(T* out, std::size_t count) const;
+
+        /*!
+         * \brief Returns a view to the elements [\p begin, \p end) of the first dimension of the array.
+         *
+         * The elements are not copied, the slice refers to the same storage as this view.
+         * For \ref is_contiguous() "contiguous" arrays \ref get_data() of the slice points directly to the element at \p begin;
+         * for node based containers, the slice holds the iterators to its first and its past-the-end element.
+         *
+         * The values of a slice can be read and written like the values of any other array,
+         * but its size is fixed, i.e. it is never \ref is_dynamic() "dynamic".
+         * Because slices which do not overlap refer to different elements,
+         * they can be used to process a large array in parallel:
+         * \code{.cpp}
+         *  std::vector<float> vec(1000000);
+         *  variant var = &vec;
+         *  auto view = var.create_array_view();
+         *  const std::size_t half = view.get_size() / 2;
+         *  auto lower = view.slice(0, half);
+         *  auto upper = view.slice(half, view.get_size());
+         *  std::thread worker([&lower]() { process(lower); });
+         *  process(upper);
+         *  worker.join();
+         * \endcode
+         *
+         * \remark The slice is only valid as long as the referenced array is alive and the size of its first dimension is not changed.
+         *         Writing to different elements of a `std::vector<bool>` from different threads is not safe.
+         *
+         * \return The slice, or an invalid view, when \p begin is bigger than \p end or \p end is bigger than \ref get_size().
+         */
+        variant_array_view slice(std::size_t begin, std::size_t end) const;
+
         /*!
          * \brief Returns the size of the first dimension from the array.
          *
@@ -298,6 +440,106 @@ class RTTR_API variant_array_view
          */
         bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list);
 
+        /*!
+         * \brief Preallocates the storage of the first dimension for at least \p new_capacity elements.
+         *
+         * For a custom \ref array_mapper, provide the static function `reserve()`;
+         * otherwise the request is ignored.
+         *
+         * \return True, when the array is \ref is_dynamic() "dynamic", otherwise false.
+         */
+        bool reserve(std::size_t new_capacity);
+
+        /*!
+         * \brief Appends all elements of the array \p source to the first dimension of this array.
+         *
+         * When \p source is \ref is_contiguous() "contiguous", its elements are copied in one step,
+         * otherwise one by one.
+         *
+         * \remark Both arrays must have the same \ref get_element_type() "element type"
+         *         and must not refer to the same array.
+         *
+         * \return True, when the elements could be appended, otherwise false.
+         */
+        bool append_range(const variant_array_view& source);
+
+        /*!
+         * \brief Appends \p count elements, beginning at \p data, to the first dimension of the array.
+         *
+         * The element type is checked only once for the whole range.
+         * Contiguous arrays of trivially copyable elements are filled with a single `memcpy`.
+         *
+         * \code{.cpp}
+         *  std::vector<float> vec;
+         *  variant var = &vec;
+         *  auto view = var.create_array_view();
+         *  const float samples[] = {1.0f, 2.0f, 3.0f};
+         *  view.append_range(samples, 3); // vec == {1.0f, 2.0f, 3.0f}
+         * \endcode
+         *
+         * \remark This operation is only possible when the array is \ref is_dynamic() "dynamic"
+         *         and \p T is exactly the \ref get_element_type() "element type".
+         *         The range must not refer to the elements of the array itself.
+         *
+         * \return True, when the elements could be appended, otherwise false.
+         */
+        template<typename T>
+        bool append_range(const T* data, std::size_t count);
+
+        /*!
+         * \brief Appends the range [\p first, \p last) to the first dimension of the array,
+         *        the elements will be moved instead of copied.
+         *
+         * \see append_range(const T*, std::size_t)
+         */
+        template<typename T>
+        bool append_range(std::move_iterator<T*> first, std::move_iterator<T*> last);
+
+        /*!
+         * \brief Replaces the content of the first dimension of the array with the elements of the array \p source.
+         *
+         * \see append_range(const variant_array_view&)
+         *
+         * \return True, when the elements could be assigned, otherwise false.
+         */
+        bool assign(const variant_array_view& source);
+
+        /*!
+         * \brief Replaces the content of the first dimension of the array with \p count elements, beginning at \p data.
+         *
+         * A dynamic array will be resized to \p count elements;
+         * an array with a fixed size can only be assigned, when its size is equal to \p count.
+         *
+         * \remark \p T has to be exactly the \ref get_element_type() "element type" of the array.
+         *         The range must not refer to the elements of the array itself.
+         *
+         * \return True, when the elements could be assigned, otherwise false.
+         */
+        template<typename T>
+        bool assign(const T* data, std::size_t count);
+
+        /*!
+         * \brief Replaces the content of the first dimension of the array with the range [\p first, \p last),
+         *        the elements will be moved instead of copied.
+         *
+         * \see assign(const T*, std::size_t)
+         */
+        template<typename T>
+        bool assign(std::move_iterator<T*> first, std::move_iterator<T*> last);
+
+        /*!
+         * \brief Replaces the content of the first dimension of the array with \p count elements of type \p element_type,
+         *        beginning at \p data.
+         *
+         * This is the type erased version of \ref assign(const T*, std::size_t), for code which knows the element type only at runtime,
+         * e.g. a deserializer, which has read the elements into a buffer.
+         *
+         * \remark \p element_type has to be exactly the \ref get_element_type() "element type" of the array.
+         *
+         * \return True, when the elements could be assigned, otherwise false.
+         */
+        bool assign(const type& element_type, const void* data, std::size_t count);
+
         /*!
          * \brief Copies the content of the the array \p arg into the underlying array.
          *
@@ -438,13 +680,161 @@ class RTTR_API variant_array_view
          */
         bool remove_value_variadic(const std::vector<std::size_t>& index_list);
 
+        /*!
+         * \brief Returns an iterator to the first element in the first dimension of the array.
+         *
+         * \remark When the array is empty or the view is invalid, the returned iterator is equal to \ref end().
+         *
+         * \return An iterator to the first element.
+         */
+        const_iterator begin() const;
+
+        /*!
+         * \brief Returns an iterator to the element following the last element in the first dimension of the array.
+         *
+         * \return An iterator to the element following the last element.
+         */
+        const_iterator end() const;
+
+        /*!
+         * \brief Returns a reverse iterator to the last element in the first dimension of the array.
+         *
+         * \return A reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const;
+
+        /*!
+         * \brief Returns a reverse iterator to the element preceding the first element in the first dimension of the array.
+         *
+         * \return A reverse iterator to the element preceding the first element.
+         */
+        const_reverse_iterator rend() const;
+
+        /*!
+         * \brief Sets the given argument \p arg to the element at the position \p pos.
+         *
+         * \remark The type of \p arg has to match exactly the element type of the array.
+         *
+         * \return True if the value could be set, otherwise false.
+         */
+        bool set_value(const const_iterator& pos, argument arg);
+
+        /*!
+         * \brief Inserts the given argument \p arg before the element at the position \p pos.
+         *
+         * \remark This operation is only possible when the array is \ref is_dynamic() "dynamic".
+         *         All iterators, which refer to this array, might be invalidated, except the returned one.
+         *
+         * \return An iterator to the inserted element; or \ref end() when \p arg could not be inserted.
+         */
+        const_iterator insert_value(const const_iterator& pos, argument arg);
+
+        /*!
+         * \brief Removes the element at the position \p pos.
+         *
+         * \remark This operation is only possible when the array is \ref is_dynamic() "dynamic".
+         *         All iterators, which refer to this array, might be invalidated, except the returned one.
+         *
+         * \return An iterator to the element following the removed one; or \ref end() when nothing was removed.
+         */
+        const_iterator remove_value(const const_iterator& pos);
+
     private:
         friend class variant;
         friend class argument;
+        friend class variant_ndarray_view;
 
         std::unique_ptr<detail::array_wrapper_base> m_array_wrapper;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref variant_array_view::const_iterator allows to traverse the first dimension of an array.
+ * Dereferencing the iterator yields a \ref variant_ref to the element, the element itself is not copied.
+ *
+ * The iterator is bidirectional, use \ref variant_array_view::rbegin() "rbegin()" for traversing the array in reverse order.
+ *
+ * \remark An iterator can only be used as long as the \ref variant_array_view it was created from and the underlying array are alive.
+ *         Changing the size of the array might invalidate it.
+ */
+class RTTR_API variant_array_view::const_iterator
+{
+    public:
+        using self_type         = const_iterator;
+        using value_type        = variant_ref;
+        using reference         = variant_ref;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /*!
+         * \brief Constructs an iterator, which does not refer to any array.
+         */
+        const_iterator();
+
+        /*!
+         * \brief Constructs a copy of the given iterator \p other.
+         */
+        const_iterator(const const_iterator& other);
+
+        /*!
+         * \brief Destroys the iterator.
+         */
+        ~const_iterator();
+
+        /*!
+         * \brief Assigns the iterator \p other to this iterator.
+         */
+        const_iterator& operator=(const const_iterator& other);
+
+        /*!
+         * \brief Returns a reference to the current element.
+         *
+         * \remark Do not dereference the \ref variant_array_view::end() "end" iterator.
+         */
+        variant_ref operator*() const;
+
+        /*!
+         * \brief Pre-increment operator, advances the iterator to the next element.
+         */
+        const_iterator& operator++();
+
+        /*!
+         * \brief Post-increment operator, advances the iterator to the next element.
+         */
+        const_iterator operator++(int);
+
+        /*!
+         * \brief Pre-decrement operator, moves the iterator to the previous element.
+         */
+        const_iterator& operator--();
+
+        /*!
+         * \brief Post-decrement operator, moves the iterator to the previous element.
+         */
+        const_iterator operator--(int);
+
+        /*!
+         * \brief Returns true when both iterators refer to the same element, otherwise false.
+         */
+        bool operator==(const const_iterator& other) const;
+
+        /*!
+         * \brief Returns true when both iterators refer NOT to the same element, otherwise false.
+         */
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        explicit const_iterator(const detail::array_wrapper_base* wrapper, bool at_end);
+
+        friend class variant_array_view;
+
+        const detail::array_wrapper_base*       m_wrapper;
+        const detail::iterator_manager*   m_manager;
+        detail::iterator_data             m_itr;
+};
+
 } // end namespace rttr
 
 #include "rttr/detail/variant_array_view/variant_array_view_impl.h"
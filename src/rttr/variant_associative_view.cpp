@@ -0,0 +1,321 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/variant_associative_view.h"
+
+#include "rttr/argument.h"
+#include "rttr/variant_ref.h"
+#include "rttr/detail/associative/associative_wrapper_base.h"
+
+using namespace std;
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::variant_associative_view()
+:   m_wrapper(detail::make_unique<detail::associative_wrapper_base>())
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::variant_associative_view(const variant_associative_view& other)
+:   m_wrapper(other.m_wrapper->clone())
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::variant_associative_view(variant_associative_view&& other)
+:   m_wrapper(std::move(other.m_wrapper))
+{
+    other.m_wrapper = detail::make_unique<detail::associative_wrapper_base>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::~variant_associative_view()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void variant_associative_view::swap(variant_associative_view& other)
+{
+    std::swap(m_wrapper, other.m_wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view& variant_associative_view::operator=(const variant_associative_view& other)
+{
+    variant_associative_view(other).swap(*this);
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::is_valid() const
+{
+    return m_wrapper->is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::operator bool() const
+{
+    return m_wrapper->is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_associative_view::get_type() const
+{
+    return m_wrapper->get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_associative_view::get_key_type() const
+{
+    return m_wrapper->get_key_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_associative_view::get_value_type() const
+{
+    return m_wrapper->get_value_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::is_key_only_type() const
+{
+    return m_wrapper->is_key_only_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::get_size() const
+{
+    return m_wrapper->get_size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::clear()
+{
+    return m_wrapper->clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator variant_associative_view::begin() const
+{
+    const_iterator itr(m_wrapper.get());
+    itr.m_manager = m_wrapper->create_iterator(itr.m_itr, false);
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator variant_associative_view::end() const
+{
+    const_iterator itr(m_wrapper.get());
+    itr.m_manager = m_wrapper->create_iterator(itr.m_itr, true);
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator variant_associative_view::find(argument key) const
+{
+    const_iterator itr(m_wrapper.get());
+    itr.m_manager = m_wrapper->find(itr.m_itr, key);
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::pair<variant_associative_view::const_iterator, bool> variant_associative_view::insert(argument key)
+{
+    bool success = false;
+    const_iterator itr(m_wrapper.get());
+    itr.m_manager = m_wrapper->insert(itr.m_itr, key, success);
+    return std::make_pair(itr, success);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::pair<variant_associative_view::const_iterator, bool> variant_associative_view::insert(argument key, argument value)
+{
+    bool success = false;
+    const_iterator itr(m_wrapper.get());
+    itr.m_manager = m_wrapper->insert(itr.m_itr, key, value, success);
+    return std::make_pair(itr, success);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::insert_range(const variant_associative_view& other)
+{
+    return m_wrapper->insert_range(*other.m_wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::erase(argument key)
+{
+    return m_wrapper->erase(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator::const_iterator()
+:   m_wrapper(nullptr),
+    m_manager(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator::const_iterator(const detail::associative_wrapper_base* wrapper)
+:   m_wrapper(wrapper),
+    m_manager(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator::const_iterator(const const_iterator& other)
+:   m_wrapper(other.m_wrapper),
+    m_manager(other.m_manager)
+{
+    if (m_manager)
+        m_manager->copy(other.m_itr, m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator::~const_iterator()
+{
+    if (m_manager)
+        m_manager->destroy(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator& variant_associative_view::const_iterator::operator=(const const_iterator& other)
+{
+    if (this == &other)
+        return *this;
+
+    if (m_manager)
+        m_manager->destroy(m_itr);
+
+    m_wrapper = other.m_wrapper;
+    m_manager = other.m_manager;
+
+    if (m_manager)
+        m_manager->copy(other.m_itr, m_itr);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::pair<variant_ref, variant_ref> variant_associative_view::const_iterator::operator*() const
+{
+    return std::make_pair(get_key(), get_value());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref variant_associative_view::const_iterator::get_key() const
+{
+    variant_ref result;
+    if (m_manager)
+        m_wrapper->get_key(m_itr, result);
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref variant_associative_view::const_iterator::get_value() const
+{
+    variant_ref result;
+    if (m_manager)
+        m_wrapper->get_value(m_itr, result);
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator& variant_associative_view::const_iterator::operator++()
+{
+    if (m_manager)
+        m_wrapper->advance_iterator(m_itr);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view::const_iterator variant_associative_view::const_iterator::operator++(int)
+{
+    const_iterator result(*this);
+    ++(*this);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::const_iterator::operator==(const const_iterator& other) const
+{
+    if (m_wrapper != other.m_wrapper || m_manager != other.m_manager)
+        return false;
+
+    return (!m_manager || m_wrapper->equal_iterator(m_itr, other.m_itr));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::const_iterator::operator!=(const const_iterator& other) const
+{
+    return !(*this == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
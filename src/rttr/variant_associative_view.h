@@ -0,0 +1,377 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_ASSOCIATIVE_VIEW_H_
+#define RTTR_VARIANT_ASSOCIATIVE_VIEW_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/detail/misc/iterator_storage.h"
+#include "rttr/variant.h"
+
+#include <cstddef>
+#include <memory>
+#include <iterator>
+#include <utility>
+
+namespace rttr
+{
+    class type;
+    class argument;
+    class variant_ref;
+
+namespace detail
+{
+    class associative_wrapper_base;
+}
+
+/*!
+ * The \ref variant_associative_view describes a class that refers to an
+ * <a target="_blank" href=https://en.wikipedia.org/wiki/Associative_containers>associative container</a> (e.g. `std::map`)
+ * inside a \ref variant.
+ * With an instance of that class you can iterate over the elements, find, insert or erase elements,
+ * without having access to the type declaration of the container or it's elements.
+ *
+ * A \ref variant_associative_view can be created directly from a \ref variant with its member function
+ * \ref variant::create_associative_view() "create_associative_view()".
+ * \remark The instance of an variant_associative_view is always valid till the referenced \ref variant is valid, otherwise accessing a variant_associative_view
+ *         is undefined behaviour.
+ *
+ * Meta Information
+ * ----------------
+ * The container can be traversed with a \ref variant_associative_view::const_iterator "const_iterator".
+ * The iterator yields for every element a \ref variant_ref to the key and to the value, so no element will be copied.
+ * Containers which store only keys (e.g. `std::set<Key>`) are \ref is_key_only_type() "key only types",
+ * for them the value is always invalid.
+ *
+ * A lookup with \ref find() uses the lookup function of the container itself, e.g. `std::map<Key, T>::find()`.
+ * Therefore the type of the given key has to match exactly the \ref get_key_type() "key type" of the container.
+ *
+ * RTTR recognize whether a type is an associative container or not with the help of the \ref associative_mapper class template.
+ * At the moment there exist specializations for following types:
+ * `std::map<Key, T>`, `std::multimap<Key, T>`, `std::unordered_map<Key, T>`, `std::unordered_multimap<Key, T>`,
+ * `std::set<Key>`, `std::multiset<Key>`, `std::unordered_set<Key>` and `std::unordered_multiset<Key>`.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref variant_associative_view object can be copied and assigned,
+ * however each copy will reference the address of same underlying \ref variant value.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  std::map<std::string, int> settings = { {"width", 800}, {"height", 600} };
+ *  variant var = &settings;
+ *  if (var.is_associative_container())
+ *  {
+ *    variant_associative_view view = var.create_associative_view();
+ *    for (auto itr = view.begin(); itr != view.end(); ++itr)
+ *    {
+ *      std::cout << itr.get_key().to_string() << ": " << itr.get_value().to_string() << std::endl;
+ *    }
+ *
+ *    auto itr = view.find(std::string("width"));
+ *    if (itr != view.end())
+ *      std::cout << itr.get_value().get_value<int>(); // prints "800"
+ *
+ *    view.insert(std::string("depth"), 32);
+ *  }
+ * \endcode
+ *
+ * \see variant, variant_array_view
+ */
+class RTTR_API variant_associative_view
+{
+    public:
+        class const_iterator;
+
+        /*!
+         * \brief Constructs an invalid variant_associative_view object.
+         *
+         * \see is_valid()
+         */
+        variant_associative_view();
+
+        /*!
+         * \brief Constructs a copy of the given variant_associative_view \p other.
+         */
+        variant_associative_view(const variant_associative_view& other);
+
+        /*!
+         * \brief Constructs a new variant_associative_view via move constructor.
+         */
+        variant_associative_view(variant_associative_view&& other);
+
+        /*!
+         * \brief Destroys the variant_associative_view and the contained data.
+         */
+        ~variant_associative_view();
+
+        /*!
+         * \brief Assigns the value of the \a other variant_associative_view to this variant_associative_view.
+         *
+         * \return A reference to the variant_associative_view with the new data.
+         */
+        variant_associative_view& operator=(const variant_associative_view& other);
+
+        /*!
+         * \brief Returns true if this variant_associative_view is valid, that means the object is holding some data.
+         *        When the variant_associative_view doesn't hold any data it will return false.
+         *
+         * \return True if this view is valid, otherwise false.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Convenience function to check if this \ref variant_associative_view is valid or not.
+         *
+         * \see is_valid()
+         *
+         * \return True if this \ref variant_associative_view is valid, otherwise false.
+         */
+        explicit operator bool() const;
+
+        /*!
+         * \brief Swaps this variant_associative_view with the \a other variant_associative_view.
+         */
+        void swap(variant_associative_view& other);
+
+        /*!
+         * \brief Returns the \ref type object of this associative container.
+         *
+         * \remark When the view is not valid, this function will return an invalid type object.
+         *
+         * \return \ref type "Type" of the associative container.
+         */
+        type get_type() const;
+
+        /*!
+         * \brief Returns the \ref type object of the keys of this associative container.
+         *
+         * \remark When the view is not valid, this function will return an invalid type object.
+         *
+         * \return \ref type "Type" of the keys.
+         */
+        type get_key_type() const;
+
+        /*!
+         * \brief Returns the \ref type object of the values of this associative container.
+         *
+         * \remark When the view is not valid or the container is a \ref is_key_only_type() "key only type",
+         *         this function will return an invalid type object.
+         *
+         * \return \ref type "Type" of the values.
+         */
+        type get_value_type() const;
+
+        /*!
+         * \brief Returns true, when the container stores only keys, e.g. a `std::set<Key>`; otherwise false.
+         *
+         * \return True when this container is a key only type, otherwise false.
+         */
+        bool is_key_only_type() const;
+
+        /*!
+         * \brief Returns the number of elements in the associative container.
+         *
+         * \return The number of elements.
+         */
+        std::size_t get_size() const;
+
+        /*!
+         * \brief Removes all elements from the associative container.
+         *
+         * \return True if the container could be cleared, otherwise false.
+         */
+        bool clear();
+
+        /*!
+         * \brief Returns an iterator to the first element of the container.
+         *
+         * \remark When the container is empty or the view is invalid, the returned iterator is equal to \ref end().
+         *
+         * \return An iterator to the first element.
+         */
+        const_iterator begin() const;
+
+        /*!
+         * \brief Returns an iterator to the element following the last element of the container.
+         *
+         * \return An iterator to the element following the last element.
+         */
+        const_iterator end() const;
+
+        /*!
+         * \brief Finds an element with a key equivalent to \p key, with the lookup function of the container.
+         *
+         * \remark The type of \p key has to match exactly the \ref get_key_type() "key type".
+         *
+         * \return An iterator to the found element; otherwise \ref end().
+         */
+        const_iterator find(argument key) const;
+
+        /*!
+         * \brief Inserts the given \p key into a \ref is_key_only_type() "key only" container.
+         *
+         * \remark The type of \p key has to match exactly the \ref get_key_type() "key type".
+         *
+         * \return A pair consisting of an iterator to the inserted element (or to the element that prevented the insertion)
+         *         and a `bool` denoting whether the insertion took place. When \p key could not be inserted at all,
+         *         the iterator is equal to \ref end().
+         */
+        std::pair<const_iterator, bool> insert(argument key);
+
+        /*!
+         * \brief Inserts the given \p key and \p value into the container.
+         *
+         * \remark The types of \p key and \p value have to match exactly the \ref get_key_type() "key type"
+         *         and the \ref get_value_type() "value type".
+         *
+         * \return A pair consisting of an iterator to the inserted element (or to the element that prevented the insertion)
+         *         and a `bool` denoting whether the insertion took place. When \p key could not be inserted at all,
+         *         the iterator is equal to \ref end().
+         */
+        std::pair<const_iterator, bool> insert(argument key, argument value);
+
+        /*!
+         * \brief Inserts all elements of the container referred by \p other into this container.
+         *
+         * The elements are inserted with one call of the range insert function of the container.
+         *
+         * \remark Both containers have to be of the same \ref get_type() "type".
+         *
+         * \return True if the elements could be inserted, otherwise false.
+         */
+        bool insert_range(const variant_associative_view& other);
+
+        /*!
+         * \brief Removes all elements with a key equivalent to \p key.
+         *
+         * \return The number of removed elements.
+         */
+        std::size_t erase(argument key);
+
+    private:
+        friend class variant;
+        friend class variant_ref;
+
+        std::unique_ptr<detail::associative_wrapper_base> m_wrapper;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref variant_associative_view::const_iterator allows to traverse an associative container.
+ * Dereferencing the iterator yields a pair of \ref variant_ref objects, which refer to the key and the value of the element;
+ * the element itself is not copied.
+ *
+ * \remark An iterator can only be used as long as the \ref variant_associative_view it was created from and the underlying container are alive.
+ *         Inserting or removing elements might invalidate it.
+ */
+class RTTR_API variant_associative_view::const_iterator
+{
+    public:
+        using self_type         = const_iterator;
+        using value_type        = std::pair<variant_ref, variant_ref>;
+        using reference         = value_type;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        /*!
+         * \brief Constructs an iterator, which does not refer to any container.
+         */
+        const_iterator();
+
+        /*!
+         * \brief Constructs a copy of the given iterator \p other.
+         */
+        const_iterator(const const_iterator& other);
+
+        /*!
+         * \brief Destroys the iterator.
+         */
+        ~const_iterator();
+
+        /*!
+         * \brief Assigns the iterator \p other to this iterator.
+         */
+        const_iterator& operator=(const const_iterator& other);
+
+        /*!
+         * \brief Returns a pair of references to the key and to the value of the current element.
+         *
+         * \remark Do not dereference the \ref variant_associative_view::end() "end" iterator.
+         */
+        std::pair<variant_ref, variant_ref> operator*() const;
+
+        /*!
+         * \brief Returns a reference to the key of the current element.
+         */
+        variant_ref get_key() const;
+
+        /*!
+         * \brief Returns a reference to the value of the current element.
+         *
+         * \remark For \ref variant_associative_view::is_key_only_type() "key only" containers an invalid reference is returned.
+         */
+        variant_ref get_value() const;
+
+        /*!
+         * \brief Pre-increment operator, advances the iterator to the next element.
+         */
+        const_iterator& operator++();
+
+        /*!
+         * \brief Post-increment operator, advances the iterator to the next element.
+         */
+        const_iterator operator++(int);
+
+        /*!
+         * \brief Returns true when both iterators refer to the same element, otherwise false.
+         */
+        bool operator==(const const_iterator& other) const;
+
+        /*!
+         * \brief Returns true when both iterators refer NOT to the same element, otherwise false.
+         */
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        explicit const_iterator(const detail::associative_wrapper_base* wrapper);
+
+        friend class variant_associative_view;
+
+        const detail::associative_wrapper_base* m_wrapper;
+        const detail::iterator_manager*         m_manager;
+        detail::iterator_data                   m_itr;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_ASSOCIATIVE_VIEW_H_
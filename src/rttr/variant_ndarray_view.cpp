@@ -0,0 +1,188 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/variant_ndarray_view.h"
+
+#include "rttr/argument.h"
+#include "rttr/instance.h"
+#include "rttr/type.h"
+
+using namespace std;
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ndarray_view::variant_ndarray_view()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ndarray_view::variant_ndarray_view(const variant_array_view& view)
+:   variant_array_view(view)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ndarray_view::variant_ndarray_view(variant_array_view&& view)
+:   variant_array_view(std::move(view))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ndarray_view::is_regular() const
+{
+    const std::size_t rank = get_rank();
+    if (rank == 0)
+        return false;
+
+    for (std::size_t dim = 1; dim < rank; ++dim)
+    {
+        if (m_array_wrapper->get_fixed_size(dim) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ndarray_view::is_flat() const
+{
+    if (!is_contiguous() || !is_regular())
+        return false;
+
+    // e.g. a std::array<T, N> might contain padding bytes
+    const std::size_t rank = get_rank();
+    for (std::size_t dim = 1; dim < rank; ++dim)
+    {
+        if (get_rank_type(dim).get_sizeof() != m_array_wrapper->get_fixed_size(dim) * get_rank_type(dim + 1).get_sizeof())
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_ndarray_view::get_shape(std::size_t dim) const
+{
+    if (dim >= get_rank())
+        return 0;
+
+    return (dim == 0 ? get_size() : m_array_wrapper->get_fixed_size(dim));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::size_t> variant_ndarray_view::get_shape() const
+{
+    const std::size_t rank = get_rank();
+    std::vector<std::size_t> shape;
+    shape.reserve(rank);
+    for (std::size_t dim = 0; dim < rank; ++dim)
+        shape.push_back(get_shape(dim));
+
+    return shape;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_ndarray_view::get_stride(std::size_t dim) const
+{
+    if (dim >= get_rank() || !is_flat())
+        return 0;
+
+    return get_rank_type(dim + 1).get_sizeof();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_ndarray_view::get_value_type() const
+{
+    return get_rank_type(get_rank());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_ndarray_view::get_element_count() const
+{
+    if (!is_regular())
+        return 0;
+
+    std::size_t count = 1;
+    const std::size_t rank = get_rank();
+    for (std::size_t dim = 0; dim < rank; ++dim)
+        count *= get_shape(dim);
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* variant_ndarray_view::get_flat_data() const
+{
+    return (is_flat() ? get_data() : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref variant_ndarray_view::at(std::initializer_list<std::size_t> indices) const
+{
+    return get_element(indices.begin(), indices.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ndarray_view::set_at(std::initializer_list<std::size_t> indices, argument arg)
+{
+    if (indices.size() != get_rank() || indices.size() == 0)
+        return false;
+
+    return m_array_wrapper->set_element(indices.begin(), arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref variant_ndarray_view::get_element(const std::size_t* indices, std::size_t count) const
+{
+    variant_ref result;
+    if (count != get_rank() || count == 0)
+        return result;
+
+    m_array_wrapper->get_element(indices, result);
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
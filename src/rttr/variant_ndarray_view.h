@@ -0,0 +1,197 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_NDARRAY_VIEW_H_
+#define RTTR_VARIANT_NDARRAY_VIEW_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_ref.h"
+
+#include <cstddef>
+#include <vector>
+#include <initializer_list>
+
+namespace rttr
+{
+class type;
+class argument;
+
+/*!
+ * The \ref variant_ndarray_view extends a \ref variant_array_view with the description of a multi-dimensional array
+ * as a whole: its \ref get_shape() "shape", the \ref get_stride(std::size_t) const "strides" of every dimension and
+ * direct access to its innermost elements.
+ *
+ * In contrast to \ref variant_array_view::get_value_variadic() "get_value_variadic()", the function \ref at()
+ * takes one index per dimension without allocating an index list:
+ * \code{.cpp}
+ *  float image[64][64][4] = {};
+ *  variant var = &image;
+ *  variant_ndarray_view view(var.create_array_view());
+ *  view.set_at({2, 3, 1}, 0.5f);
+ *  float value = view.at(2, 3, 1).get_value<float>(); // 0.5f
+ * \endcode
+ *
+ * Shape
+ * ----------------------
+ * The array is \ref is_regular() "regular", when the size of every dimension, except the first one, is fixed by its type;
+ * e.g. `float[64][64][4]` or `std::vector<std::array<float, 4>>`, but not `std::vector<std::vector<float>>`.
+ * When additionally all elements are stored in one block of memory, the array is \ref is_flat() "flat"
+ * and \ref get_flat_data() gives access to all \ref get_element_count() "innermost elements" in row-major order.
+ *
+ * \remark The lifetime rules of \ref variant_array_view apply also to this class.
+ */
+class RTTR_API variant_ndarray_view : public variant_array_view
+{
+    public:
+        /*!
+         * \brief Constructs an invalid variant_ndarray_view object.
+         *
+         * \see is_valid()
+         */
+        variant_ndarray_view();
+
+        /*!
+         * \brief Constructs a variant_ndarray_view, which refers to the same array as \p view.
+         */
+        explicit variant_ndarray_view(const variant_array_view& view);
+
+        /*!
+         * \brief Constructs a variant_ndarray_view from the given \p view, the content of \p view will be moved.
+         */
+        explicit variant_ndarray_view(variant_array_view&& view);
+
+        /*!
+         * \brief Returns true, when the size of every dimension, except the first one, is fixed by the type of the array.
+         *
+         * \return True, when the array has a well defined shape; otherwise false.
+         */
+        bool is_regular() const;
+
+        /*!
+         * \brief Returns true, when the array is \ref is_regular() "regular" and all its
+         *        innermost elements are stored contiguously in memory, without any padding.
+         *
+         * \return True, when \ref get_flat_data() returns a valid pointer; otherwise false.
+         */
+        bool is_flat() const;
+
+        /*!
+         * \brief Returns the size of the dimension \p dim.
+         *
+         * The size of the first dimension is always the current \ref get_size() "size" of the array.
+         *
+         * \return The size of the dimension, or `0` when the size of this dimension is not fixed by the type
+         *         or \p dim is not smaller than the \ref get_rank() "rank".
+         */
+        std::size_t get_shape(std::size_t dim) const;
+
+        /*!
+         * \brief Returns the size of all dimensions, see \ref get_shape(std::size_t) const.
+         *
+         * \return A list of \ref get_rank() sizes.
+         */
+        std::vector<std::size_t> get_shape() const;
+
+        using variant_array_view::get_stride;
+
+        /*!
+         * \brief Returns the distance in bytes between two consecutive elements of the dimension \p dim.
+         *
+         * E.g. for `float[64][64][4]` the strides are `1024`, `16` and `4`.
+         *
+         * \return The stride in bytes, or `0` when the array is not \ref is_flat() "flat".
+         */
+        std::size_t get_stride(std::size_t dim) const;
+
+        /*!
+         * \brief Returns the \ref type of the innermost elements, e.g. `float` for `float[64][64][4]`.
+         *
+         * \return The value type, or an invalid type, when the view is not valid.
+         */
+        type get_value_type() const;
+
+        /*!
+         * \brief Returns the number of innermost elements, i.e. the product of all dimension sizes.
+         *
+         * \return The element count, or `0` when the array is not \ref is_regular() "regular".
+         */
+        std::size_t get_element_count() const;
+
+        /*!
+         * \brief Returns a pointer to the first innermost element of the array.
+         *
+         * The memory holds \ref get_element_count() elements of type \ref get_value_type() in row-major order.
+         *
+         * \return A pointer to the data, or `nullptr` when the array is not \ref is_flat() "flat".
+         */
+        void* get_flat_data() const;
+
+        /*!
+         * \brief Returns a typed pointer to the first innermost element of the array.
+         *
+         * \return A pointer to the data, or `nullptr` when the array is not \ref is_flat() "flat"
+         *         or the value type is not exactly \p T.
+         */
+        template<typename T>
+        T* get_flat_data() const;
+
+        /*!
+         * \brief Returns a reference to the innermost element at the given \p indices, one index for every dimension.
+         *
+         * \return A \ref variant_ref to the element; or an invalid one,
+         *         when the count of indices does not match the \ref get_rank() "rank" or an index is out of range.
+         */
+        variant_ref at(std::initializer_list<std::size_t> indices) const;
+
+        /*!
+         * \brief Returns a reference to the innermost element at the given indices, one index for every dimension.
+         *
+         * \see at(std::initializer_list<std::size_t>) const
+         */
+        template<typename... Indices>
+        variant_ref at(std::size_t index_1, Indices... indices) const;
+
+        /*!
+         * \brief Sets the innermost element at the given \p indices to the value of \p arg.
+         *
+         * \remark The type of \p arg has to match exactly the \ref get_value_type() "value type".
+         *
+         * \return True, when the value could be set; otherwise false.
+         */
+        bool set_at(std::initializer_list<std::size_t> indices, argument arg);
+
+    private:
+        variant_ref get_element(const std::size_t* indices, std::size_t count) const;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/variant_array_view/variant_ndarray_view_impl.h"
+
+#endif // RTTR_VARIANT_NDARRAY_VIEW_H_
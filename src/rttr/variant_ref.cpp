@@ -0,0 +1,179 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/variant_ref.h"
+
+#include "rttr/detail/variant/variant_data_policy.h"
+#include "rttr/variant_array_view.h"
+#include "rttr/variant_associative_view.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref::variant_ref(variant&& value)
+:   m_var(std::move(value))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::is_valid() const
+{
+    return m_var.is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_ref::operator bool() const
+{
+    return m_var.is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_ref::get_type() const
+{
+    return m_var.get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::is_array() const
+{
+    return m_var.is_array();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::is_associative_container() const
+{
+    return m_var.is_associative_container();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::can_convert(const type& target_type) const
+{
+    return m_var.can_convert(target_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant variant_ref::convert(const type& target_type, bool* ok) const
+{
+    variant result;
+    bool could_convert = false;
+    // a plain copy of 'm_var' would copy only the reference, so the same type has to be handled separately
+    if (target_type == get_type())
+    {
+        result = to_variant();
+        could_convert = result.is_valid();
+    }
+    else
+    {
+        could_convert = m_var.convert(target_type, result);
+    }
+
+    if (ok)
+        *ok = could_convert;
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string variant_ref::to_string(bool* ok) const
+{
+    return m_var.to_string(ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view variant_ref::create_array_view() const
+{
+    return m_var.create_array_view();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_associative_view variant_ref::create_associative_view() const
+{
+    return m_var.create_associative_view();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant variant_ref::to_variant() const
+{
+    variant result;
+    if (!m_var.m_policy(detail::variant_policy_operation::COPY_REFERENCED_VALUE, m_var.m_data, result))
+        result = m_var;
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator==(const variant_ref& other) const
+{
+    return (m_var == other.m_var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator!=(const variant_ref& other) const
+{
+    return (m_var != other.m_var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator==(const variant& other) const
+{
+    return (m_var == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator!=(const variant& other) const
+{
+    return (m_var != other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_ref::operator<(const variant_ref& other) const
+{
+    return (m_var < other.m_var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,332 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_REF_H_
+#define RTTR_VARIANT_REF_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/variant.h"
+
+#include <string>
+
+namespace rttr
+{
+class type;
+class instance;
+class variant_array_view;
+class variant_associative_view;
+
+namespace detail
+{
+    class property_wrapper_base;
+    template<typename Arr, typename Itr>
+    struct array_iterator_accessor_base;
+}
+
+/*!
+ * The \ref variant_ref class refers to an existing object together with its \ref type,
+ * without copying or taking the ownership of it.
+ *
+ * A \ref variant stores always a copy of the given value. For inspecting e.g. a `std::string` or a `std::vector<T>`
+ * member of a class, this means a deep copy of the member only to read it.
+ * The \ref variant_ref class instead stores only the address of the object, but offers the same read-only
+ * functionality like a variant: \ref get_value(), \ref convert(), comparison and \ref create_array_view().
+ *
+ * A \ref variant_ref can be created directly from an object or via \ref property::get_ref().
+ * \remark The instance of a variant_ref is only valid as long as the referenced object is alive, otherwise accessing a variant_ref
+ *         is undefined behaviour.
+ *
+ * When a \ref variant_ref is retrieved from a property which has no addressable storage,
+ * e.g. a getter function which returns by value, the returned \ref variant_ref holds the value itself.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref variant_ref object is lightweight and can be copied by value; each copy will refer to the same underlying object.
+ * To create an independent copy of the referenced object, use \ref to_variant().
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  struct MyStruct { std::vector<int> data; };
+ *  //...
+ *  MyStruct obj;
+ *  property prop = type::get(obj).get_property("data");
+ *  variant_ref ref = prop.get_ref(obj);   // no copy of 'obj.data' is done
+ *  if (ref.is_array())
+ *  {
+ *      variant_array_view view = ref.create_array_view();
+ *      for (std::size_t i = 0; i < view.get_size(); ++i)
+ *          std::cout << view.get_value(i).to_string();
+ *  }
+ * \endcode
+ *
+ * \see variant, property::get_ref()
+ */
+class RTTR_API variant_ref
+{
+    template<typename T, typename Tp = detail::decay_t<T>>
+    using decay_variant_ref_t = detail::enable_if_t<!std::is_same<variant_ref, Tp>::value &&
+                                                    !std::is_same<variant, Tp>::value, T>;
+
+    public:
+        /*!
+         * \brief Constructs an invalid variant_ref. That means a reference which refers to no object.
+         *
+         * \see is_valid()
+         */
+        RTTR_INLINE variant_ref();
+
+        /*!
+         * \brief Constructs a new variant_ref, which refers to the given object \p value.
+         *        The object will not be copied.
+         */
+        template<typename T, typename Tp = decay_variant_ref_t<T>>
+        RTTR_INLINE variant_ref(T& value);
+
+        /*!
+         * \brief Returns true if this variant_ref is valid, that means it refers to an object or holds a value.
+         *
+         * \return True if this variant_ref is valid, otherwise false.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Convenience function to check if this \ref variant_ref is valid or not.
+         *
+         * \see is_valid()
+         *
+         * \return True if this \ref variant_ref is valid, otherwise false.
+         */
+        explicit operator bool() const;
+
+        /*!
+         * \brief Returns the type of the referenced object.
+         *
+         * \remark When the variant_ref is not valid, an invalid type is returned.
+         *
+         * \return \ref type "Type" of the referenced object.
+         */
+        type get_type() const;
+
+        /*!
+         * \brief Returns true if the referenced object is of the given type \p T.
+         *
+         * \return True if the referenced object is of type \p T, otherwise false.
+         */
+        template<typename T>
+        RTTR_INLINE bool is_type() const;
+
+        /*!
+         * \brief Returns true, when the referenced object is an array.
+         *
+         * \see create_array_view()
+         *
+         * \return True if the referenced object is an array; otherwise false.
+         */
+        bool is_array() const;
+
+        /*!
+         * \brief Returns true, when the referenced object is an associative container.
+         *
+         * \see create_associative_view()
+         *
+         * \return True if the referenced object is an associative container; otherwise false.
+         */
+        bool is_associative_container() const;
+
+        /*!
+         * \brief Returns a reference to the referenced object.
+         *
+         * \remark Only call this method when it is possible to return the object as the given type \p T.
+         *         Use therefore the method \ref is_type(). Otherwise the call leads to undefined behaviour.
+         *
+         * \return A reference to the referenced object.
+         */
+        template<typename T>
+        RTTR_INLINE const T& get_value() const;
+
+        /*!
+         * \brief Returns `true` if the referenced object can be converted to the given type \p T.
+         *
+         * \see variant::can_convert()
+         *
+         * \return `True` if the referenced object can be converted to `T`; otherwise `false`.
+         */
+        template<typename T>
+        RTTR_INLINE bool can_convert() const;
+
+        /*!
+         * \brief Returns `true` if the referenced object can be converted to the given type \p target_type.
+         *
+         * \see variant::can_convert()
+         *
+         * \return `True` if the referenced object can be converted to \p target_type; otherwise `false`.
+         */
+        bool can_convert(const type& target_type) const;
+
+        /*!
+         * \brief Converts the referenced object to the given type \p target_type and returns the result
+         *        as new \ref variant. The referenced object itself is not modified.
+         *
+         *  If \p ok is non-null: \p *ok is set to `true` when the value was successfully converted; otherwise \p *ok is set to `false`.
+         *
+         * \remark When \p target_type is the type of the referenced object, a copy of the object is returned.
+         *
+         * \see to_variant()
+         *
+         * \return The converted value; or an invalid variant, when the conversion was not possible.
+         */
+        variant convert(const type& target_type, bool* ok = nullptr) const;
+
+        /*!
+         * \brief Converts the referenced object to the given type \p T.
+         *
+         *  If \p ok is non-null: \p *ok is set to `true` when the value was successfully converted to \p T; otherwise \p *ok is set to `false`.
+         *
+         * \see variant::convert(bool* ok)
+         *
+         * \return The converted value as type \p T.
+         */
+        template<typename T>
+        RTTR_INLINE T convert(bool* ok = nullptr) const;
+
+        /*!
+         * \brief Converts the referenced object to the given \p value of type \p T.
+         *
+         * \see variant::convert(T& value)
+         *
+         * \return `True` if the referenced object could be converted to \p value; otherwise `false`.
+         */
+        template<typename T>
+        RTTR_INLINE bool convert(T& value) const;
+
+        /*!
+         * \brief Returns the referenced object as a `std::string`.
+         *
+         * If \p ok is non-null: \p *ok is set to `true` if the value could be converted to an `std::string`; otherwise \p *ok is set to `false`.
+         *
+         * \see variant::to_string()
+         *
+         * \return The referenced object as `std::string`.
+         */
+        std::string to_string(bool* ok = nullptr) const;
+
+        /*!
+         * \brief Creates a \ref variant_array_view from the referenced object.
+         *
+         * \remark The returned view refers to the referenced object directly; no copy is done.
+         *         That means, values which are set through the returned view, will be written into the referenced object.
+         *         When the referenced object is not an array, an invalid \ref variant_array_view will be returned.
+         *
+         * \return A variant_array_view object.
+         */
+        variant_array_view create_array_view() const;
+
+        /*!
+         * \brief Creates a \ref variant_associative_view from the referenced object.
+         *
+         * \remark The returned view refers to the referenced object directly; no copy is done.
+         *         When the referenced object is not an associative container, an invalid \ref variant_associative_view will be returned.
+         *
+         * \return A variant_associative_view object.
+         */
+        variant_associative_view create_associative_view() const;
+
+        /*!
+         * \brief Returns a \ref variant, which contains a copy of the referenced object.
+         *
+         * \remark When the referenced object is not copy constructible, an invalid variant is returned.
+         *
+         * \return A variant object, which owns its value.
+         */
+        variant to_variant() const;
+
+        /*!
+         * \brief Compares the referenced object with the object referenced by \p other.
+         *
+         * \see variant::operator==()
+         *
+         * \return True if both objects are equal, otherwise false.
+         */
+        bool operator==(const variant_ref& other) const;
+
+        /*!
+         * \brief Compares the referenced object with the object referenced by \p other.
+         *
+         * \see variant::operator!=()
+         *
+         * \return True if both objects are NOT equal, otherwise false.
+         */
+        bool operator!=(const variant_ref& other) const;
+
+        /*!
+         * \brief Compares the referenced object with the value of \p other.
+         *
+         * \see variant::operator==()
+         *
+         * \return True if both objects are equal, otherwise false.
+         */
+        bool operator==(const variant& other) const;
+
+        /*!
+         * \brief Compares the referenced object with the value of \p other.
+         *
+         * \see variant::operator!=()
+         *
+         * \return True if both objects are NOT equal, otherwise false.
+         */
+        bool operator!=(const variant& other) const;
+
+        /*!
+         * \brief Compares the referenced object with the object referenced by \p other.
+         *
+         * \see variant::operator<()
+         *
+         * \return True if this object is less than the object referenced by \p other, otherwise false.
+         */
+        bool operator<(const variant_ref& other) const;
+
+    private:
+        //! Constructs a variant_ref, which holds the value itself (used when no addressable storage exist).
+        explicit variant_ref(variant&& value);
+
+        friend class instance;
+        friend class detail::property_wrapper_base;
+        template<typename Arr, typename Itr>
+        friend struct detail::array_iterator_accessor_base;
+
+        variant m_var;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/variant/variant_ref_impl.h"
+
+#endif // RTTR_VARIANT_REF_H_
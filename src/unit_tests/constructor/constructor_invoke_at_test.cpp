@@ -0,0 +1,159 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <string>
+#include <type_traits>
+
+using namespace rttr;
+
+struct ctor_invoke_at_test
+{
+    ctor_invoke_at_test() : value(1) { ++s_alive; }
+    ctor_invoke_at_test(int v, std::string t = "default") : value(v), text(std::move(t)) { ++s_alive; }
+    ctor_invoke_at_test(const ctor_invoke_at_test& other) : value(other.value), text(other.text) { ++s_alive; }
+    ~ctor_invoke_at_test() { --s_alive; }
+
+    static ctor_invoke_at_test create(double v) { return ctor_invoke_at_test(static_cast<int>(v)); }
+
+    int         value;
+    std::string text;
+    double      align_member = 0.0;
+
+    static int  s_alive;
+};
+
+int ctor_invoke_at_test::s_alive = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<ctor_invoke_at_test>("ctor_invoke_at_test")
+        .constructor<>()
+        .constructor<int, std::string>()
+        (
+            default_arguments(std::string("default"))
+        )
+        .constructor(&ctor_invoke_at_test::create);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+using ctor_invoke_at_storage = std::aligned_storage<sizeof(ctor_invoke_at_test), alignof(ctor_invoke_at_test)>::type;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("constructor - invoke_at()", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    REQUIRE(t.get_sizeof() == sizeof(ctor_invoke_at_test));
+    REQUIRE(t.get_alignof() == alignof(ctor_invoke_at_test));
+
+    ctor_invoke_at_storage storage;
+    constructor ctor = t.get_constructor();
+    REQUIRE(ctor.is_valid() == true);
+
+    variant var = ctor.invoke_at(&storage);
+    REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+    ctor_invoke_at_test* obj = var.get_value<ctor_invoke_at_test*>();
+    CHECK(static_cast<void*>(obj) == static_cast<void*>(&storage));
+    CHECK(obj->value == 1);
+    CHECK(ctor_invoke_at_test::s_alive == 1);
+
+    CHECK(t.get_destructor().invoke_at(&storage) == true);
+    CHECK(ctor_invoke_at_test::s_alive == 0);
+
+    SECTION("with arguments")
+    {
+        constructor ctor_args = t.get_constructor({type::get<int>(), type::get<std::string>()});
+        var = ctor_args.invoke_at(&storage, 23, std::string("text"));
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+        CHECK(var.get_value<ctor_invoke_at_test*>()->value == 23);
+        CHECK(var.get_value<ctor_invoke_at_test*>()->text == "text");
+        CHECK(t.get_destructor().invoke_at(&storage) == true);
+
+        // default argument
+        var = ctor_args.invoke_at(&storage, 42);
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+        CHECK(var.get_value<ctor_invoke_at_test*>()->value == 42);
+        CHECK(var.get_value<ctor_invoke_at_test*>()->text == "default");
+        CHECK(t.get_destructor().invoke_at(&storage) == true);
+
+        var = ctor_args.invoke_variadic_at(&storage, {7, std::string("variadic")});
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+        CHECK(var.get_value<ctor_invoke_at_test*>()->text == "variadic");
+        CHECK(t.get_destructor().invoke_at(&storage) == true);
+    }
+
+    SECTION("invalid invocations")
+    {
+        constructor ctor_args = t.get_constructor({type::get<int>(), type::get<std::string>()});
+        CHECK(ctor_args.invoke_at(&storage).is_valid() == false);
+        CHECK(ctor_args.invoke_at(&storage, std::string("wrong"), 1).is_valid() == false);
+        CHECK(ctor_args.invoke_at(&storage, 1, std::string("a"), 2).is_valid() == false);
+        CHECK(ctor.invoke_at(nullptr).is_valid() == false);
+
+        char* misaligned = reinterpret_cast<char*>(&storage) + 1;
+        CHECK(ctor.invoke_at(misaligned).is_valid() == false);
+
+        constructor func_ctor = t.get_constructor({type::get<double>()});
+        REQUIRE(func_ctor.is_valid() == true);
+        CHECK(func_ctor.invoke_at(&storage, 1.0).is_valid() == false);
+        CHECK(func_ctor.invoke(1.0).is_valid() == true);
+
+        CHECK(type::get<int>().get_constructor().invoke_at(&storage).is_valid() == false);
+        CHECK(ctor_invoke_at_test::s_alive == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - create_at() and destroy_at()", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    ctor_invoke_at_storage storage[2];
+
+    variant first = t.create_at(&storage[0]);
+    variant second = t.create_at(&storage[1], {5, std::string("second")});
+    REQUIRE(first.is_type<ctor_invoke_at_test*>() == true);
+    REQUIRE(second.is_type<ctor_invoke_at_test*>() == true);
+    CHECK(static_cast<void*>(second.get_value<ctor_invoke_at_test*>()) == static_cast<void*>(&storage[1]));
+    CHECK(second.get_value<ctor_invoke_at_test*>()->text == "second");
+    CHECK(ctor_invoke_at_test::s_alive == 2);
+
+    CHECK(t.destroy_at(&storage[0]) == true);
+    CHECK(t.destroy_at(&storage[1]) == true);
+    CHECK(ctor_invoke_at_test::s_alive == 0);
+
+    CHECK(t.destroy_at(nullptr) == false);
+    CHECK(t.create_at(&storage[0], {std::string("no match")}).is_valid() == false);
+    CHECK(type::get<int>().create_at(&storage[0]).is_valid() == false);
+}
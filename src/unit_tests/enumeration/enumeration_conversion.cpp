@@ -33,6 +33,7 @@ using namespace std;
 #include <iostream>
 #include <memory>
 #include <functional>
+#include <string>
 
 #include <catch/catch.hpp>
 
@@ -43,6 +44,34 @@ enum class access_t : int
     exec = 4
 };
 
+enum class error_code_t : int
+{
+    ok              = 0,
+    not_found       = -404,
+    timeout         = 1000,
+    out_of_memory   = 100000,
+    fatal           = 2147483647
+};
+
+enum class large_enum_t : uint16_t
+{
+};
+
+enum class permission_t : uint32_t
+{
+    none        = 0,
+    read        = 1 << 0,
+    write       = 1 << 1,
+    exec        = 1 << 2,
+    read_write  = read | write,
+    admin       = 1u << 31
+};
+
+enum class alias_t : int
+{
+    first = 1,
+    second = 2
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,6 +83,101 @@ RTTR_REGISTRATION
         value("write",  access_t::write),
         value("exec",   access_t::exec)
     );
+
+    registration::enumeration<error_code_t>("error_code_t")
+    (
+        value("ok",             error_code_t::ok),
+        value("not_found",      error_code_t::not_found),
+        value("timeout",        error_code_t::timeout),
+        value("out_of_memory",  error_code_t::out_of_memory),
+        value("fatal",          error_code_t::fatal)
+    );
+
+    registration::enumeration<large_enum_t>("large_enum_t")
+    (
+        value("code_0", static_cast<large_enum_t>(0)),
+        value("code_1", static_cast<large_enum_t>(3)),
+        value("code_2", static_cast<large_enum_t>(6)),
+        value("code_3", static_cast<large_enum_t>(9)),
+        value("code_4", static_cast<large_enum_t>(12)),
+        value("code_5", static_cast<large_enum_t>(15)),
+        value("code_6", static_cast<large_enum_t>(18)),
+        value("code_7", static_cast<large_enum_t>(21)),
+        value("code_8", static_cast<large_enum_t>(24)),
+        value("code_9", static_cast<large_enum_t>(27)),
+        value("code_10", static_cast<large_enum_t>(30)),
+        value("code_11", static_cast<large_enum_t>(33)),
+        value("code_12", static_cast<large_enum_t>(36)),
+        value("code_13", static_cast<large_enum_t>(39)),
+        value("code_14", static_cast<large_enum_t>(42)),
+        value("code_15", static_cast<large_enum_t>(45)),
+        value("code_16", static_cast<large_enum_t>(48)),
+        value("code_17", static_cast<large_enum_t>(51)),
+        value("code_18", static_cast<large_enum_t>(54)),
+        value("code_19", static_cast<large_enum_t>(57)),
+        value("code_20", static_cast<large_enum_t>(60)),
+        value("code_21", static_cast<large_enum_t>(63)),
+        value("code_22", static_cast<large_enum_t>(66)),
+        value("code_23", static_cast<large_enum_t>(69)),
+        value("code_24", static_cast<large_enum_t>(72)),
+        value("code_25", static_cast<large_enum_t>(75)),
+        value("code_26", static_cast<large_enum_t>(78)),
+        value("code_27", static_cast<large_enum_t>(81)),
+        value("code_28", static_cast<large_enum_t>(84)),
+        value("code_29", static_cast<large_enum_t>(87)),
+        value("code_30", static_cast<large_enum_t>(90)),
+        value("code_31", static_cast<large_enum_t>(93)),
+        value("code_32", static_cast<large_enum_t>(96)),
+        value("code_33", static_cast<large_enum_t>(99)),
+        value("code_34", static_cast<large_enum_t>(102)),
+        value("code_35", static_cast<large_enum_t>(105)),
+        value("code_36", static_cast<large_enum_t>(108)),
+        value("code_37", static_cast<large_enum_t>(111)),
+        value("code_38", static_cast<large_enum_t>(114)),
+        value("code_39", static_cast<large_enum_t>(117)),
+        value("code_40", static_cast<large_enum_t>(120)),
+        value("code_41", static_cast<large_enum_t>(123)),
+        value("code_42", static_cast<large_enum_t>(126)),
+        value("code_43", static_cast<large_enum_t>(129)),
+        value("code_44", static_cast<large_enum_t>(132)),
+        value("code_45", static_cast<large_enum_t>(135)),
+        value("code_46", static_cast<large_enum_t>(138)),
+        value("code_47", static_cast<large_enum_t>(141)),
+        value("code_48", static_cast<large_enum_t>(144)),
+        value("code_49", static_cast<large_enum_t>(147)),
+        value("code_50", static_cast<large_enum_t>(150)),
+        value("code_51", static_cast<large_enum_t>(153)),
+        value("code_52", static_cast<large_enum_t>(156)),
+        value("code_53", static_cast<large_enum_t>(159)),
+        value("code_54", static_cast<large_enum_t>(162)),
+        value("code_55", static_cast<large_enum_t>(165)),
+        value("code_56", static_cast<large_enum_t>(168)),
+        value("code_57", static_cast<large_enum_t>(171)),
+        value("code_58", static_cast<large_enum_t>(174)),
+        value("code_59", static_cast<large_enum_t>(177)),
+        value("code_60", static_cast<large_enum_t>(180)),
+        value("code_61", static_cast<large_enum_t>(183)),
+        value("code_62", static_cast<large_enum_t>(186)),
+        value("code_63", static_cast<large_enum_t>(189))
+    );
+
+    registration::enumeration<permission_t>("permission_t")
+    (
+        metadata(enumeration_metadata::flags, true),
+        value("none",       permission_t::none),
+        value("read",       permission_t::read),
+        value("write",      permission_t::write),
+        value("exec",       permission_t::exec),
+        value("read_write", permission_t::read_write),
+        value("admin",      permission_t::admin)
+    );
+
+    registration::enumeration<alias_t>("alias_t")
+    (
+        value("first",      alias_t::first),
+        value("second",     alias_t::second),
+        value("also_first", alias_t::first)
+    );
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -102,3 +226,143 @@ TEST_CASE("enumeration - name_to_value()", "[enumeration]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - sparse values", "[enumeration]")
+{
+    enumeration e = type::get<error_code_t>().get_enumeration();
+
+    CHECK(e.value_to_name(error_code_t::ok)             == "ok");
+    CHECK(e.value_to_name(error_code_t::not_found)      == "not_found");
+    CHECK(e.value_to_name(error_code_t::out_of_memory)  == "out_of_memory");
+    CHECK(e.value_to_name(error_code_t::fatal)          == "fatal");
+    CHECK(e.value_to_name(1000)                         == "timeout");
+    CHECK(e.value_to_name(1001)                         == "");
+
+    CHECK(e.name_to_value("not_found").get_value<error_code_t>()  == error_code_t::not_found);
+    CHECK(e.name_to_value("fatal").get_value<error_code_t>()      == error_code_t::fatal);
+    CHECK(e.name_to_value("").is_valid()                          == false);
+    CHECK(e.name_to_value("timeou").is_valid()                    == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - many values", "[enumeration]")
+{
+    enumeration e = type::get<large_enum_t>().get_enumeration();
+    REQUIRE(e.get_names().size() == 64);
+
+    for (int i = 0; i < 64; ++i)
+    {
+        const std::string name = "code_" + std::to_string(i);
+        const large_enum_t value = static_cast<large_enum_t>(i * 3);
+        CHECK(e.value_to_name(value) == name);
+        CHECK(e.name_to_value(name).get_value<large_enum_t>() == value);
+        CHECK(e.value_to_name(static_cast<large_enum_t>(i * 3 + 1)) == "");
+    }
+
+    CHECK(e.name_to_value("code_64").is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - duplicate values", "[enumeration]")
+{
+    enumeration e = type::get<alias_t>().get_enumeration();
+
+    // the first registered name is returned
+    CHECK(e.value_to_name(alias_t::first) == "first");
+    CHECK(e.name_to_value("also_first").get_value<alias_t>() == alias_t::first);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - variant conversion", "[enumeration]")
+{
+    bool ok = false;
+    variant var = std::string("out_of_memory");
+    CHECK(var.convert<error_code_t>(&ok) == error_code_t::out_of_memory);
+    CHECK(ok == true);
+
+    var = -404;
+    CHECK(var.convert<error_code_t>(&ok) == error_code_t::not_found);
+    CHECK(ok == true);
+
+    var = 1000.0;
+    CHECK(var.convert<error_code_t>(&ok) == error_code_t::timeout);
+    CHECK(ok == true);
+
+    var = 1000.5;
+    var.convert<error_code_t>(&ok);
+    CHECK(ok == false);
+
+    var = 7;
+    var.convert<error_code_t>(&ok);
+    CHECK(ok == false);
+
+    var = error_code_t::timeout;
+    CHECK(var.to_string() == "timeout");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static permission_t operator|(permission_t lhs, permission_t rhs)
+{
+    return static_cast<permission_t>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - flags", "[enumeration]")
+{
+    enumeration e = type::get<permission_t>().get_enumeration();
+    REQUIRE(e.is_flags() == true);
+    CHECK(type::get<error_code_t>().get_enumeration().is_flags() == false);
+
+    SECTION("value_to_flag_names()")
+    {
+        CHECK(e.value_to_flag_names(permission_t::read)                                         == "read");
+        CHECK(e.value_to_flag_names(permission_t::none)                                         == "none");
+        CHECK(e.value_to_flag_names(permission_t::read_write)                                   == "read_write");
+        CHECK(e.value_to_flag_names(permission_t::read | permission_t::exec)                    == "read|exec");
+        CHECK(e.value_to_flag_names(permission_t::write | permission_t::exec | permission_t::admin) == "write|exec|admin");
+        CHECK(e.value_to_flag_names(static_cast<permission_t>(1 << 3))                          == "");
+        CHECK(e.value_to_flag_names(static_cast<permission_t>(1 | (1 << 3)))                    == "");
+
+        // the exact name lookup is not changed
+        CHECK(e.value_to_name(permission_t::read | permission_t::exec).empty() == true);
+    }
+
+    SECTION("flag_names_to_value()")
+    {
+        CHECK(e.flag_names_to_value("read").get_value<permission_t>()                 == permission_t::read);
+        CHECK(e.flag_names_to_value("read|exec").get_value<permission_t>()            == (permission_t::read | permission_t::exec));
+        CHECK(e.flag_names_to_value(" exec | read_write ").get_value<permission_t>()  == (permission_t::read_write | permission_t::exec));
+        CHECK(e.flag_names_to_value("read|admin").get_value<permission_t>()           == (permission_t::read | permission_t::admin));
+        CHECK(e.flag_names_to_value("read|").is_valid()                               == false);
+        CHECK(e.flag_names_to_value("read|delete").is_valid()                         == false);
+        CHECK(e.flag_names_to_value("").is_valid()                                    == false);
+
+        CHECK(type::get<error_code_t>().get_enumeration().flag_names_to_value("timeout").get_value<error_code_t>() == error_code_t::timeout);
+    }
+
+    SECTION("variant conversion")
+    {
+        variant var = permission_t::read | permission_t::write | permission_t::exec;
+        CHECK(var.to_string() == "read|write|exec");
+
+        bool ok = false;
+        var = std::string("write|exec");
+        CHECK(var.convert<permission_t>(&ok) == (permission_t::write | permission_t::exec));
+        CHECK(ok == true);
+
+        var = 5;
+        CHECK(var.convert<permission_t>(&ok) == (permission_t::read | permission_t::exec));
+        CHECK(ok == true);
+
+        var = 8;
+        var.convert<permission_t>(&ok);
+        CHECK(ok == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
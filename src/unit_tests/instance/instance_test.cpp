@@ -97,3 +97,20 @@ TEST_CASE("instance - wrapped derived type", "[instance]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+
+TEST_CASE("instance - from variant_ref", "[instance]")
+{
+    instance_derived d;
+    instance_base& base = d;
+    variant_ref ref = base;
+    instance obj = ref;
+    CHECK(obj.is_valid() == true);
+    CHECK(obj.get_type() == type::get<instance_base*>());
+    CHECK(obj.get_derived_type() == type::get<instance_derived>());
+    CHECK(obj.try_convert<instance_derived>() == &d);
+
+    instance empty_obj = variant_ref();
+    CHECK(empty_obj.is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,398 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/io/binary_writer.h>
+#include <rttr/io/binary_reader.h>
+
+#include <catch/catch.hpp>
+
+#include <array>
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#   include <io.h>
+#   define RTTR_TEST_FILENO _fileno
+#   define RTTR_TEST_LSEEK  _lseek
+#else
+#   include <unistd.h>
+#   define RTTR_TEST_FILENO fileno
+#   define RTTR_TEST_LSEEK  lseek
+#endif
+
+using namespace rttr;
+
+enum class binary_io_color : uint8_t
+{
+    red = 1,
+    green = 2,
+    blue = 3
+};
+
+struct binary_io_point
+{
+    binary_io_point(float x_ = 0.0f, float y_ = 0.0f) : x(x_), y(y_) {}
+    float x;
+    float y;
+};
+
+struct binary_io_item
+{
+    binary_io_item() : id(0), ratio(0.0), visible(false), color(binary_io_color::red), fixed_numbers(), std_array(), version(1), next(nullptr), m_scale(1) {}
+
+    int get_scale() const { return m_scale; }
+    void set_scale(int scale) { m_scale = scale; }
+
+    int                         id;
+    double                      ratio;
+    bool                        visible;
+    binary_io_color             color;
+    std::string                 name;
+    std::vector<float>          samples;
+    int                         fixed_numbers[4];
+    std::array<int16_t, 3>      std_array;
+    std::vector<std::string>    tags;
+    std::list<int>              int_list;
+    std::vector<bool>           flags;
+    binary_io_point             position;
+    std::vector<binary_io_point> path;
+    std::vector<std::vector<int>> matrix;
+    int                         version;
+    binary_io_item*             next;
+
+private:
+    int                         m_scale;
+};
+
+//! The values, which are validated by the reader.
+struct binary_io_switches
+{
+    binary_io_switches() : enabled(false), colors(), m_mode(binary_io_color::red)
+    {
+        colors[0] = colors[1] = binary_io_color::red;
+    }
+
+    binary_io_color get_mode() const { return m_mode; }
+    void set_mode(binary_io_color mode) { m_mode = mode; }
+
+    bool                        enabled;
+    binary_io_color             colors[2];
+    std::vector<bool>           flags;
+
+private:
+    binary_io_color             m_mode;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<binary_io_color>("binary_io_color")
+        (
+            value("red",    binary_io_color::red),
+            value("green",  binary_io_color::green),
+            value("blue",   binary_io_color::blue)
+        );
+
+    registration::class_<binary_io_point>("binary_io_point")
+        .property("x", &binary_io_point::x)
+        .property("y", &binary_io_point::y)
+        ;
+
+    registration::class_<binary_io_item>("binary_io_item")
+        .property("id", &binary_io_item::id)
+        .property("ratio", &binary_io_item::ratio)
+        .property("visible", &binary_io_item::visible)
+        .property("color", &binary_io_item::color)
+        .property("name", &binary_io_item::name)
+        .property("samples", &binary_io_item::samples)
+        .property("fixed_numbers", &binary_io_item::fixed_numbers)
+        .property("std_array", &binary_io_item::std_array)
+        .property("tags", &binary_io_item::tags)
+        .property("int_list", &binary_io_item::int_list)
+        .property("flags", &binary_io_item::flags)
+        .property("position", &binary_io_item::position)
+        .property("path", &binary_io_item::path)
+        .property("matrix", &binary_io_item::matrix)
+        .property_readonly("version", &binary_io_item::version)
+        .property("next", &binary_io_item::next)
+        .property("scale", &binary_io_item::get_scale, &binary_io_item::set_scale)
+        ;
+
+    registration::class_<binary_io_switches>("binary_io_switches")
+        .property("enabled", &binary_io_switches::enabled)
+        .property("colors", &binary_io_switches::colors)
+        .property("flags", &binary_io_switches::flags)
+        .property("mode", &binary_io_switches::get_mode, &binary_io_switches::set_mode)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static binary_io_item create_binary_io_item()
+{
+    binary_io_item item;
+    item.id = 42;
+    item.ratio = 0.25;
+    item.visible = true;
+    item.color = binary_io_color::blue;
+    item.name = "first item";
+    item.samples = {1.0f, 2.5f, -3.0f};
+    item.fixed_numbers[0] = 1; item.fixed_numbers[1] = 2; item.fixed_numbers[2] = 3; item.fixed_numbers[3] = 4;
+    item.std_array = {{7, 8, 9}};
+    item.tags = {"alpha", "", "gamma"};
+    item.int_list = {5, 6};
+    item.flags = {true, false, true};
+    item.position = binary_io_point(1.5f, -2.0f);
+    item.path = {binary_io_point(0.0f, 1.0f), binary_io_point(2.0f, 3.0f)};
+    item.matrix = {{1, 2}, {}, {3}};
+    item.version = 7;
+    item.next = &item;
+    item.set_scale(3);
+    return item;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void check_binary_io_item(const binary_io_item& item)
+{
+    CHECK(item.id == 42);
+    CHECK(item.ratio == 0.25);
+    CHECK(item.visible == true);
+    CHECK(item.color == binary_io_color::blue);
+    CHECK(item.name == "first item");
+    CHECK(item.samples == std::vector<float>({1.0f, 2.5f, -3.0f}));
+    CHECK(item.fixed_numbers[0] == 1);
+    CHECK(item.fixed_numbers[3] == 4);
+    CHECK(item.std_array[0] == 7);
+    CHECK(item.std_array[2] == 9);
+    CHECK(item.tags == std::vector<std::string>({"alpha", "", "gamma"}));
+    CHECK(item.int_list == std::list<int>({5, 6}));
+    CHECK(item.flags == std::vector<bool>({true, false, true}));
+    CHECK(item.position.x == 1.5f);
+    CHECK(item.position.y == -2.0f);
+    REQUIRE(item.path.size() == 2);
+    CHECK(item.path[1].x == 2.0f);
+    CHECK(item.path[1].y == 3.0f);
+    CHECK(item.matrix == std::vector<std::vector<int>>({{1, 2}, {}, {3}}));
+    CHECK(item.get_scale() == 3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_writer - round trip via buffer", "[io]")
+{
+    const binary_io_item source = create_binary_io_item();
+
+    std::vector<char> buffer;
+    {
+        io::binary_writer writer(buffer);
+        CHECK(writer.write(source) == true);
+        CHECK(writer.write(source) == true);
+        CHECK(writer.write(instance()) == false);
+    }
+    CHECK(buffer.empty() == false);
+
+    io::binary_reader reader(buffer.data(), buffer.size());
+    binary_io_item target_1;
+    binary_io_item target_2;
+    CHECK(reader.at_end() == false);
+    CHECK(reader.read(target_1) == true);
+    CHECK(reader.read(target_2) == true);
+    CHECK(reader.at_end() == true);
+
+    check_binary_io_item(target_1);
+    check_binary_io_item(target_2);
+
+    // read only properties and pointers are not assigned
+    CHECK(target_1.version == 1);
+    CHECK(target_1.next == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_writer - arithmetic array is written in one block", "[io]")
+{
+    binary_io_item item;
+    item.samples.assign(1000, 0.5f);
+
+    std::vector<char> buffer;
+    io::binary_writer writer(buffer);
+    CHECK(writer.write(item) == true);
+
+    const char* samples_begin = buffer.data() + sizeof(int) + sizeof(double) + sizeof(bool) + sizeof(binary_io_color) + sizeof(uint64_t) + item.name.size();
+    uint64_t sample_count = 0;
+    std::memcpy(&sample_count, samples_begin, sizeof(sample_count));
+    CHECK(sample_count == 1000);
+
+    float first_sample = 0.0f;
+    std::memcpy(&first_sample, samples_begin + sizeof(uint64_t), sizeof(first_sample));
+    CHECK(first_sample == 0.5f);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_reader - invalid data", "[io]")
+{
+    const binary_io_item source = create_binary_io_item();
+    std::vector<char> buffer;
+    {
+        io::binary_writer writer(buffer);
+        writer.write(source);
+    }
+
+    SECTION("truncated")
+    {
+        io::binary_reader reader(buffer.data(), buffer.size() - 1);
+        binary_io_item target;
+        CHECK(reader.read(target) == false);
+    }
+
+    SECTION("corrupt size")
+    {
+        std::vector<char> corrupt = buffer;
+        const uint64_t huge_size = uint64_t(1) << 60;
+        const std::size_t samples_offset = sizeof(int) + sizeof(double) + sizeof(bool) + sizeof(binary_io_color) + sizeof(uint64_t) + source.name.size();
+        std::memcpy(&corrupt[samples_offset], &huge_size, sizeof(huge_size));
+
+        io::binary_reader reader(corrupt.data(), corrupt.size());
+        binary_io_item target;
+        CHECK(reader.read(target) == false);
+    }
+
+    SECTION("invalid instance")
+    {
+        io::binary_reader reader(buffer.data(), buffer.size());
+        CHECK(reader.read(instance()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_reader - invalid bool and enumeration values", "[io]")
+{
+    binary_io_switches source;
+    source.enabled = true;
+    source.colors[1] = binary_io_color::blue;
+    source.flags = {true, false, true};
+    source.set_mode(binary_io_color::green);
+
+    std::vector<char> buffer;
+    {
+        io::binary_writer writer(buffer);
+        writer.write(source);
+    }
+
+    // enabled | size, colors | size, flags | mode
+    const std::size_t colors_offset = sizeof(bool) + sizeof(uint64_t);
+    const std::size_t flags_offset  = colors_offset + 2 * sizeof(binary_io_color) + sizeof(uint64_t);
+    const std::size_t mode_offset   = flags_offset + 3;
+    REQUIRE(buffer.size() == mode_offset + sizeof(binary_io_color));
+
+    {
+        io::binary_reader reader(buffer.data(), buffer.size());
+        binary_io_switches target;
+        REQUIRE(reader.read(target) == true);
+        CHECK(target.enabled == true);
+        CHECK(target.colors[1] == binary_io_color::blue);
+        CHECK(target.flags == std::vector<bool>({true, false, true}));
+        CHECK(target.get_mode() == binary_io_color::green);
+    }
+
+    std::vector<char> corrupt = buffer;
+    binary_io_switches target;
+
+    SECTION("bool")
+    {
+        corrupt[0] = 2;
+        io::binary_reader reader(corrupt.data(), corrupt.size());
+        CHECK(reader.read(target) == false);
+        CHECK(target.enabled == false);
+    }
+
+    SECTION("array of enumerations")
+    {
+        corrupt[colors_offset + 1] = 7;
+        io::binary_reader reader(corrupt.data(), corrupt.size());
+        CHECK(reader.read(target) == false);
+        CHECK(target.colors[1] == binary_io_color::red);
+    }
+
+    SECTION("std::vector<bool>")
+    {
+        corrupt[flags_offset + 1] = 5;
+        io::binary_reader reader(corrupt.data(), corrupt.size());
+        CHECK(reader.read(target) == false);
+        CHECK(target.flags.empty() == true);
+    }
+
+    SECTION("enumeration via setter")
+    {
+        corrupt[mode_offset] = 0;
+        io::binary_reader reader(corrupt.data(), corrupt.size());
+        CHECK(reader.read(target) == false);
+        CHECK(target.get_mode() == binary_io_color::red);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_writer - round trip via file descriptor", "[io]")
+{
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    const int fd = RTTR_TEST_FILENO(file);
+
+    const binary_io_item source = create_binary_io_item();
+    {
+        // a small buffer, so the data is written in several blocks
+        io::binary_writer writer(fd, 16);
+        for (int i = 0; i < 10; ++i)
+            CHECK(writer.write(source) == true);
+        CHECK(writer.flush() == true);
+    }
+
+    RTTR_TEST_LSEEK(fd, 0, SEEK_SET);
+    io::binary_reader reader(fd, 32);
+    int count = 0;
+    while (!reader.at_end())
+    {
+        binary_io_item target;
+        REQUIRE(reader.read(target) == true);
+        check_binary_io_item(target);
+        ++count;
+    }
+    CHECK(count == 10);
+
+    std::fclose(file);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
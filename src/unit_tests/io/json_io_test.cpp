@@ -0,0 +1,336 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/io/json_writer.h>
+#include <rttr/io/json_reader.h>
+
+#include <catch/catch.hpp>
+
+#include <array>
+#include <clocale>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+enum class json_io_state
+{
+    created = 1,
+    shipped = 2,
+    delivered = 3
+};
+
+struct json_io_line
+{
+    json_io_line(const std::string& sku_ = std::string(), int count_ = 0) : sku(sku_), count(count_) {}
+    std::string sku;
+    int         count;
+};
+
+struct json_io_order
+{
+    json_io_order() : id(0), total(0.0), weight(0.0f), small(0), big(0), paid(false), state(json_io_state::created), fixed(), version(1), owner(nullptr), m_priority(0) {}
+
+    int get_priority() const { return m_priority; }
+    void set_priority(int priority) { m_priority = priority; }
+
+    int64_t                     id;
+    double                      total;
+    float                       weight;
+    int8_t                      small;
+    uint64_t                    big;
+    bool                        paid;
+    json_io_state               state;
+    std::string                 comment;
+    std::vector<json_io_line>   lines;
+    std::vector<int>            numbers;
+    std::array<uint16_t, 3>     fixed;
+    std::list<json_io_state>    history;
+    std::vector<bool>           flags;
+    std::list<std::string>      tags;
+    std::vector<std::vector<double>> matrix;
+    json_io_line                main_line;
+    int                         version;
+    json_io_order*              owner;
+
+private:
+    int                         m_priority;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<json_io_state>("json_io_state")
+        (
+            value("created",    json_io_state::created),
+            value("shipped",    json_io_state::shipped),
+            value("delivered",  json_io_state::delivered)
+        );
+
+    registration::class_<json_io_line>("json_io_line")
+        .property("sku", &json_io_line::sku)
+        .property("count", &json_io_line::count)
+        ;
+
+    registration::class_<json_io_order>("json_io_order")
+        .property("id", &json_io_order::id)
+        .property("total", &json_io_order::total)
+        .property("weight", &json_io_order::weight)
+        .property("small", &json_io_order::small)
+        .property("big", &json_io_order::big)
+        .property("paid", &json_io_order::paid)
+        .property("state", &json_io_order::state)
+        .property("comment", &json_io_order::comment)
+        .property("lines", &json_io_order::lines)
+        .property("numbers", &json_io_order::numbers)
+        .property("fixed", &json_io_order::fixed)
+        .property("history", &json_io_order::history)
+        .property("flags", &json_io_order::flags)
+        .property("tags", &json_io_order::tags)
+        .property("matrix", &json_io_order::matrix)
+        .property("main_line", &json_io_order::main_line)
+        .property_readonly("version", &json_io_order::version)
+        .property("owner", &json_io_order::owner)
+        .property("priority", &json_io_order::get_priority, &json_io_order::set_priority)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static json_io_order create_json_io_order()
+{
+    json_io_order order;
+    order.id = -9000000000LL;
+    order.total = 19.99;
+    order.weight = 0.1f;
+    order.small = -128;
+    order.big = std::numeric_limits<uint64_t>::max();
+    order.paid = true;
+    order.state = json_io_state::shipped;
+    order.comment = "quote \" backslash \\ tab \t newline \n bell \x07 umlaut \xc3\xa4";
+    order.lines = {json_io_line("A-12", 2), json_io_line("B-7", 1)};
+    order.numbers = {1, -2, 3};
+    order.fixed = {{7, 8, 9}};
+    order.history = {json_io_state::created, json_io_state::shipped};
+    order.flags = {true, false};
+    order.tags = {"x", "y"};
+    order.matrix = {{1.5, 2.5}, {}};
+    order.main_line = json_io_line("C-1", 5);
+    order.version = 7;
+    order.owner = &order;
+    order.set_priority(3);
+    return order;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void check_json_io_order(const json_io_order& order)
+{
+    CHECK(order.id == -9000000000LL);
+    CHECK(order.total == 19.99);
+    CHECK(order.weight == 0.1f);
+    CHECK(order.small == -128);
+    CHECK(order.big == std::numeric_limits<uint64_t>::max());
+    CHECK(order.paid == true);
+    CHECK(order.state == json_io_state::shipped);
+    CHECK(order.comment == "quote \" backslash \\ tab \t newline \n bell \x07 umlaut \xc3\xa4");
+    REQUIRE(order.lines.size() == 2);
+    CHECK(order.lines[0].sku == "A-12");
+    CHECK(order.lines[1].count == 1);
+    CHECK(order.numbers == std::vector<int>({1, -2, 3}));
+    CHECK(order.fixed[2] == 9);
+    CHECK(order.history == std::list<json_io_state>({json_io_state::created, json_io_state::shipped}));
+    CHECK(order.flags == std::vector<bool>({true, false}));
+    CHECK(order.tags == std::list<std::string>({"x", "y"}));
+    CHECK(order.matrix == std::vector<std::vector<double>>({{1.5, 2.5}, {}}));
+    CHECK(order.main_line.sku == "C-1");
+    CHECK(order.main_line.count == 5);
+    CHECK(order.get_priority() == 3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_writer - write", "[io]")
+{
+    json_io_line line("A-12", 2);
+    std::string text;
+    io::json_writer writer(text);
+    CHECK(writer.write(line) == true);
+    CHECK(writer.write(line) == true);
+    CHECK(writer.write(instance()) == false);
+
+    CHECK(text == "{\"sku\":\"A-12\",\"count\":2}\n{\"sku\":\"A-12\",\"count\":2}");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_writer - enumerations and special values", "[io]")
+{
+    json_io_order order;
+    order.state = json_io_state::delivered;
+    order.history = {json_io_state::created, static_cast<json_io_state>(42)};
+    order.total = std::numeric_limits<double>::infinity();
+
+    std::string text;
+    io::json_writer writer(text);
+    writer.write(order);
+
+    CHECK(text.find("\"state\":\"delivered\"") != std::string::npos);
+    CHECK(text.find("\"history\":[\"created\",42]") != std::string::npos);
+    CHECK(text.find("\"total\":null") != std::string::npos);
+    CHECK(text.find("\"version\":1") != std::string::npos);
+    CHECK(text.find("owner") == std::string::npos);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_writer - floating point numbers", "[io]")
+{
+    json_io_order order;
+    order.total = 0.1;
+    order.weight = 0.1f;
+
+    std::string text;
+    io::json_writer writer(text);
+    writer.write(order);
+
+    // the shortest text, which reads back to the same value
+    CHECK(text.find("\"total\":0.1,") != std::string::npos);
+    CHECK(text.find("\"weight\":0.1,") != std::string::npos);
+
+    json_io_order target;
+    io::json_reader reader(text);
+    REQUIRE(reader.read(target) == true);
+    CHECK(target.total == 0.1);
+    CHECK(target.weight == 0.1f);
+
+    // the decimal point of the C locale is not used
+    const std::string old_locale = std::setlocale(LC_NUMERIC, nullptr);
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "de_DE"))
+    {
+        std::string localized_text;
+        io::json_writer localized_writer(localized_text);
+        localized_writer.write(order);
+        CHECK(localized_text == text);
+
+        io::json_reader localized_reader("{\"total\":1.5}");
+        CHECK(localized_reader.read(target) == true);
+        CHECK(target.total == 1.5);
+    }
+    std::setlocale(LC_NUMERIC, old_locale.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_reader - round trip", "[io]")
+{
+    const json_io_order source = create_json_io_order();
+    std::string text;
+    {
+        io::json_writer writer(text);
+        writer.write(source);
+        writer.write(source);
+    }
+
+    io::json_reader reader(text);
+    json_io_order target_1;
+    json_io_order target_2;
+    CHECK(reader.read(target_1) == true);
+    CHECK(reader.get_error() == "");
+    CHECK(reader.read(target_2) == true);
+    CHECK(reader.at_end() == true);
+
+    check_json_io_order(target_1);
+    check_json_io_order(target_2);
+
+    // read only properties and pointers are not assigned
+    CHECK(target_1.version == 1);
+    CHECK(target_1.owner == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_reader - member order, unknown members and null", "[io]")
+{
+    const std::string text = " { \"count\" : 3 , \"unknown\" : {\"a\" : [1, 2.5e3, true, null, \"\\\"\"]},"
+                             " \"sku\" : \"\\u00e4\\ud83d\\ude00\" } ";
+    json_io_line line("old", 1);
+    io::json_reader reader(text);
+    REQUIRE(reader.read(line) == true);
+    CHECK(line.count == 3);
+    CHECK(line.sku == "\xc3\xa4\xf0\x9f\x98\x80");
+    CHECK(reader.at_end() == true);
+
+    json_io_order order;
+    order.comment = "keep";
+    io::json_reader null_reader("{\"comment\":null,\"state\":2,\"version\":99}");
+    REQUIRE(null_reader.read(order) == true);
+    CHECK(order.comment == "keep");
+    CHECK(order.state == json_io_state::shipped);
+    CHECK(order.version == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json_reader - invalid input", "[io]")
+{
+    json_io_order order;
+
+    io::json_reader truncated("{\"id\":1,");
+    CHECK(truncated.read(order) == false);
+    CHECK(truncated.get_error().empty() == false);
+
+    io::json_reader wrong_type("{\"id\":\"text\"}");
+    CHECK(wrong_type.read(order) == false);
+
+    io::json_reader fraction("{\"id\":1.5}");
+    CHECK(fraction.read(order) == false);
+
+    io::json_reader out_of_range("{\"small\":200}");
+    CHECK(out_of_range.read(order) == false);
+    CHECK(out_of_range.get_error() == "number out of range at offset 9");
+
+    io::json_reader unknown_enum("{\"state\":\"lost\"}");
+    CHECK(unknown_enum.read(order) == false);
+
+    io::json_reader fixed_size("{\"fixed\":[1,2]}");
+    CHECK(fixed_size.read(order) == false);
+
+    io::json_reader deep_member("{\"unknown\":" + std::string(1000, '[') + std::string(1000, ']') + "}");
+    CHECK(deep_member.read(order) == false);
+
+    io::json_reader invalid_instance("{}");
+    CHECK(invalid_instance.read(instance()) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,215 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/io/registry_snapshot.h>
+
+#include <catch/catch.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+enum class snapshot_test_mode
+{
+    off = 0,
+    on = 1,
+    invalid = -1
+};
+
+struct snapshot_test_base
+{
+    virtual ~snapshot_test_base() {}
+    int base_value = 0;
+    RTTR_ENABLE()
+};
+
+struct snapshot_test_derived : snapshot_test_base
+{
+    double              ratio = 0.0;
+    snapshot_test_mode  mode = snapshot_test_mode::off;
+    int                 constant = 1;
+    snapshot_test_derived* next = nullptr;
+    RTTR_ENABLE(snapshot_test_base)
+};
+
+static int g_snapshot_test_counter = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<snapshot_test_mode>("snapshot_test_mode")
+        (
+            value("off",        snapshot_test_mode::off),
+            value("on",         snapshot_test_mode::on),
+            value("invalid",    snapshot_test_mode::invalid)
+        );
+
+    registration::class_<snapshot_test_base>("snapshot_test_base")
+        .property("base_value", &snapshot_test_base::base_value)
+        ;
+
+    registration::class_<snapshot_test_derived>("snapshot_test_derived")
+        .property("ratio", &snapshot_test_derived::ratio)
+        .property("mode", &snapshot_test_derived::mode)
+        .property_readonly("constant", &snapshot_test_derived::constant)
+        .property("counter", &g_snapshot_test_counter)
+        .property("next", &snapshot_test_derived::next)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void check_snapshot(const io::registry_snapshot& snapshot)
+{
+    REQUIRE(snapshot.is_valid() == true);
+    CHECK(snapshot.get_type_count() == type::get_types().size());
+
+    const io::snapshot_type derived = snapshot.get_by_name("snapshot_test_derived");
+    REQUIRE(derived.is_valid() == true);
+    CHECK(derived.get_name() == "snapshot_test_derived");
+    CHECK(derived.is_class() == true);
+    CHECK(derived.is_enumeration() == false);
+    CHECK(derived.get_sizeof() == sizeof(snapshot_test_derived));
+    CHECK(snapshot.get_type(derived.get_index()) == derived);
+
+    const io::snapshot_type base = snapshot.get_by_name("snapshot_test_base");
+    REQUIRE(derived.get_base_class_count() == 1);
+    CHECK(derived.get_base_class(0) == base);
+    CHECK(derived.is_derived_from(base) == true);
+    CHECK(base.is_derived_from(derived) == false);
+    REQUIRE(base.get_derived_class_count() == 1);
+    CHECK(base.get_derived_class(0) == derived);
+
+    REQUIRE(derived.get_property_count() == 6);
+    CHECK(derived.get_property(std::size_t(0)).get_name() == "base_value");
+    CHECK(derived.get_property(std::size_t(0)).get_declaring_type() == base);
+    CHECK(derived.get_property(std::size_t(1)).get_type().get_name() == type::get<double>().get_name());
+
+    const io::snapshot_property constant = derived.get_property("constant");
+    REQUIRE(constant.is_valid() == true);
+    CHECK(constant.is_readonly() == true);
+    CHECK(constant.is_static() == false);
+    CHECK(derived.get_property("counter").is_static() == true);
+    CHECK(derived.get_property("unknown").is_valid() == false);
+
+    const io::snapshot_type mode = derived.get_property("mode").get_type();
+    CHECK(mode.is_enumeration() == true);
+    REQUIRE(mode.get_enum_count() == 3);
+    CHECK(mode.get_enum_name(0) == "off");
+    CHECK(mode.get_enum_value(1) == 1);
+    CHECK(mode.get_enum_name(2) == "invalid");
+    CHECK(mode.get_enum_value(2) == -1);
+    CHECK(mode.get_enum_name(3).empty() == true);
+
+    const io::snapshot_type pointer = derived.get_property("next").get_type();
+    REQUIRE(pointer.is_valid() == true);
+    CHECK(pointer.is_pointer() == true);
+    CHECK(pointer.get_raw_type() == derived);
+
+    CHECK(snapshot.get_by_name("no_such_type").is_valid() == false);
+
+    // every registered type can be found by its name
+    for (const auto& t : type::get_types())
+    {
+        const io::snapshot_type found = snapshot.get_by_name(t.get_name());
+        REQUIRE(found.is_valid() == true);
+        CHECK(found.get_name() == t.get_name());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::registry_snapshot - from memory", "[io]")
+{
+    std::vector<char> image;
+    REQUIRE(io::registry_snapshot::save(image) == true);
+
+    io::registry_snapshot snapshot(image.data(), image.size());
+    check_snapshot(snapshot);
+
+    io::registry_snapshot moved(std::move(snapshot));
+    CHECK(snapshot.is_valid() == false);
+    CHECK(moved.is_valid() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::registry_snapshot - from file", "[io]")
+{
+    const std::string file_name = "registry_snapshot_test.bin";
+    REQUIRE(io::registry_snapshot::save(file_name) == true);
+
+    io::registry_snapshot snapshot;
+    CHECK(snapshot.is_valid() == false);
+    REQUIRE(snapshot.open(file_name) == true);
+    check_snapshot(snapshot);
+
+    snapshot.close();
+    CHECK(snapshot.is_valid() == false);
+    CHECK(snapshot.get_by_name("snapshot_test_derived").is_valid() == false);
+
+    std::remove(file_name.c_str());
+    CHECK(snapshot.open(file_name) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::registry_snapshot - invalid image", "[io]")
+{
+    std::vector<char> image;
+    REQUIRE(io::registry_snapshot::save(image) == true);
+
+    SECTION("truncated")
+    {
+        io::registry_snapshot snapshot(image.data(), image.size() - 1);
+        CHECK(snapshot.is_valid() == false);
+        CHECK(snapshot.get_type_count() == 0);
+    }
+
+    SECTION("wrong magic")
+    {
+        image[0] = 'X';
+        io::registry_snapshot snapshot(image.data(), image.size());
+        CHECK(snapshot.is_valid() == false);
+    }
+
+    SECTION("corrupt offset")
+    {
+        // the type section offset follows the magic and four 32 bit fields
+        const uint32_t offset = 0xfffffff0;
+        std::memcpy(&image[8 + 4 * sizeof(uint32_t)], &offset, sizeof(offset));
+        io::registry_snapshot snapshot(image.data(), image.size());
+        CHECK(snapshot.is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <string>
+
+using namespace rttr;
+
+enum class meta_key_a
+{
+    first = 0
+};
+
+enum class meta_key_b
+{
+    first = 0
+};
+
+enum class meta_key_color
+{
+    red,
+    green
+};
+
+struct meta_key_test
+{
+    meta_key_test() {}
+    int value = 0;
+    void update() {}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<meta_key_test>("meta_key_test")
+        (
+            metadata("version", 3),
+            metadata(std::string("category"), "test"),
+            metadata(meta_key_a::first, "a"),
+            metadata(meta_key_b::first, "b")
+        )
+        .constructor<>()
+        (
+            metadata("default", true)
+        )
+        .property("value", &meta_key_test::value)
+        (
+            metadata("min", 0),
+            metadata("max", 100),
+            metadata(42, "answer")
+        )
+        .method("update", &meta_key_test::update)
+        (
+            metadata("ui_hint", "button")
+        );
+
+    registration::enumeration<meta_key_color>("meta_key_color")
+        (
+            value("red",    meta_key_color::red),
+            value("green",  meta_key_color::green),
+            metadata("serializable", true)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("metadata_key - interning", "[metadata_key]")
+{
+    metadata_key invalid;
+    CHECK(invalid.is_valid() == false);
+    CHECK(static_cast<bool>(invalid) == false);
+    CHECK(invalid.get_id() == 0);
+    CHECK(invalid.get_key().is_valid() == false);
+    CHECK(metadata_key(variant()).is_valid() == false);
+
+    metadata_key min_key("min");
+    CHECK(min_key.is_valid() == true);
+    CHECK(min_key == metadata_key(std::string("min")));
+    CHECK(min_key != metadata_key("max"));
+    CHECK(min_key.get_key() == std::string("min"));
+
+    CHECK(metadata_key(42) == metadata_key(42u));
+    CHECK(metadata_key(42) == metadata_key(int64_t(42)));
+    CHECK(metadata_key(42) != metadata_key(std::string("42")));
+
+    CHECK(metadata_key(meta_key_a::first) == metadata_key(meta_key_a::first));
+    CHECK(metadata_key(meta_key_a::first) != metadata_key(meta_key_b::first));
+    CHECK(metadata_key(meta_key_a::first) != metadata_key(0));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("metadata_key - get_metadata() of items", "[metadata_key]")
+{
+    type t = type::get<meta_key_test>();
+
+    static const metadata_key min_key("min");
+    static const metadata_key max_key("max");
+    property prop = t.get_property("value");
+    CHECK(prop.get_metadata(min_key) == 0);
+    CHECK(prop.get_metadata(max_key) == 100);
+    CHECK(prop.get_metadata(metadata_key(42u)) == std::string("answer"));
+    CHECK(prop.get_metadata(metadata_key("ui_hint")).is_valid() == false);
+    CHECK(prop.get_metadata(metadata_key()).is_valid() == false);
+
+    method meth = t.get_method("update");
+    CHECK(meth.get_metadata(metadata_key("ui_hint")) == std::string("button"));
+    CHECK(meth.get_metadata(min_key).is_valid() == false);
+
+    constructor ctor = t.get_constructor();
+    CHECK(ctor.get_metadata(metadata_key("default")) == true);
+
+    enumeration enum_item = type::get<meta_key_color>().get_enumeration();
+    CHECK(enum_item.get_metadata(metadata_key("serializable")) == true);
+    CHECK(enum_item.get_metadata(min_key).is_valid() == false);
+
+    property invalid_prop = t.get_property("");
+    CHECK(invalid_prop.get_metadata(min_key).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("metadata_key - get_metadata() of type", "[metadata_key]")
+{
+    type t = type::get<meta_key_test>();
+
+    CHECK(t.get_metadata(metadata_key("version")) == 3);
+    CHECK(t.get_metadata(metadata_key("category")) == std::string("test"));
+    CHECK(t.get_metadata(metadata_key(meta_key_a::first)) == std::string("a"));
+    CHECK(t.get_metadata(metadata_key(meta_key_b::first)) == std::string("b"));
+    CHECK(t.get_metadata(metadata_key("min")).is_valid() == false);
+
+    // the lookup with a variant key gives the same results
+    CHECK(t.get_metadata("version") == 3);
+    CHECK(t.get_metadata("category") == std::string("test"));
+    CHECK(t.get_metadata("unknown").is_valid() == false);
+
+    CHECK(type::get<int>().get_metadata(metadata_key("version")).is_valid() == false);
+}
@@ -0,0 +1,333 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/object_compare.h>
+
+#include <catch/catch.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct compare_test_point
+{
+    compare_test_point(int x_ = 0, int y_ = 0) : x(x_), y(y_) {}
+    int x;
+    int y;
+};
+
+enum class compare_test_color
+{
+    red,
+    green
+};
+
+struct compare_test_values
+{
+    compare_test_values() : id(7), count(3), flag(true), color(compare_test_color::green), weight(0.5), name("item"), cache(0) {}
+
+    // 'id', 'count' and 'flag' are compared as one block of memory
+    int                 id;
+    int                 count;
+    bool                flag;
+    compare_test_color  color;
+    double              weight;
+    std::string         name;
+    int                 cache;
+};
+
+struct compare_test_containers
+{
+    compare_test_containers() : values({1, 2, 3}), tags({"a", "b"}), path({compare_test_point(1, 1), compare_test_point(2, 2)}) {}
+
+    std::vector<int>                values;
+    std::list<std::string>          tags;
+    std::vector<compare_test_point> path;
+};
+
+struct compare_test_node
+{
+    compare_test_node() : position(4, 5), owner(nullptr) {}
+
+    compare_test_point  position;
+    compare_test_node*  owner;
+};
+
+struct compare_test_accessor
+{
+    compare_test_accessor() : m_level(9) {}
+
+    int get_level() const { return m_level; }
+    void set_level(int level) { m_level = level; }
+
+private:
+    int m_level;
+};
+
+struct compare_test_shape
+{
+    compare_test_shape() : id(1) {}
+    virtual ~compare_test_shape() {}
+    int id;
+
+    RTTR_ENABLE()
+};
+
+struct compare_test_circle : compare_test_shape
+{
+    compare_test_circle() : radius(0) {}
+    int radius;
+
+    RTTR_ENABLE(compare_test_shape)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<compare_test_point>("compare_test_point")
+        .property("x", &compare_test_point::x)
+        .property("y", &compare_test_point::y)
+        ;
+
+    registration::enumeration<compare_test_color>("compare_test_color")
+        (
+            value("red",   compare_test_color::red),
+            value("green", compare_test_color::green)
+        );
+
+    registration::class_<compare_test_values>("compare_test_values")
+        .property("id", &compare_test_values::id)
+        .property("count", &compare_test_values::count)
+        .property("flag", &compare_test_values::flag)
+        .property("color", &compare_test_values::color)
+        .property("weight", &compare_test_values::weight)
+        .property("name", &compare_test_values::name)
+        .property("cache", &compare_test_values::cache)
+        (
+            metadata(compare_metadata::exclude, true)
+        )
+        ;
+
+    registration::class_<compare_test_containers>("compare_test_containers")
+        .property("values", &compare_test_containers::values)
+        .property("tags", &compare_test_containers::tags)
+        .property("path", &compare_test_containers::path)
+        ;
+
+    registration::class_<compare_test_node>("compare_test_node")
+        .property("position", &compare_test_node::position)
+        .property("owner", &compare_test_node::owner)
+        ;
+
+    registration::class_<compare_test_accessor>("compare_test_accessor")
+        .property("level", &compare_test_accessor::get_level, &compare_test_accessor::set_level)
+        ;
+
+    registration::class_<compare_test_shape>("compare_test_shape")
+        .property("id", &compare_test_shape::id)
+        ;
+
+    registration::class_<compare_test_circle>("compare_test_circle")
+        .property("radius", &compare_test_circle::radius)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void check_equal(const T& lhs, const T& rhs)
+{
+    CHECK(equals(lhs, rhs) == true);
+    CHECK(hash_value(lhs) == hash_value(rhs));
+}
+
+template<typename T>
+static void check_different(const T& lhs, const T& rhs)
+{
+    CHECK(equals(lhs, rhs) == false);
+    CHECK(hash_value(lhs) != hash_value(rhs));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - equal objects", "[object_compare]")
+{
+    compare_test_values lhs;
+    compare_test_values rhs;
+    check_equal(lhs, rhs);
+    CHECK(equals(lhs, lhs) == true);
+
+    SECTION("excluded properties are ignored")
+    {
+        rhs.cache = 42;
+        check_equal(lhs, rhs);
+    }
+
+    SECTION("via pointer")
+    {
+        compare_test_values* lhs_ptr = &lhs;
+        compare_test_values* rhs_ptr = &rhs;
+        CHECK(equals(lhs_ptr, rhs_ptr) == true);
+        CHECK(hash_value(lhs_ptr) == hash_value(rhs));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - different values", "[object_compare]")
+{
+    compare_test_values lhs;
+    compare_test_values rhs;
+
+    SECTION("arithmetic value")
+    {
+        rhs.count = 4;
+    }
+
+    SECTION("enumeration")
+    {
+        rhs.color = compare_test_color::red;
+    }
+
+    SECTION("floating point")
+    {
+        rhs.weight = 0.25;
+    }
+
+    SECTION("string")
+    {
+        rhs.name = "other";
+    }
+
+    check_different(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - containers", "[object_compare]")
+{
+    compare_test_containers lhs;
+    compare_test_containers rhs;
+    check_equal(lhs, rhs);
+
+    SECTION("contiguous array")
+    {
+        rhs.values.push_back(4);
+    }
+
+    SECTION("linked list")
+    {
+        rhs.tags.back() = "c";
+    }
+
+    SECTION("array of objects")
+    {
+        rhs.path[1].x = 3;
+    }
+
+    check_different(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - nested objects and pointers", "[object_compare]")
+{
+    compare_test_node lhs;
+    compare_test_node rhs;
+    check_equal(lhs, rhs);
+
+    SECTION("nested object")
+    {
+        rhs.position.y = 6;
+    }
+
+    SECTION("pointer")
+    {
+        rhs.owner = &lhs;
+    }
+
+    check_different(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - getter function", "[object_compare]")
+{
+    compare_test_accessor lhs;
+    compare_test_accessor rhs;
+    check_equal(lhs, rhs);
+
+    rhs.set_level(10);
+    check_different(lhs, rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - derived types", "[object_compare]")
+{
+    compare_test_circle lhs;
+    compare_test_circle rhs;
+    compare_test_shape& lhs_base = lhs;
+    compare_test_shape& rhs_base = rhs;
+
+    CHECK(equals(lhs_base, rhs_base) == true);
+    CHECK(hash_value(lhs_base) == hash_value(rhs));
+
+    // the properties of the most derived type are compared
+    rhs.radius = 1;
+    CHECK(equals(lhs_base, rhs_base) == false);
+    CHECK(hash_value(lhs_base) != hash_value(rhs_base));
+
+    compare_test_shape base;
+    CHECK(equals(base, lhs) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("equals() - values without properties", "[object_compare]")
+{
+    int a = 5;
+    int b = 5;
+    CHECK(equals(a, b) == true);
+    CHECK(hash_value(a) == hash_value(b));
+    b = 6;
+    CHECK(equals(a, b) == false);
+
+    std::string text_a = "abc";
+    std::string text_b = "abc";
+    CHECK(equals(text_a, text_b) == true);
+    CHECK(hash_value(text_a) == hash_value(text_b));
+
+    CHECK(equals(a, text_a) == false);
+    CHECK(equals(instance(), instance()) == false);
+    CHECK(hash_value(instance()) == 0);
+}
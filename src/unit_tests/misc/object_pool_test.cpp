@@ -0,0 +1,428 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/object_pool.h>
+#include <catch/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace rttr;
+
+struct pooled_item
+{
+    pooled_item() : value(1) { ++s_alive; }
+    pooled_item(int v) : value(v) { ++s_alive; }
+    ~pooled_item() { --s_alive; }
+
+    int         value;
+    double      data[3];
+
+    static int  s_alive;
+};
+
+int pooled_item::s_alive = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct custom_allocated_item
+{
+    int value = 12;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct raw_base
+{
+    raw_base() { ++s_alive; }
+    virtual ~raw_base() { --s_alive; }
+
+    int         base_value = 1;
+
+    static int  s_alive;
+
+    RTTR_ENABLE()
+};
+
+int raw_base::s_alive = 0;
+
+struct pooled_derived : raw_base
+{
+    double      data[4];
+
+    RTTR_ENABLE(raw_base)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct pooled_base
+{
+    pooled_base() { ++s_alive; }
+    virtual ~pooled_base() { --s_alive; }
+
+    int         base_value = 1;
+
+    static int  s_alive;
+
+    RTTR_ENABLE()
+};
+
+int pooled_base::s_alive = 0;
+
+struct raw_derived : pooled_base
+{
+    double      data[4];
+
+    RTTR_ENABLE(pooled_base)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct counting_allocator : object_allocator
+{
+    counting_allocator() : m_pool(sizeof(custom_allocated_item), alignof(custom_allocated_item)) {}
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        ++m_allocations;
+        return m_pool.allocate(size, alignment);
+    }
+
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment)
+    {
+        ++m_deallocations;
+        m_pool.deallocate(ptr, size, alignment);
+    }
+
+    object_pool m_pool;
+    int         m_allocations = 0;
+    int         m_deallocations = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<pooled_item>("pooled_item")
+        .constructor<>()
+        (
+            policy::ctor::as_pooled
+        )
+        .constructor<int>()
+        (
+            policy::ctor::as_raw_ptr
+        );
+
+    registration::class_<custom_allocated_item>("custom_allocated_item")
+        .constructor<>()
+        (
+            policy::ctor::as_raw_ptr
+        );
+
+    registration::class_<raw_base>("raw_base")
+        .constructor<>()
+        (
+            policy::ctor::as_raw_ptr
+        );
+
+    registration::class_<pooled_derived>("pooled_derived")
+        .constructor<>()
+        (
+            policy::ctor::as_pooled
+        );
+
+    registration::class_<pooled_base>("pooled_base")
+        .constructor<>()
+        (
+            policy::ctor::as_pooled
+        );
+
+    registration::class_<raw_derived>("raw_derived")
+        .constructor<>()
+        (
+            policy::ctor::as_raw_ptr
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - allocate()", "[object_pool]")
+{
+    object_pool pool(sizeof(int), alignof(int), 4);
+    CHECK(pool.get_block_size() >= sizeof(void*));
+    CHECK(pool.get_block_size() % alignof(void*) == 0);
+
+    pool_statistics stats = pool.get_statistics();
+    CHECK(stats.m_allocation_count == 0);
+    CHECK(stats.m_chunk_count == 0);
+
+    std::set<void*> blocks;
+    for (int i = 0; i < 6; ++i)
+    {
+        void* ptr = pool.allocate(sizeof(int), alignof(int));
+        REQUIRE(ptr != nullptr);
+        CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignof(void*) == 0);
+        blocks.insert(ptr);
+    }
+    CHECK(blocks.size() == 6);
+
+    stats = pool.get_statistics();
+    CHECK(stats.m_allocation_count == 6);
+    CHECK(stats.m_live_count == 6);
+    CHECK(stats.m_chunk_count == 2);
+    CHECK(stats.m_free_count == 2);
+    CHECK(stats.m_reserved_bytes == 8 * pool.get_block_size());
+
+    // a released block is reused for the next allocation
+    void* released = *blocks.begin();
+    pool.deallocate(released, sizeof(int), alignof(int));
+    CHECK(pool.allocate(sizeof(int), alignof(int)) == released);
+
+    for (auto ptr : blocks)
+        pool.deallocate(ptr, sizeof(int), alignof(int));
+
+    stats = pool.get_statistics();
+    CHECK(stats.m_allocation_count == 7);
+    CHECK(stats.m_deallocation_count == 7);
+    CHECK(stats.m_live_count == 0);
+    CHECK(stats.m_free_count == 8);
+    CHECK(stats.m_chunk_count == 2);
+
+    SECTION("too big")
+    {
+        CHECK(pool.allocate(pool.get_block_size() + 1, alignof(int)) == nullptr);
+        CHECK(pool.allocate(sizeof(int), pool.get_block_size() * 2) == nullptr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - over aligned", "[object_pool]")
+{
+    object_pool pool(24, 64, 3);
+    CHECK(pool.get_block_size() == 64);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 5; ++i)
+    {
+        blocks.push_back(pool.allocate(24, 64));
+        CHECK(reinterpret_cast<std::uintptr_t>(blocks.back()) % 64 == 0);
+    }
+
+    for (auto ptr : blocks)
+        pool.deallocate(ptr, 24, 64);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - multiple threads", "[object_pool]")
+{
+    object_pool pool(sizeof(double), alignof(double), 16);
+    const int thread_count = 4;
+    const int object_count = 500;
+
+    std::atomic<int> error_count(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&pool, &error_count, t]()
+        {
+            std::vector<double*> objects;
+            for (int round = 0; round < 4; ++round)
+            {
+                for (int i = 0; i < object_count; ++i)
+                {
+                    double* ptr = static_cast<double*>(pool.allocate(sizeof(double), alignof(double)));
+                    *ptr = t * object_count + i;
+                    objects.push_back(ptr);
+                }
+
+                for (int i = 0; i < object_count; ++i)
+                {
+                    if (*objects[i] != t * object_count + i)
+                        ++error_count;
+                }
+
+                for (auto ptr : objects)
+                    pool.deallocate(ptr, sizeof(double), alignof(double));
+                objects.clear();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(error_count == 0);
+    const pool_statistics stats = pool.get_statistics();
+    CHECK(stats.m_allocation_count == thread_count * object_count * 4);
+    CHECK(stats.m_live_count == 0);
+
+    // the blocks of the exited threads were handed back, so no new chunk is needed
+    void* reused = pool.allocate(sizeof(double), alignof(double));
+    CHECK(pool.get_statistics().m_chunk_count == stats.m_chunk_count);
+    pool.deallocate(reused, sizeof(double), alignof(double));
+
+    SECTION("released by another thread")
+    {
+        void* ptr = nullptr;
+        std::thread([&]() { ptr = pool.allocate(sizeof(double), alignof(double)); }).join();
+        std::thread([&]() { pool.deallocate(ptr, sizeof(double), alignof(double)); }).join();
+        CHECK(pool.get_statistics().m_live_count == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("policy::ctor::as_pooled", "[object_pool]")
+{
+    type t = type::get<pooled_item>();
+    REQUIRE(t.get_allocator() != nullptr);
+
+    const pool_statistics before = get_pool_statistics(t);
+    CHECK(before.m_block_size >= sizeof(pooled_item));
+
+    variant var = t.create();
+    REQUIRE(var.is_type<pooled_item*>() == true);
+    pooled_item* obj = var.get_value<pooled_item*>();
+    CHECK(obj->value == 1);
+    CHECK(pooled_item::s_alive == 1);
+    CHECK(reinterpret_cast<std::uintptr_t>(obj) % alignof(pooled_item) == 0);
+
+    pool_statistics stats = get_pool_statistics(t);
+    CHECK(stats.m_allocation_count == before.m_allocation_count + 1);
+    CHECK(stats.m_live_count == before.m_live_count + 1);
+
+    // the raw pointer constructor uses the pool of the type too, so the destructor can give every object back
+    variant var2 = t.create({5});
+    REQUIRE(var2.is_type<pooled_item*>() == true);
+    CHECK(var2.get_value<pooled_item*>()->value == 5);
+    CHECK(get_pool_statistics(t).m_live_count == before.m_live_count + 2);
+
+    CHECK(t.destroy(var) == true);
+    CHECK(var.is_valid() == false);
+    void* released = var2.get_value<pooled_item*>();
+    CHECK(t.destroy(var2) == true);
+    CHECK(pooled_item::s_alive == 0);
+
+    stats = get_pool_statistics(t);
+    CHECK(stats.m_deallocation_count == before.m_deallocation_count + 2);
+    CHECK(stats.m_live_count == before.m_live_count);
+
+    // the last released memory is used for the next object
+    var = t.create();
+    CHECK(static_cast<void*>(var.get_value<pooled_item*>()) == released);
+    CHECK(t.destroy(var) == true);
+
+    SECTION("no pool")
+    {
+        CHECK(type::get<custom_allocated_item>().get_allocator() == nullptr);
+        CHECK(get_pool_statistics(type::get<custom_allocated_item>()).m_allocation_count == 0);
+        CHECK(get_pool_statistics(type::get_by_name("")).m_allocation_count == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("policy::ctor::as_pooled - destroy through base type", "[object_pool]")
+{
+    SECTION("pooled derived, raw base")
+    {
+        const type derived_type = type::get<pooled_derived>();
+        const pool_statistics before = get_pool_statistics(derived_type);
+
+        variant var = derived_type.create();
+        REQUIRE(var.is_type<pooled_derived*>() == true);
+        CHECK(get_pool_statistics(derived_type).m_live_count == before.m_live_count + 1);
+
+        REQUIRE(var.convert(type::get<raw_base*>()) == true);
+        REQUIRE(var.is_type<raw_base*>() == true);
+
+        // the block has to go back to the pool of the derived type, not to 'delete'
+        CHECK(type::get<raw_base>().destroy(var) == true);
+        CHECK(var.is_valid() == false);
+        CHECK(raw_base::s_alive == 0);
+
+        const pool_statistics stats = get_pool_statistics(derived_type);
+        CHECK(stats.m_deallocation_count == before.m_deallocation_count + 1);
+        CHECK(stats.m_live_count == before.m_live_count);
+    }
+
+    SECTION("raw derived, pooled base")
+    {
+        const type base_type = type::get<pooled_base>();
+        const pool_statistics before = get_pool_statistics(base_type);
+
+        variant var = type::get<raw_derived>().create();
+        REQUIRE(var.is_type<raw_derived*>() == true);
+
+        REQUIRE(var.convert(type::get<pooled_base*>()) == true);
+        REQUIRE(var.is_type<pooled_base*>() == true);
+
+        // the object was created with 'new', it must not end up in the pool of the base type
+        CHECK(base_type.destroy(var) == true);
+        CHECK(pooled_base::s_alive == 0);
+
+        const pool_statistics stats = get_pool_statistics(base_type);
+        CHECK(stats.m_deallocation_count == before.m_deallocation_count);
+        CHECK(stats.m_free_count == before.m_free_count);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - set_allocator()", "[object_pool]")
+{
+    type t = type::get<custom_allocated_item>();
+    counting_allocator allocator;
+    t.set_allocator(&allocator);
+    CHECK(t.get_allocator() == &allocator);
+
+    variant var = t.create();
+    REQUIRE(var.is_type<custom_allocated_item*>() == true);
+    CHECK(var.get_value<custom_allocated_item*>()->value == 12);
+    CHECK(allocator.m_allocations == 1);
+
+    CHECK(t.destroy(var) == true);
+    CHECK(allocator.m_deallocations == 1);
+
+    // the statistics are only available for a pool
+    CHECK(get_pool_statistics(t).m_allocation_count == 0);
+
+    t.set_allocator(nullptr);
+    var = t.create();
+    REQUIRE(var.is_type<custom_allocated_item*>() == true);
+    CHECK(t.destroy(var) == true);
+    CHECK(allocator.m_allocations == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,293 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/patch.h>
+
+#include <catch/catch.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct patch_test_point
+{
+    patch_test_point(float x_ = 0.0f, float y_ = 0.0f) : x(x_), y(y_) {}
+    float x;
+    float y;
+};
+
+struct patch_test_entity
+{
+    patch_test_entity() : id(0), health(100.0), version(1) {}
+
+    patch_test_point get_target() const { return m_target; }
+    void set_target(patch_test_point target) { m_target = target; }
+
+    int                         id;
+    double                      health;
+    std::string                 name;
+    std::vector<int>            scores;
+    std::list<std::string>      tags;
+    patch_test_point            position;
+    std::vector<patch_test_point> path;
+    int                         version;
+
+private:
+    patch_test_point            m_target;
+};
+
+struct patch_test_other
+{
+    patch_test_other() : id(0) {}
+    int id;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<patch_test_point>("patch_test_point")
+        .property("x", &patch_test_point::x)
+        .property("y", &patch_test_point::y)
+        ;
+
+    registration::class_<patch_test_entity>("patch_test_entity")
+        .property("id", &patch_test_entity::id)
+        .property("health", &patch_test_entity::health)
+        .property("name", &patch_test_entity::name)
+        .property("scores", &patch_test_entity::scores)
+        .property("tags", &patch_test_entity::tags)
+        .property("position", &patch_test_entity::position)
+        .property("path", &patch_test_entity::path)
+        .property_readonly("version", &patch_test_entity::version)
+        .property("target", &patch_test_entity::get_target, &patch_test_entity::set_target)
+        ;
+
+    registration::class_<patch_test_other>("patch_test_other")
+        .property("id", &patch_test_other::id)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static patch_test_entity create_patch_test_entity()
+{
+    patch_test_entity entity;
+    entity.id = 7;
+    entity.name = "scout";
+    entity.scores = {1, 2, 3};
+    entity.tags = {"fast", "small"};
+    entity.position = patch_test_point(1.0f, 2.0f);
+    entity.path = {patch_test_point(0.0f, 0.0f), patch_test_point(5.0f, 5.0f)};
+    entity.set_target(patch_test_point(9.0f, 9.0f));
+    return entity;
+}
+
+static bool operator==(const patch_test_point& lhs, const patch_test_point& rhs)
+{
+    return (lhs.x == rhs.x && lhs.y == rhs.y);
+}
+
+static void check_equal(const patch_test_entity& lhs, const patch_test_entity& rhs)
+{
+    CHECK(lhs.id == rhs.id);
+    CHECK(lhs.health == rhs.health);
+    CHECK(lhs.name == rhs.name);
+    CHECK(lhs.scores == rhs.scores);
+    CHECK(lhs.tags == rhs.tags);
+    CHECK(lhs.position == rhs.position);
+    CHECK(lhs.path.size() == rhs.path.size());
+    CHECK(std::equal(lhs.path.begin(), lhs.path.end(), rhs.path.begin()));
+    CHECK(lhs.get_target() == rhs.get_target());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - equal objects", "[patch]")
+{
+    const auto from = create_patch_test_entity();
+    const auto to = create_patch_test_entity();
+
+    patch p = diff(from, to);
+    CHECK(p.is_valid() == true);
+    CHECK(p.empty() == true);
+    // the fingerprint plus the end of the list of changes
+    CHECK(p.get_data().size() == sizeof(uint64_t) + 1);
+
+    auto object = create_patch_test_entity();
+    CHECK(apply_patch(object, p) == true);
+    check_equal(object, to);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - only changed fields are stored", "[patch]")
+{
+    const auto from = create_patch_test_entity();
+    auto to = create_patch_test_entity();
+    to.health = 75.5;
+
+    patch p = diff(from, to);
+    CHECK(p.empty() == false);
+    // index, value and end marker
+    CHECK(p.get_data().size() == sizeof(uint64_t) + 1 + sizeof(double) + 1);
+
+    auto object = create_patch_test_entity();
+    REQUIRE(apply_patch(object, p) == true);
+    CHECK(object.health == 75.5);
+    check_equal(object, to);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - unchanged sub-objects are skipped", "[patch]")
+{
+    const auto from = create_patch_test_entity();
+    auto to = create_patch_test_entity();
+    to.position.y = 3.0f;
+
+    patch p = diff(from, to);
+    // index of 'position', index of 'y', the float and two end markers
+    CHECK(p.get_data().size() == sizeof(uint64_t) + 1 + 1 + sizeof(float) + 1 + 1);
+
+    auto object = create_patch_test_entity();
+    object.position.x = -1.0f; // not part of the patch
+    REQUIRE(apply_patch(object, p) == true);
+    CHECK(object.position.x == -1.0f);
+    CHECK(object.position.y == 3.0f);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - containers", "[patch]")
+{
+    const auto from = create_patch_test_entity();
+    auto to = create_patch_test_entity();
+
+    SECTION("grow")
+    {
+        to.scores.push_back(4);
+        to.tags.push_back("loud");
+    }
+
+    SECTION("shrink")
+    {
+        to.scores.pop_back();
+        to.tags.clear();
+    }
+
+    SECTION("change an element")
+    {
+        to.scores[0] = 10;
+        to.tags.back() = "tiny";
+    }
+
+    patch p = diff(from, to);
+    REQUIRE(p.empty() == false);
+
+    auto object = create_patch_test_entity();
+    REQUIRE(apply_patch(object, p) == true);
+    check_equal(object, to);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - all kinds of values", "[patch]")
+{
+    const auto from = create_patch_test_entity();
+    auto to = create_patch_test_entity();
+    to.id = 8;
+    to.name = "scout leader";
+    to.scores.push_back(4);
+    to.tags.front() = "slow";
+    to.path[1].x = 6.0f;
+    to.path.push_back(patch_test_point(7.0f, 7.0f));
+    to.set_target(patch_test_point(10.0f, 9.0f));
+    to.version = 2;
+
+    patch p = diff(from, to);
+    REQUIRE(p.empty() == false);
+
+    auto object = create_patch_test_entity();
+    REQUIRE(apply_patch(object, p) == true);
+    check_equal(object, to);
+    // read only properties are not part of a patch
+    CHECK(object.version == 1);
+
+    SECTION("the patch can be transferred as bytes")
+    {
+        patch received(p.get_data().data(), p.get_data().size());
+        auto copy = create_patch_test_entity();
+        REQUIRE(apply_patch(copy, received) == true);
+        check_equal(copy, to);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("diff - invalid input", "[patch]")
+{
+    const auto entity = create_patch_test_entity();
+    const patch_test_other other;
+
+    CHECK(diff(entity, other).is_valid() == false);
+    CHECK(diff(instance(), entity).is_valid() == false);
+
+    auto to = create_patch_test_entity();
+    to.id = 1000;
+    patch p = diff(entity, to);
+
+    patch_test_other target;
+    CHECK(apply_patch(target, p) == false);
+    CHECK(apply_patch(target, patch()) == false);
+
+    auto object = create_patch_test_entity();
+
+    SECTION("truncated data")
+    {
+        patch truncated(p.get_data().data(), p.get_data().size() - 1);
+        CHECK(apply_patch(object, truncated) == false);
+    }
+
+    SECTION("unknown field index")
+    {
+        auto data = p.get_data();
+        data[sizeof(uint64_t)] = 100;
+        CHECK(apply_patch(object, patch(data.data(), data.size())) == false);
+    }
+
+    SECTION("trailing data")
+    {
+        auto data = p.get_data();
+        data.push_back(0);
+        CHECK(apply_patch(object, patch(data.data(), data.size())) == false);
+    }
+}
@@ -0,0 +1,262 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/parallel.h>
+
+#include <catch/catch.hpp>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct parallel_node
+{
+    parallel_node(int v = 0) : value(v), next(nullptr) {}
+
+    int                         value;
+    std::string                 name;
+    std::vector<parallel_node>  children;
+    parallel_node*              next;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<parallel_node>("parallel_node")
+        .property("value", &parallel_node::value)
+        .property("name", &parallel_node::name)
+        .property("children", &parallel_node::children)
+        .property("next", &parallel_node::next)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("parallel::thread_pool", "[parallel]")
+{
+    parallel::thread_pool pool(3);
+    CHECK(pool.get_thread_count() == 3);
+
+    CHECK(parallel::thread_pool::get_default().get_thread_count() > 0);
+    CHECK(&parallel::thread_pool::get_default() == &parallel::thread_pool::get_default());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("parallel::for_each", "[parallel]")
+{
+    parallel::thread_pool pool(4);
+
+    SECTION("contiguous")
+    {
+        std::vector<int> values(10000);
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<int>(i) * 2;
+
+        std::vector<int> result(values.size(), -1);
+        variant var = &values;
+        parallel::for_each(var.create_array_view(), [&](std::size_t index, const variant_ref& value)
+        {
+            result[index] = value.get_value<int>();
+        }, pool);
+
+        CHECK(result == values);
+    }
+
+    SECTION("node based")
+    {
+        std::list<int> values;
+        for (int i = 0; i < 5000; ++i)
+            values.push_back(i);
+
+        std::vector<int> result(values.size(), -1);
+        variant var = &values;
+        parallel::for_each(var.create_array_view(), [&](std::size_t index, const variant_ref& value)
+        {
+            result[index] = value.get_value<int>();
+        }, pool);
+
+        bool all_equal = true;
+        for (std::size_t i = 0; i < result.size(); ++i)
+            all_equal &= (result[i] == static_cast<int>(i));
+        CHECK(all_equal == true);
+    }
+
+    SECTION("empty and invalid")
+    {
+        std::vector<int> values;
+        variant var = &values;
+        std::atomic<int> call_count(0);
+        parallel::for_each(var.create_array_view(), [&](std::size_t, const variant_ref&) { ++call_count; }, pool);
+        parallel::for_each(variant_array_view(), [&](std::size_t, const variant_ref&) { ++call_count; }, pool);
+        CHECK(call_count == 0);
+    }
+
+    SECTION("exception")
+    {
+        std::vector<int> values(1000);
+        variant var = &values;
+        CHECK_THROWS_AS(parallel::for_each(var.create_array_view(), [&](std::size_t index, const variant_ref&)
+        {
+            if (index == 500)
+                throw std::runtime_error("invalid value");
+        }, pool), std::runtime_error);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("parallel::for_each_chunk", "[parallel]")
+{
+    parallel::thread_pool pool(2);
+
+    SECTION("contiguous")
+    {
+        std::vector<int> values(1050, 1);
+        variant var = &values;
+        std::mutex mutex;
+        std::set<std::size_t> offsets;
+        std::atomic<int> sum(0);
+        parallel::for_each_chunk(var.create_array_view(), [&](std::size_t offset, const variant_array_view& chunk)
+        {
+            const int* data = static_cast<const int*>(chunk.get_data());
+            int chunk_sum = 0;
+            for (std::size_t i = 0; i < chunk.get_size(); ++i)
+                chunk_sum += data[i];
+            sum += chunk_sum;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            offsets.insert(offset);
+            CHECK(data == &values[offset]);
+        }, 100, pool);
+
+        CHECK(sum == 1050);
+        CHECK(offsets.size() == 11);
+        CHECK(*offsets.rbegin() == 1000);
+    }
+
+    SECTION("node based")
+    {
+        std::list<int> values(300, 1);
+        variant var = &values;
+        std::atomic<int> call_count(0);
+        parallel::for_each_chunk(var.create_array_view(), [&](std::size_t offset, const variant_array_view& chunk)
+        {
+            ++call_count;
+            CHECK(offset == 0);
+            CHECK(chunk.get_size() == 300);
+        }, 10, pool);
+
+        CHECK(call_count == 1);
+    }
+
+    SECTION("many short-lived groups")
+    {
+        // every call creates and destroys a task group, while the workers might still finish its last task
+        std::vector<int> values(4, 1);
+        variant var = &values;
+        std::atomic<int> sum(0);
+        for (int i = 0; i < 20000; ++i)
+        {
+            parallel::for_each_chunk(var.create_array_view(), [&](std::size_t, const variant_array_view& chunk)
+            {
+                sum += static_cast<const int*>(chunk.get_data())[0];
+            }, 1, pool);
+        }
+
+        CHECK(sum == 20000 * 4);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("parallel::for_each_property", "[parallel]")
+{
+    parallel::thread_pool pool(4);
+
+    parallel_node root(1);
+    for (int i = 0; i < 10; ++i)
+    {
+        parallel_node child(10);
+        for (int j = 0; j < 10; ++j)
+            child.children.push_back(parallel_node(100));
+        root.children.push_back(child);
+    }
+
+    // cycle: the last grand child points back to the root; two children share one node
+    parallel_node shared_node(1000);
+    root.children.back().children.back().next = &root;
+    root.children[0].next = &shared_node;
+    root.children[1].next = &shared_node;
+
+    std::atomic<int> visit_count(0);
+    std::atomic<int> value_sum(0);
+    std::atomic<int> wrong_object_count(0);
+    parallel::for_each_property(root, [&](const instance& obj, const property& prop, const variant_ref& value)
+    {
+        ++visit_count;
+        if (obj.get_derived_type() != type::get<parallel_node>())
+            ++wrong_object_count;
+
+        if (prop.get_name() == "value")
+            value_sum += value.get_value<int>();
+    }, pool);
+
+    // 1 + 10 + 100 + 1 nodes, each with 4 properties
+    CHECK(visit_count == 112 * 4);
+    CHECK(value_sum == 1 + 10 * 10 + 100 * 100 + 1000);
+    CHECK(wrong_object_count == 0);
+
+    SECTION("properties refer to the original objects")
+    {
+        std::atomic<int> found(0);
+        parallel::for_each_property(root, [&](const instance&, const property& prop, const variant_ref& value)
+        {
+            if (prop.get_name() == "name" && &value.get_value<std::string>() == &root.children[5].children[5].name)
+                ++found;
+        }, pool);
+        CHECK(found == 1);
+    }
+
+    SECTION("invalid instance")
+    {
+        parallel::for_each_property(instance(), [&](const instance&, const property&, const variant_ref&) { ++visit_count; }, pool);
+        CHECK(visit_count == 112 * 4);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -313,6 +313,21 @@ TEST_CASE("Test rttr::type - Check get_sizeof", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - Check get_alignof", "[type]")
+{
+    struct alignas(16) aligned_struct { char data[3]; };
+
+    CHECK(type::get<char>().get_alignof()           == 1);
+    CHECK(type::get<int>().get_alignof()            == alignof(int));
+    CHECK(type::get<double>().get_alignof()         == alignof(double));
+    CHECK(type::get<int*>().get_alignof()           == alignof(int*));
+    CHECK(type::get<aligned_struct>().get_alignof() == 16);
+    CHECK(type::get<void>().get_alignof()           == 0);
+    CHECK(type::get<void(int)>().get_alignof()      == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - Check is_arithmetic", "[type]")
 {
     CHECK(type::get<int>().is_arithmetic()               == true);
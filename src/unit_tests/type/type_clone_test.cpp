@@ -0,0 +1,282 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <catch/catch.hpp>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct clone_test_vec3
+{
+    clone_test_vec3(float x_ = 0.0f, float y_ = 0.0f, float z_ = 0.0f) : x(x_), y(y_), z(z_) {}
+    float x;
+    float y;
+    float z;
+};
+
+struct clone_test_node
+{
+    clone_test_node() : id(0), enabled(false), version(1), parent(nullptr), m_level(0) {}
+    virtual ~clone_test_node() {}
+
+    int get_level() const { return m_level; }
+    void set_level(int level) { m_level = level; }
+
+    int                                             id;
+    bool                                            enabled;
+    std::string                                     name;
+    std::vector<int>                                values;
+    std::list<std::string>                          tags;
+    int                                             fixed[3];
+    clone_test_vec3                                 position;
+    std::map<std::string, int>                      lookup;
+    std::shared_ptr<clone_test_node>                child;
+    std::vector<std::shared_ptr<clone_test_node>>   children;
+    int                                             version;
+    clone_test_node*                                parent;
+
+private:
+    int                                             m_level;
+
+    RTTR_ENABLE()
+};
+
+struct clone_test_derived_node : clone_test_node
+{
+    clone_test_derived_node() : weight(0.0) {}
+    double weight;
+
+    RTTR_ENABLE(clone_test_node)
+};
+
+struct clone_test_plain
+{
+    clone_test_plain() : value(0) {}
+    int value;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<clone_test_vec3>("clone_test_vec3")
+        .property("x", &clone_test_vec3::x)
+        .property("y", &clone_test_vec3::y)
+        .property("z", &clone_test_vec3::z)
+        ;
+
+    registration::class_<clone_test_node>("clone_test_node")
+        .constructor<>()(policy::ctor::as_std_shared_ptr)
+        .property("id", &clone_test_node::id)
+        .property("enabled", &clone_test_node::enabled)
+        .property("name", &clone_test_node::name)
+        .property("values", &clone_test_node::values)
+        .property("tags", &clone_test_node::tags)
+        .property("fixed", &clone_test_node::fixed)
+        .property("position", &clone_test_node::position)
+        .property("lookup", &clone_test_node::lookup)
+        .property("child", &clone_test_node::child)
+        .property("children", &clone_test_node::children)
+        .property_readonly("version", &clone_test_node::version)
+        .property("parent", &clone_test_node::parent)
+        .property("level", &clone_test_node::get_level, &clone_test_node::set_level)
+        ;
+
+    registration::class_<clone_test_derived_node>("clone_test_derived_node")
+        .constructor<>()(policy::ctor::as_raw_ptr)
+        .property("weight", &clone_test_derived_node::weight)
+        ;
+
+    registration::class_<clone_test_plain>("clone_test_plain")
+        .property("value", &clone_test_plain::value)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void fill_clone_test_node(clone_test_node& node)
+{
+    node.id = 42;
+    node.enabled = true;
+    node.name = "root";
+    node.values = {1, 2, 3};
+    node.tags = {"a", "b"};
+    node.fixed[0] = 7; node.fixed[1] = 8; node.fixed[2] = 9;
+    node.position = clone_test_vec3(1.0f, 2.0f, 3.0f);
+    node.lookup = {{"one", 1}, {"two", 2}};
+    node.version = 5;
+    node.set_level(3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::clone_into - copies all properties", "[clone]")
+{
+    clone_test_node parent;
+    clone_test_node source;
+    fill_clone_test_node(source);
+    source.parent = &parent;
+    source.child = std::make_shared<clone_test_node>();
+    source.child->id = 2;
+
+    clone_test_node target;
+    REQUIRE(type::get<clone_test_node>().clone_into(source, target) == true);
+
+    CHECK(target.id == 42);
+    CHECK(target.enabled == true);
+    CHECK(target.name == "root");
+    CHECK(target.values == source.values);
+    CHECK(target.tags == source.tags);
+    CHECK(target.fixed[0] == 7);
+    CHECK(target.fixed[2] == 9);
+    CHECK(target.position.x == 1.0f);
+    CHECK(target.position.z == 3.0f);
+    CHECK(target.lookup == source.lookup);
+    CHECK(target.get_level() == 3);
+    // raw pointers and, by default, shared pointers are copied
+    CHECK(target.parent == &parent);
+    CHECK(target.child == source.child);
+    // read only properties cannot be written
+    CHECK(target.version == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::clone_into - clone shared pointees", "[clone]")
+{
+    auto shared = std::make_shared<clone_test_node>();
+    shared->id = 10;
+    shared->name = "shared";
+
+    clone_test_node source;
+    source.child = shared;
+    source.children = {shared, std::make_shared<clone_test_node>(), nullptr};
+    // a cycle back to the shared node
+    shared->child = shared;
+
+    clone_test_node target;
+    REQUIRE(type::get<clone_test_node>().clone_into(source, target, clone_mode::clone_shared_pointees) == true);
+
+    REQUIRE(target.child);
+    CHECK(target.child != shared);
+    CHECK(target.child->id == 10);
+    CHECK(target.child->name == "shared");
+    REQUIRE(target.children.size() == 3);
+    // the identity of the shared object is preserved
+    CHECK(target.children[0] == target.child);
+    CHECK(target.children[1] != source.children[1]);
+    CHECK(target.children[1] != nullptr);
+    CHECK(target.children[2] == nullptr);
+    CHECK(target.child->child == target.child);
+
+    shared->child.reset();
+    target.child->child.reset();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::clone_into - derived classes", "[clone]")
+{
+    clone_test_derived_node source;
+    fill_clone_test_node(source);
+    source.weight = 2.5;
+
+    SECTION("only the properties of the given type are copied")
+    {
+        clone_test_derived_node target;
+        REQUIRE(type::get<clone_test_node>().clone_into(source, target) == true);
+        CHECK(target.id == 42);
+        CHECK(target.weight == 0.0);
+    }
+
+    SECTION("via base class pointer")
+    {
+        clone_test_derived_node target;
+        clone_test_node* source_ptr = &source;
+        clone_test_node* target_ptr = &target;
+        REQUIRE(type::get<clone_test_derived_node>().clone_into(source_ptr, target_ptr) == true);
+        CHECK(target.id == 42);
+        CHECK(target.weight == 2.5);
+    }
+
+    SECTION("unrelated types")
+    {
+        clone_test_plain plain;
+        CHECK(type::get<clone_test_derived_node>().clone_into(plain, source) == false);
+        CHECK(type::get<clone_test_derived_node>().clone_into(source, plain) == false);
+        CHECK(type::get<clone_test_derived_node>().clone_into(instance(), source) == false);
+        CHECK(type::get<int>().clone_into(source, source) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::clone", "[clone]")
+{
+    SECTION("shared pointer policy")
+    {
+        clone_test_node source;
+        fill_clone_test_node(source);
+
+        variant var = type::get<clone_test_node>().clone(source);
+        REQUIRE(var.is_type<std::shared_ptr<clone_test_node>>() == true);
+        auto node = var.get_value<std::shared_ptr<clone_test_node>>();
+        CHECK(node->id == 42);
+        CHECK(node->name == "root");
+        CHECK(node->get_level() == 3);
+    }
+
+    SECTION("raw pointer policy")
+    {
+        clone_test_derived_node source;
+        fill_clone_test_node(source);
+        source.weight = 0.5;
+
+        variant var = type::get<clone_test_derived_node>().clone(source);
+        REQUIRE(var.is_type<clone_test_derived_node*>() == true);
+        clone_test_derived_node* node = var.get_value<clone_test_derived_node*>();
+        CHECK(node->id == 42);
+        CHECK(node->weight == 0.5);
+        CHECK(type::get<clone_test_derived_node>().destroy(var) == true);
+    }
+
+    SECTION("invalid")
+    {
+        clone_test_plain plain;
+        // no default constructor registered
+        CHECK(type::get<clone_test_plain>().clone(plain).is_valid() == false);
+        CHECK(type::get<clone_test_node>().clone(plain).is_valid() == false);
+    }
+}
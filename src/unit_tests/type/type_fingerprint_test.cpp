@@ -0,0 +1,154 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <catch/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+enum class fingerprint_color { red, green };
+enum class fingerprint_color_copy { red, green };
+enum class fingerprint_color_changed { red, blue };
+
+struct fingerprint_point { int x = 0; int y = 0; };
+struct fingerprint_point_copy { int x = 0; int y = 0; };
+struct fingerprint_point_renamed { int x = 0; int z = 0; };
+struct fingerprint_point_retyped { int x = 0; double y = 0.0; };
+
+struct fingerprint_shape { std::vector<fingerprint_point> points; fingerprint_color color = fingerprint_color::red; };
+struct fingerprint_shape_copy { std::vector<fingerprint_point_copy> points; fingerprint_color_copy color = fingerprint_color_copy::red; };
+struct fingerprint_shape_deep_change { std::vector<fingerprint_point_retyped> points; fingerprint_color color = fingerprint_color::red; };
+
+struct fingerprint_node
+{
+    std::vector<fingerprint_node> children;
+    fingerprint_node* parent = nullptr;
+    std::shared_ptr<fingerprint_node> next;
+};
+
+struct fingerprint_base { virtual ~fingerprint_base() {} int id = 0; RTTR_ENABLE() };
+struct fingerprint_derived : fingerprint_base { int value = 0; RTTR_ENABLE(fingerprint_base) };
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<fingerprint_color>("fingerprint_color")
+        (value("red", fingerprint_color::red), value("green", fingerprint_color::green));
+    registration::enumeration<fingerprint_color_copy>("fingerprint_color_copy")
+        (value("red", fingerprint_color_copy::red), value("green", fingerprint_color_copy::green));
+    registration::enumeration<fingerprint_color_changed>("fingerprint_color_changed")
+        (value("red", fingerprint_color_changed::red), value("blue", fingerprint_color_changed::blue));
+
+    registration::class_<fingerprint_point>("fingerprint_point")
+        .property("x", &fingerprint_point::x)
+        .property("y", &fingerprint_point::y);
+    registration::class_<fingerprint_point_copy>("fingerprint_point_copy")
+        .property("x", &fingerprint_point_copy::x)
+        .property("y", &fingerprint_point_copy::y);
+    registration::class_<fingerprint_point_renamed>("fingerprint_point_renamed")
+        .property("x", &fingerprint_point_renamed::x)
+        .property("z", &fingerprint_point_renamed::z);
+    registration::class_<fingerprint_point_retyped>("fingerprint_point_retyped")
+        .property("x", &fingerprint_point_retyped::x)
+        .property("y", &fingerprint_point_retyped::y);
+
+    registration::class_<fingerprint_shape>("fingerprint_shape")
+        .property("points", &fingerprint_shape::points)
+        .property("color", &fingerprint_shape::color);
+    registration::class_<fingerprint_shape_copy>("fingerprint_shape_copy")
+        .property("points", &fingerprint_shape_copy::points)
+        .property("color", &fingerprint_shape_copy::color);
+    registration::class_<fingerprint_shape_deep_change>("fingerprint_shape_deep_change")
+        .property("points", &fingerprint_shape_deep_change::points)
+        .property("color", &fingerprint_shape_deep_change::color);
+
+    registration::class_<fingerprint_node>("fingerprint_node")
+        .property("children", &fingerprint_node::children)
+        .property("parent", &fingerprint_node::parent)
+        .property("next", &fingerprint_node::next);
+
+    registration::class_<fingerprint_base>("fingerprint_base")
+        .property("id", &fingerprint_base::id);
+    registration::class_<fingerprint_derived>("fingerprint_derived")
+        .property("value", &fingerprint_derived::value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::get_fingerprint() - same structure", "[type]")
+{
+    CHECK(type::get_by_name("").get_fingerprint() == 0);
+    CHECK(type::get<int>().get_fingerprint() != 0);
+    CHECK(type::get<int>().get_fingerprint() == type::get<int>().get_fingerprint());
+    CHECK(type::get<int>().get_fingerprint() != type::get<double>().get_fingerprint());
+
+    CHECK(type::get<fingerprint_point>().get_fingerprint() == type::get<fingerprint_point_copy>().get_fingerprint());
+    CHECK(type::get<fingerprint_color>().get_fingerprint() == type::get<fingerprint_color_copy>().get_fingerprint());
+    CHECK(type::get<fingerprint_shape>().get_fingerprint() == type::get<fingerprint_shape_copy>().get_fingerprint());
+    CHECK(type::get<std::vector<int>>().get_fingerprint() == type::get<std::vector<int>>().get_fingerprint());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::get_fingerprint() - different structure", "[type]")
+{
+    const uint64_t point = type::get<fingerprint_point>().get_fingerprint();
+    CHECK(point != type::get<fingerprint_point_renamed>().get_fingerprint());
+    CHECK(point != type::get<fingerprint_point_retyped>().get_fingerprint());
+    CHECK(type::get<fingerprint_color>().get_fingerprint() != type::get<fingerprint_color_changed>().get_fingerprint());
+
+    // a change inside the element type of an array changes the fingerprint of the outer class
+    CHECK(type::get<fingerprint_shape>().get_fingerprint() != type::get<fingerprint_shape_deep_change>().get_fingerprint());
+
+    CHECK(type::get<std::vector<int>>().get_fingerprint() != type::get<std::vector<double>>().get_fingerprint());
+    CHECK(type::get<int*>().get_fingerprint() != type::get<int**>().get_fingerprint());
+    CHECK(type::get<fingerprint_derived>().get_fingerprint() != type::get<fingerprint_base>().get_fingerprint());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type::get_fingerprint() - recursive types", "[type]")
+{
+    const uint64_t node = type::get<fingerprint_node>().get_fingerprint();
+    CHECK(node != 0);
+    CHECK(node == type::get<fingerprint_node>().get_fingerprint());
+
+    // the fingerprint of a type, which refers back to an outer type, does not depend on the order of the calls
+    const uint64_t children = type::get<std::vector<fingerprint_node>>().get_fingerprint();
+    CHECK(children != node);
+    CHECK(children == type::get<std::vector<fingerprint_node>>().get_fingerprint());
+    CHECK(node == type::get<fingerprint_node>().get_fingerprint());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,10 @@ set(SOURCE_FILES main.cpp
                  misc/test_misc.cpp
                  misc/array_range_test.cpp
                  misc/string_view_test.cpp
+                 misc/object_compare_test.cpp
+                 misc/patch_test.cpp
+                 misc/metadata_key_test.cpp
+                 misc/object_pool_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -46,6 +50,8 @@ set(SOURCE_FILES main.cpp
                  property/property_global_object.cpp
                  type/test_type.cpp
                  type/test_type_names.cpp
+                 type/type_clone_test.cpp
+                 type/type_fingerprint_test.cpp
                  type/type_prop_meth_invoke.cpp
                  destructor/destructor_invoke_test.cpp
                  destructor/destructor_misc_test.cpp
@@ -54,10 +60,14 @@ set(SOURCE_FILES main.cpp
                  constructor/constructor_param_info_test.cpp
                  constructor/constructor_retrieve_test.cpp
                  constructor/constructor_invoke_test.cpp
+                 constructor/constructor_invoke_at_test.cpp
                  constructor/constructor_misc_test.cpp
                  enumeration/enumeration_conversion.cpp
                  enumeration/enumeration_misc.cpp
                  instance/instance_test.cpp
+                 io/binary_io_test.cpp
+                 io/json_io_test.cpp
+                 io/registry_snapshot_test.cpp
                  method/method_invoke_defaults_test.cpp
                  method/method_access_level_test.cpp
                  method/test_method_reflection.cpp
@@ -65,11 +75,14 @@ set(SOURCE_FILES main.cpp
                  method/method_misc_test.cpp
                  method/method_invoke_test.cpp
                  method/method_param_info_test.cpp
+                 parallel/parallel_test.cpp
                  variant/variant_assign_test.cpp
                  variant/variant_conv_test.cpp
                  variant/variant_ctor_test.cpp
                  variant/variant_cmp_equal_test.cpp
                  variant/variant_cmp_less_test.cpp
+                 variant/variant_hash_test.cpp
+                 variant/variant_sort_key_test.cpp
                  variant/variant_misc_test.cpp
                  variant/variant_conv_to_bool.cpp
                  variant/variant_conv_to_int8.cpp
@@ -85,4 +98,7 @@ set(SOURCE_FILES main.cpp
                  variant/variant_conv_to_string.cpp
                  variant/variant_conv_to_enum.cpp
                  variant_array_view/variant_array_view_test.cpp
+                 variant_array_view/variant_ndarray_view_test.cpp
+                 variant_associative_view/variant_associative_view_test.cpp
+                 variant_ref/variant_ref_test.cpp
                  )
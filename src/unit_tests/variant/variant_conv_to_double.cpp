@@ -30,6 +30,9 @@
 #include <catch/catch.hpp>
 #include <rttr/type>
 
+#include <clocale>
+#include <string>
+
 using namespace rttr;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +161,38 @@ TEST_CASE("variant::to_double() - from std::string", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant::to_double() - from std::string with another global locale", "[variant]")
+{
+    const std::string old_locale = std::setlocale(LC_NUMERIC, nullptr);
+    // a locale with ',' as decimal point; the test is skipped, when none is installed
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "de_DE"))
+    {
+        bool ok = false;
+        // more than 19 significant digits are parsed by the slow path
+        variant var = std::string("3.14159265358979323846264");
+        CHECK(var.to_double(&ok) == 3.14159265358979323846264);
+        CHECK(ok == true);
+
+        var = std::string("1,5");
+        ok = true;
+        CHECK(var.to_double(&ok) == 0.0);
+        CHECK(ok == false);
+
+        var = std::string("1,5");
+        ok = true;
+        CHECK(var.to_float(&ok) == 0.0f);
+        CHECK(ok == false);
+
+        var = std::string("2.5e-320");
+        ok = false;
+        CHECK(var.to_double(&ok) == 2.5e-320);
+        CHECK(ok == true);
+    }
+    std::setlocale(LC_NUMERIC, old_locale.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::to_double() - from int", "[variant]")
 {
     SECTION("valid conversion positive")
@@ -30,6 +30,8 @@
 #include "unit_tests/variant/test_enums.h"
 #include <rttr/registration>
 
+#include <vector>
+
 using namespace rttr;
 
 RTTR_REGISTRATION
@@ -503,3 +505,41 @@ TEST_CASE("variant:to enum - from uint64_t", "[variant]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::can_convert() - basic types agree with convert()", "[variant]")
+{
+    const std::vector<variant> sources = { true, 'A', int8_t(1), int16_t(1), int32_t(1), int64_t(1),
+                                           uint8_t(1), uint16_t(1), uint32_t(1), uint64_t(1),
+                                           1.0f, 1.0, std::string("1"), variant_enum_test::VALUE_1 };
+
+    for (const auto& source : sources)
+    {
+        for (const auto& target : sources)
+        {
+            const type target_type = target.get_type();
+            if (source.get_type() == target_type || target_type.is_enumeration())
+                continue;
+
+            INFO(source.get_type().get_name() << " -> " << target_type.get_name());
+            CHECK(source.can_convert(target_type) == true);
+
+            variant var = source;
+            CHECK(var.convert(target_type) == true);
+            CHECK(var.get_type() == target_type);
+        }
+    }
+
+    SECTION("to enum")
+    {
+        variant var = std::string("VALUE_2");
+        CHECK(var.can_convert<variant_enum_test>() == true);
+        CHECK(var.convert(type::get<variant_enum_test>()) == true);
+        CHECK(var.get_value<variant_enum_test>() == variant_enum_test::VALUE_2);
+
+        var = variant_enum_test::VALUE_1;
+        CHECK(var.can_convert<variant_enum_test_big>() == false);
+        CHECK(var.convert(type::get<variant_enum_test_big>()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 #include <catch/catch.hpp>
 #include <rttr/type>
 
+#include <limits>
+
 using namespace rttr;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -154,6 +156,32 @@ TEST_CASE("variant::to_int32() - from std::string", "[variant]")
         CHECK(ok == false);
         CHECK(var.convert(type::get<int32_t>()) == false);
     }
+
+    SECTION("limits")
+    {
+        bool ok = false;
+        CHECK(variant(std::string("2147483647")).to_int32(&ok) == 2147483647);
+        CHECK(ok == true);
+        CHECK(variant(std::string("-2147483648")).to_int32(&ok) == std::numeric_limits<int32_t>::min());
+        CHECK(ok == true);
+        CHECK(variant(std::string("2147483648")).to_int32(&ok) == 0);
+        CHECK(ok == false);
+        CHECK(variant(std::string("-2147483649")).to_int32(&ok) == 0);
+        CHECK(ok == false);
+    }
+
+    SECTION("sign and white-spaces")
+    {
+        bool ok = false;
+        CHECK(variant(std::string("  +23")).to_int32(&ok) == 23);
+        CHECK(ok == true);
+        CHECK(variant(std::string("23 ")).to_int32(&ok) == 0);
+        CHECK(ok == false);
+        CHECK(variant(std::string("-")).to_int32(&ok) == 0);
+        CHECK(ok == false);
+        CHECK(variant(std::string("")).to_int32(&ok) == 0);
+        CHECK(ok == false);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
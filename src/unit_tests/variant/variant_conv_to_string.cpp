@@ -30,6 +30,8 @@
 #include <catch/catch.hpp>
 #include <rttr/registration>
 
+#include <limits>
+
 using namespace rttr;
 
 RTTR_REGISTRATION
@@ -161,18 +163,18 @@ TEST_CASE("variant::to_string() - from float", "[variant]")
         variant var = 214748.9f;
         REQUIRE(var.can_convert<std::string>() == true);
         bool ok = false;
-        CHECK(var.to_string(&ok) == "214749");
+        CHECK(var.to_string(&ok) == "214748.9");
         CHECK(ok == true);
 
         REQUIRE(var.convert(type::get<std::string>()) == true);
-        CHECK(var.get_value<std::string>() == "214749");
+        CHECK(var.get_value<std::string>() == "214748.9");
     }
 
     SECTION("conversion negative")
     {
         variant var = -214748.9f;
         bool ok = false;
-        CHECK(var.to_string(&ok) == "-214749");
+        CHECK(var.to_string(&ok) == "-214748.9");
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
@@ -206,6 +208,50 @@ TEST_CASE("variant::to_string() - from double", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant::to_string() - floating point format", "[variant]")
+{
+    SECTION("shortest representation")
+    {
+        CHECK(variant(0.1).to_string() == "0.1");
+        CHECK(variant(0.1f).to_string() == "0.1");
+        CHECK(variant(100.0).to_string() == "100");
+        CHECK(variant(0.0001).to_string() == "0.0001");
+        CHECK(variant(1e-5).to_string() == "1e-05");
+        CHECK(variant(1e21).to_string() == "1e+21");
+        CHECK(variant(-0.0).to_string() == "-0");
+    }
+
+    SECTION("special values")
+    {
+        CHECK(variant(std::numeric_limits<double>::infinity()).to_string() == "inf");
+        CHECK(variant(-std::numeric_limits<float>::infinity()).to_string() == "-inf");
+        CHECK(variant(std::numeric_limits<double>::quiet_NaN()).to_string() == "nan");
+    }
+
+    SECTION("round trip")
+    {
+        const double double_values[] = { 1.0 / 3.0, 123456.123456, 5e-324, std::numeric_limits<double>::max(),
+                                         std::numeric_limits<double>::min(), -2.2250738585072009e-308 };
+        for (const auto value : double_values)
+        {
+            bool ok = false;
+            CHECK(variant(variant(value).to_string()).to_double(&ok) == value);
+            CHECK(ok == true);
+        }
+
+        const float float_values[] = { 1.0f / 3.0f, 123.12345f, 1e-45f, std::numeric_limits<float>::max(),
+                                       std::numeric_limits<float>::min(), -16777217.0f };
+        for (const auto value : float_values)
+        {
+            bool ok = false;
+            CHECK(variant(variant(value).to_string()).to_float(&ok) == value);
+            CHECK(ok == true);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::to_string() - from int8_t", "[variant]")
 {
     SECTION("valid conversion positive")
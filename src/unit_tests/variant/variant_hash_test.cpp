@@ -0,0 +1,214 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <catch/catch.hpp>
+
+#include "unit_tests/variant/test_enums.h"
+
+#include <rttr/type>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <limits>
+
+using namespace rttr;
+
+struct hashable_custom_type
+{
+    int value;
+
+    bool operator==(const hashable_custom_type& other) const { return (value == other.value); }
+};
+
+struct not_hashable_custom_type
+{
+    int value;
+
+    bool operator==(const not_hashable_custom_type& other) const { return (value == other.value); }
+};
+
+namespace std
+{
+    template<>
+    struct hash<hashable_custom_type>
+    {
+        size_t operator()(const hashable_custom_type& obj) const { return hash<int>()(obj.value); }
+    };
+}
+
+static std::size_t hash_of(const variant& var)
+{
+    return std::hash<variant>()(var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - empty", "[variant]")
+{
+    variant a;
+    variant b;
+    CHECK(hash_of(a) == hash_of(b));
+    CHECK(variant_key_equal()(a, b) == true);
+    CHECK(variant_key_equal()(a, 0) == false);
+    CHECK(variant_key_equal()(0, b) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - arithmetic", "[variant]")
+{
+    SECTION("same value, different types")
+    {
+        const variant values[] = { 42, int8_t(42), int16_t(42), int64_t(42), uint8_t(42), uint16_t(42),
+                                   uint32_t(42), uint64_t(42), 42.0f, 42.0, char(42) };
+        for (const auto& lhs : values)
+        {
+            for (const auto& rhs : values)
+            {
+                INFO(lhs.get_type().get_name() << " == " << rhs.get_type().get_name());
+                CHECK(hash_of(lhs) == hash_of(rhs));
+                CHECK(variant_key_equal()(lhs, rhs) == true);
+                CHECK((lhs == rhs) == true);
+            }
+        }
+    }
+
+    SECTION("bool")
+    {
+        CHECK(hash_of(true) == hash_of(1));
+        CHECK(variant_key_equal()(true, 1) == true);
+        CHECK(variant_key_equal()(false, 0) == true);
+        CHECK(variant_key_equal()(true, 0) == false);
+    }
+
+    SECTION("different values")
+    {
+        CHECK(variant_key_equal()(42, 43) == false);
+        CHECK(variant_key_equal()(42, 42.5) == false);
+        CHECK(variant_key_equal()(-1, std::numeric_limits<uint64_t>::max()) == false);
+        CHECK(variant_key_equal()(0.1f, 0.1) == false);
+    }
+
+    SECTION("big values")
+    {
+        const uint64_t big = std::numeric_limits<uint64_t>::max() - 2047; // 2^64 - 2048, exact as double
+        CHECK(hash_of(big) == hash_of(static_cast<double>(big)));
+        CHECK(variant_key_equal()(big, static_cast<double>(big)) == true);
+
+        CHECK(hash_of(std::numeric_limits<int64_t>::min()) == hash_of(-9223372036854775808.0));
+        CHECK(variant_key_equal()(std::numeric_limits<int64_t>::min(), -9223372036854775808.0) == true);
+    }
+
+    SECTION("floating point")
+    {
+        CHECK(hash_of(0.0) == hash_of(-0.0));
+        CHECK(variant_key_equal()(0.0, -0.0) == true);
+        CHECK(hash_of(1.5) == hash_of(1.5f));
+        CHECK(variant_key_equal()(1.5, 1.5f) == true);
+
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        CHECK(variant_key_equal()(nan, nan) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - enumeration", "[variant]")
+{
+    CHECK(hash_of(variant_enum_test::VALUE_1) == hash_of(1));
+    CHECK(variant_key_equal()(variant_enum_test::VALUE_1, 1) == true);
+    CHECK(variant_key_equal()(variant_enum_test::VALUE_1, variant_enum_test::VALUE_1) == true);
+    CHECK(variant_key_equal()(variant_enum_test::VALUE_1, variant_enum_test::VALUE_2) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - string", "[variant]")
+{
+    CHECK(hash_of(std::string("text")) == hash_of(std::string("text")));
+    CHECK(hash_of(std::string("text")) == std::hash<std::string>()("text"));
+    CHECK(variant_key_equal()(std::string("text"), std::string("text")) == true);
+    CHECK(variant_key_equal()(std::string("text"), std::string("other")) == false);
+
+    // no conversions are performed
+    CHECK(variant_key_equal()(std::string("1"), 1) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - pointer", "[variant]")
+{
+    int a = 1;
+    int b = 1;
+    CHECK(hash_of(&a) == hash_of(&a));
+    CHECK(variant_key_equal()(&a, &a) == true);
+    CHECK(variant_key_equal()(&a, &b) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - custom type", "[variant]")
+{
+    SECTION("without registered hash function")
+    {
+        CHECK(hash_of(not_hashable_custom_type{1}) == hash_of(not_hashable_custom_type{2}));
+        CHECK(variant_key_equal()(not_hashable_custom_type{1}, not_hashable_custom_type{1}) == true);
+        CHECK(variant_key_equal()(not_hashable_custom_type{1}, not_hashable_custom_type{2}) == false);
+    }
+
+    SECTION("with registered hash function")
+    {
+        type::register_hasher<hashable_custom_type>();
+        CHECK(hash_of(hashable_custom_type{1}) == std::hash<int>()(1));
+        CHECK(hash_of(hashable_custom_type{2}) == std::hash<int>()(2));
+        CHECK(variant_key_equal()(hashable_custom_type{1}, hashable_custom_type{1}) == true);
+        CHECK(variant_key_equal()(hashable_custom_type{1}, hashable_custom_type{2}) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("std::hash<variant> - unordered containers", "[variant]")
+{
+    std::unordered_map<variant, std::string, std::hash<variant>, variant_key_equal> map;
+    map[42] = "int";
+    map[std::string("42")] = "string";
+    map[1.5] = "double";
+
+    REQUIRE(map.size() == 3);
+    CHECK(map[int64_t(42)] == "int");
+    CHECK(map[42.0f] == "int");
+    CHECK(map[std::string("42")] == "string");
+    CHECK(map[1.5f] == "double");
+    CHECK(map.size() == 3);
+
+    std::unordered_set<variant, std::hash<variant>, variant_key_equal> set = { 1, uint8_t(1), 1.0, true };
+    CHECK(set.size() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
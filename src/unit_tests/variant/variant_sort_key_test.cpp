@@ -0,0 +1,226 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include "unit_tests/variant/test_enums.h"
+
+#include <rttr/type>
+
+#include <vector>
+#include <list>
+#include <random>
+#include <limits>
+
+using namespace rttr;
+
+struct sortable_custom_type
+{
+    int value;
+
+    bool operator<(const sortable_custom_type& other) const { return (value < other.value); }
+    bool operator==(const sortable_custom_type& other) const { return (value == other.value); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool has_same_order(const std::vector<variant>& values)
+{
+    std::vector<variant> expected = values;
+    std::stable_sort(expected.begin(), expected.end());
+
+    std::vector<variant> result = values;
+    sort_variants(result);
+
+    if (result.size() != expected.size())
+        return false;
+
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        if (result[i].get_type() != expected[i].get_type() || result[i] != expected[i])
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::sort_key() - arithmetic", "[variant]")
+{
+    SECTION("same value")
+    {
+        CHECK(variant(42).sort_key() == variant(uint8_t(42)).sort_key());
+        CHECK(variant(42).sort_key() == variant(42.0).sort_key());
+        CHECK(variant(42).sort_key() == variant(42.0f).sort_key());
+        CHECK(variant(0.0).sort_key() == variant(-0.0).sort_key());
+        CHECK(variant(true).sort_key() == variant(1).sort_key());
+    }
+
+    SECTION("order")
+    {
+        const variant values[] = { -std::numeric_limits<double>::infinity(), std::numeric_limits<int64_t>::min(),
+                                   -1.5, int8_t(-1), -0.25f, 0, 0.5, true, 2, 1e10,
+                                   std::numeric_limits<int64_t>::max(), std::numeric_limits<uint64_t>::max(), 1e100,
+                                   std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN() };
+        const std::size_t count = sizeof(values) / sizeof(variant);
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            INFO(values[i - 1].to_string() << " < " << values[i].to_string());
+            CHECK(values[i - 1].sort_key() < values[i].sort_key());
+        }
+    }
+
+    SECTION("big integers")
+    {
+        // same double representation, but different values
+        const int64_t big = std::numeric_limits<int64_t>::max();
+        CHECK(variant(big - 1).sort_key() < variant(big).sort_key());
+        CHECK(variant(big).sort_key() < variant(uint64_t(big) + 1).sort_key());
+    }
+
+    SECTION("enumeration")
+    {
+        CHECK(variant(variant_enum_test::VALUE_1).sort_key() == variant(1).sort_key());
+        CHECK(variant(variant_enum_test::VALUE_1).sort_key() < variant(variant_enum_test::VALUE_2).sort_key());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::sort_key() - string", "[variant]")
+{
+    CHECK(variant(std::string("abc")).sort_key() < variant(std::string("abd")).sort_key());
+    CHECK(variant(std::string("ab")).sort_key() < variant(std::string("abc")).sort_key());
+    CHECK(variant(std::string("")).sort_key() < variant(std::string("a")).sort_key());
+    CHECK(variant(std::string("a")).sort_key() < variant(std::string("\xff")).sort_key());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::sort_key() - classes", "[variant]")
+{
+    CHECK(variant().sort_key() < variant(-1e300).sort_key());
+    CHECK(variant(1e300).sort_key() < variant(std::string("")).sort_key());
+    CHECK(variant(std::string("\xff\xff")).sort_key() < variant(sortable_custom_type{0}).sort_key());
+    CHECK(variant(sortable_custom_type{0}).sort_key() == variant(sortable_custom_type{1}).sort_key());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sort_variants()", "[variant]")
+{
+    std::mt19937 gen(42);
+
+    SECTION("integer")
+    {
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::vector<variant> values;
+        for (int i = 0; i < 500; ++i)
+            values.emplace_back(dist(gen));
+
+        CHECK(has_same_order(values) == true);
+    }
+
+    SECTION("arithmetic, mixed types")
+    {
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::vector<variant> values;
+        for (int i = 0; i < 500; ++i)
+        {
+            const int value = dist(gen);
+            switch (i % 4)
+            {
+                case 0: values.emplace_back(value); break;
+                case 1: values.emplace_back(int64_t(value) * 3); break;
+                case 2: values.emplace_back(value / 7.0); break;
+                default: values.emplace_back(static_cast<float>(value) / 4.0f); break;
+            }
+        }
+
+        CHECK(has_same_order(values) == true);
+    }
+
+    SECTION("string")
+    {
+        std::uniform_int_distribution<int> dist(0, 100000);
+        std::vector<variant> values;
+        for (int i = 0; i < 500; ++i)
+            values.emplace_back(std::string("text_") + std::to_string(dist(gen)));
+
+        CHECK(has_same_order(values) == true);
+    }
+
+    SECTION("custom type")
+    {
+        std::uniform_int_distribution<int> dist(-100, 100);
+        std::vector<variant> values;
+        for (int i = 0; i < 200; ++i)
+            values.emplace_back(sortable_custom_type{dist(gen)});
+
+        CHECK(has_same_order(values) == true);
+    }
+
+    SECTION("different classes")
+    {
+        std::vector<variant> values = { std::string("b"), 3, variant(), 1.5, std::string("a"), int64_t(2) };
+        sort_variants(values.begin(), values.end());
+
+        REQUIRE(values.size() == 6);
+        CHECK(values[0].is_valid() == false);
+        CHECK(values[1] == 1.5);
+        CHECK(values[2] == 2);
+        CHECK(values[3] == 3);
+        CHECK(values[4] == std::string("a"));
+        CHECK(values[5] == std::string("b"));
+    }
+
+    SECTION("stable")
+    {
+        std::vector<variant> values = { 1.0, 2, 1, int8_t(1) };
+        sort_variants(values);
+
+        CHECK(values[0].is_type<double>() == true);
+        CHECK(values[1].is_type<int>() == true);
+        CHECK(values[2].is_type<int8_t>() == true);
+        CHECK(values[3] == 2);
+    }
+
+    SECTION("forward iterator")
+    {
+        std::list<variant> values = { 3, 1, 2 };
+        sort_variants(values);
+
+        std::vector<int> result;
+        for (const auto& value : values)
+            result.push_back(value.to_int());
+
+        CHECK(result == std::vector<int>({1, 2, 3}));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
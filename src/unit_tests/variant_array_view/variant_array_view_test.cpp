@@ -28,8 +28,11 @@
 #include <catch/catch.hpp>
 
 #include <rttr/type>
+#include <rttr/variant_ndarray_view.h>
 
 #include <vector>
+#include <list>
+#include <array>
 #include <map>
 #include <string>
 
@@ -890,3 +893,692 @@ TEST_CASE("variant_array_view::misc", "[variant_array_view]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::is_contiguous", "[variant_array_view]")
+{
+    SECTION("invalid")
+    {
+        variant_array_view array;
+        CHECK(array.is_contiguous()     == false);
+        CHECK(array.get_element_type().is_valid() == false);
+        CHECK(array.get_stride()        == 0);
+        CHECK(array.get_data()          == nullptr);
+    }
+
+    SECTION("std::vector")
+    {
+        std::vector<float> vec = {1.0f, 2.0f, 3.0f};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+        REQUIRE(array.is_contiguous()   == true);
+        CHECK(array.get_element_type()  == type::get<float>());
+        CHECK(array.get_stride()        == sizeof(float));
+        CHECK(array.get_data()          == vec.data());
+
+        float* data = array.get_data<float>();
+        REQUIRE(data == vec.data());
+        data[1] = 42.0f;
+        CHECK(vec[1] == 42.0f);
+
+        CHECK(array.get_data<double>()  == nullptr);
+        CHECK(array.get_data<int>()     == nullptr);
+    }
+
+    SECTION("std::array")
+    {
+        std::array<int, 4> arr = {{1, 2, 3, 4}};
+        variant var = &arr;
+        variant_array_view array = var.create_array_view();
+        REQUIRE(array.is_contiguous()   == true);
+        CHECK(array.get_element_type()  == type::get<int>());
+        CHECK(array.get_stride()        == sizeof(int));
+        CHECK(array.get_data<int>()     == arr.data());
+    }
+
+    SECTION("raw array")
+    {
+        int obj[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        variant var = &obj;
+        variant_array_view array = var.create_array_view();
+        REQUIRE(array.is_contiguous()   == true);
+        CHECK(array.get_element_type()  == type::get<int[3]>());
+        CHECK(array.get_stride()        == sizeof(int[3]));
+        CHECK(array.get_data()          == &obj[0]);
+        CHECK(array.get_data<int>()     == nullptr);
+    }
+
+    SECTION("copy of array")
+    {
+        variant var = std::vector<int>(10, 5);
+        variant_array_view array = var.create_array_view();
+        REQUIRE(array.is_contiguous()   == true);
+        const int* data = array.get_data<int>();
+        REQUIRE(data != nullptr);
+        CHECK(data[9] == 5);
+    }
+
+    SECTION("not contiguous")
+    {
+        variant var = std::list<int>(10, 0);
+        variant_array_view array = var.create_array_view();
+        REQUIRE(array.is_valid()        == true);
+        CHECK(array.is_contiguous()     == false);
+        CHECK(array.get_element_type()  == type::get<int>());
+        CHECK(array.get_stride()        == 0);
+        CHECK(array.get_data()          == nullptr);
+        CHECK(array.get_data<int>()     == nullptr);
+
+        var = std::vector<bool>(10, false);
+        array = var.create_array_view();
+        REQUIRE(array.is_valid()        == true);
+        CHECK(array.is_contiguous()     == false);
+        CHECK(array.get_data()          == nullptr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::const_iterator", "[variant_array_view]")
+{
+    SECTION("invalid")
+    {
+        variant_array_view array;
+        CHECK(array.begin()     == array.end());
+        CHECK(array.rbegin()    == array.rend());
+
+        variant_array_view::const_iterator itr;
+        CHECK(itr == variant_array_view::const_iterator());
+        CHECK(itr != array.begin());
+    }
+
+    SECTION("std::vector")
+    {
+        std::vector<int> vec = {1, 2, 3};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        std::vector<int> result;
+        for (auto itr = array.begin(); itr != array.end(); ++itr)
+        {
+            variant_ref ref = *itr;
+            REQUIRE(ref.is_type<int>() == true);
+            result.push_back(ref.get_value<int>());
+        }
+        CHECK(result == vec);
+
+        // no copy of the element is done
+        CHECK(&(*array.begin()).get_value<int>() == &vec[0]);
+
+        result.clear();
+        for (auto itr = array.rbegin(); itr != array.rend(); ++itr)
+            result.push_back((*itr).get_value<int>());
+        CHECK(result == std::vector<int>({3, 2, 1}));
+    }
+
+    SECTION("std::list")
+    {
+        std::list<std::string> list = {"one", "two", "three"};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+
+        std::vector<std::string> result;
+        for (const auto& ref : array)
+            result.push_back(ref.get_value<std::string>());
+        CHECK(result == std::vector<std::string>({"one", "two", "three"}));
+        CHECK(&(*array.begin()).get_value<std::string>() == &list.front());
+
+        auto itr = array.begin();
+        auto itr_2 = itr++;
+        CHECK(itr_2 == array.begin());
+        CHECK((*itr).get_value<std::string>() == "two");
+        --itr;
+        CHECK(itr == array.begin());
+        CHECK((*array.rbegin()).get_value<std::string>() == "three");
+    }
+
+    SECTION("raw array")
+    {
+        int obj[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        variant var = &obj;
+        variant_array_view array = var.create_array_view();
+
+        int count = 0;
+        for (auto itr = array.begin(); itr != array.end(); ++itr, ++count)
+        {
+            variant_ref ref = *itr;
+            REQUIRE(ref.is_type<int[3]>() == true);
+            CHECK(ref.get_value<int[3]>()[0] == obj[count][0]);
+        }
+        CHECK(count == 2);
+    }
+
+    SECTION("std::vector<bool>")
+    {
+        std::vector<bool> vec = {true, false, true};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        std::vector<bool> result;
+        for (auto itr = array.begin(); itr != array.end(); ++itr)
+            result.push_back((*itr).get_value<bool>());
+        CHECK(result == vec);
+    }
+
+    SECTION("set_value")
+    {
+        std::list<int> list = {1, 2, 3};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+        auto itr = array.begin();
+        ++itr;
+        CHECK(array.set_value(itr, 42) == true);
+        CHECK(list == std::list<int>({1, 42, 3}));
+        CHECK(array.set_value(itr, std::string("invalid")) == false);
+
+        std::vector<int> vec = {1, 2, 3};
+        var = &vec;
+        array = var.create_array_view();
+        CHECK(array.set_value(array.begin(), 23) == true);
+        CHECK(vec[0] == 23);
+
+        variant_array_view other = var.create_array_view();
+        CHECK(array.set_value(other.begin(), 12) == false);
+    }
+
+    SECTION("insert_value")
+    {
+        std::list<int> list = {1, 2, 3};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+
+        auto itr = array.insert_value(array.end(), 4);
+        REQUIRE(itr != array.end());
+        CHECK((*itr).get_value<int>() == 4);
+        itr = array.insert_value(array.begin(), 0);
+        CHECK(itr == array.begin());
+        CHECK(list == std::list<int>({0, 1, 2, 3, 4}));
+        CHECK(array.insert_value(array.begin(), std::string("invalid")) == array.end());
+
+        std::vector<int> vec = {1, 3};
+        var = &vec;
+        array = var.create_array_view();
+        itr = array.insert_value(++array.begin(), 2);
+        REQUIRE(itr != array.end());
+        CHECK((*itr).get_value<int>() == 2);
+        CHECK(vec == std::vector<int>({1, 2, 3}));
+
+        std::array<int, 3> arr = {{1, 2, 3}};
+        var = &arr;
+        array = var.create_array_view();
+        CHECK(array.insert_value(array.begin(), 0) == array.end());
+    }
+
+    SECTION("remove_value")
+    {
+        std::list<int> list = {1, 2, 3, 4, 5};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+
+        // remove all even numbers within one pass
+        for (auto itr = array.begin(); itr != array.end();)
+        {
+            if ((*itr).get_value<int>() % 2 == 0)
+                itr = array.remove_value(itr);
+            else
+                ++itr;
+        }
+        CHECK(list == std::list<int>({1, 3, 5}));
+        CHECK(array.remove_value(array.end()) == array.end());
+
+        std::vector<int> vec = {1, 2, 3, 4, 5};
+        var = &vec;
+        array = var.create_array_view();
+        for (auto itr = array.begin(); itr != array.end();)
+        {
+            if ((*itr).get_value<int>() % 2 == 0)
+                itr = array.remove_value(itr);
+            else
+                ++itr;
+        }
+        CHECK(vec == std::vector<int>({1, 3, 5}));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::append_range", "[variant_array_view]")
+{
+    SECTION("invalid")
+    {
+        variant_array_view array;
+        const int data[] = {1, 2, 3};
+        CHECK(array.reserve(10)                 == false);
+        CHECK(array.append_range(data, 3)       == false);
+        CHECK(array.assign(data, 3)             == false);
+    }
+
+    SECTION("std::vector")
+    {
+        std::vector<int> vec = {1, 2};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        CHECK(array.reserve(100) == true);
+        CHECK(vec.capacity() >= 100);
+
+        const int data[] = {3, 4, 5};
+        CHECK(array.append_range(data, 3)       == true);
+        CHECK(vec == std::vector<int>({1, 2, 3, 4, 5}));
+        CHECK(array.append_range(data, 0)       == true);
+        CHECK(vec.size() == 5);
+
+        // the element type has to match exactly
+        const double other_data[] = {1.0, 2.0};
+        CHECK(array.append_range(other_data, 2) == false);
+        const int* null_data = nullptr;
+        CHECK(array.append_range(null_data, 2)  == false);
+        CHECK(vec.size() == 5);
+    }
+
+    SECTION("std::vector<std::string>")
+    {
+        std::vector<std::string> vec = {"a"};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        const std::string data[] = {"b", "c"};
+        CHECK(array.append_range(data, 2) == true);
+        CHECK(vec == std::vector<std::string>({"a", "b", "c"}));
+
+        std::string movable_data[] = {"d", "e"};
+        CHECK(array.append_range(std::make_move_iterator(std::begin(movable_data)),
+                                 std::make_move_iterator(std::end(movable_data))) == true);
+        CHECK(vec == std::vector<std::string>({"a", "b", "c", "d", "e"}));
+        CHECK(movable_data[0].empty() == true);
+    }
+
+    SECTION("std::vector<bool>")
+    {
+        std::vector<bool> vec = {true};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        CHECK(array.reserve(10) == true);
+        const bool data[] = {false, true};
+        CHECK(array.append_range(data, 2) == true);
+        CHECK(vec == std::vector<bool>({true, false, true}));
+    }
+
+    SECTION("std::list")
+    {
+        std::list<int> list = {1};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+
+        // a list has no storage to preallocate
+        CHECK(array.reserve(10) == true);
+        const int data[] = {2, 3};
+        CHECK(array.append_range(data, 2) == true);
+        CHECK(list == std::list<int>({1, 2, 3}));
+    }
+
+    SECTION("static arrays")
+    {
+        std::array<int, 3> arr = {{1, 2, 3}};
+        variant var = &arr;
+        variant_array_view array = var.create_array_view();
+
+        const int data[] = {4};
+        CHECK(array.reserve(10)         == false);
+        CHECK(array.append_range(data, 1) == false);
+    }
+
+    SECTION("const array")
+    {
+        const std::vector<int> vec = {1, 2};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        const int data[] = {3};
+        CHECK(array.reserve(10)         == false);
+        CHECK(array.append_range(data, 1) == false);
+        CHECK(array.assign(data, 1)     == false);
+        CHECK(vec.size() == 2);
+    }
+
+    SECTION("variant_array_view")
+    {
+        std::vector<int> vec = {1};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        std::array<int, 2> arr = {{2, 3}};
+        variant var_arr = &arr;
+        CHECK(array.append_range(var_arr.create_array_view()) == true);
+
+        std::list<int> list = {4, 5};
+        variant var_list = &list;
+        CHECK(array.append_range(var_list.create_array_view()) == true);
+        CHECK(vec == std::vector<int>({1, 2, 3, 4, 5}));
+
+        std::vector<double> other_vec = {1.0};
+        variant var_other = &other_vec;
+        CHECK(array.append_range(var_other.create_array_view()) == false);
+        CHECK(array.append_range(array) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::assign", "[variant_array_view]")
+{
+    SECTION("std::vector")
+    {
+        std::vector<int> vec = {1, 2, 3, 4};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        const int data[] = {7, 8};
+        CHECK(array.assign(data, 2) == true);
+        CHECK(vec == std::vector<int>({7, 8}));
+        CHECK(array.assign(data, 0) == true);
+        CHECK(vec.empty() == true);
+    }
+
+    SECTION("std::list")
+    {
+        std::list<std::string> list = {"a", "b", "c"};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+
+        std::string data[] = {"x", "y"};
+        CHECK(array.assign(std::make_move_iterator(std::begin(data)),
+                           std::make_move_iterator(std::end(data))) == true);
+        CHECK(list == std::list<std::string>({"x", "y"}));
+    }
+
+    SECTION("static arrays")
+    {
+        std::array<int, 3> arr = {{1, 2, 3}};
+        variant var = &arr;
+        variant_array_view array = var.create_array_view();
+
+        const int data[] = {4, 5, 6};
+        CHECK(array.assign(data, 2) == false);
+        CHECK(array.assign(data, 3) == true);
+        CHECK(arr[0] == 4);
+        CHECK(arr[2] == 6);
+
+        int obj[2][2] = {{1, 2}, {3, 4}};
+        var = &obj;
+        array = var.create_array_view();
+        const int rows[2][2] = {{5, 6}, {7, 8}};
+        CHECK(array.assign(rows, 2) == true);
+        CHECK(obj[0][1] == 6);
+        CHECK(obj[1][0] == 7);
+    }
+
+    SECTION("variant_array_view")
+    {
+        std::array<int, 3> arr = {{1, 2, 3}};
+        variant var = &arr;
+        variant_array_view array = var.create_array_view();
+
+        std::list<int> list = {7, 8, 9};
+        variant var_list = &list;
+        CHECK(array.assign(var_list.create_array_view()) == true);
+        CHECK(arr[0] == 7);
+        CHECK(arr[2] == 9);
+
+        std::vector<int> vec = {1};
+        variant var_vec = &vec;
+        variant_array_view vec_array = var_vec.create_array_view();
+        CHECK(vec_array.assign(var_list.create_array_view()) == true);
+        CHECK(vec == std::vector<int>({7, 8, 9}));
+
+        list.pop_back();
+        CHECK(array.assign(var_list.create_array_view()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class array_test_enum
+{
+    first = 1,
+    second = 2
+};
+
+TEST_CASE("variant_array_view::convert_to", "[variant_array_view]")
+{
+    SECTION("invalid")
+    {
+        variant_array_view array;
+        double out[2];
+        CHECK(array.convert_to(type::get<double>(), out, 2) == false);
+        CHECK(array.copy_to(out, 0)                         == true);
+    }
+
+    SECTION("widening")
+    {
+        std::vector<int32_t> vec = {1, -2, 3};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        std::vector<double> out(3);
+        CHECK(array.convert_to(type::get<double>(), out.data(), out.size()) == true);
+        CHECK(out == std::vector<double>({1.0, -2.0, 3.0}));
+
+        int64_t out_int64[2] = {};
+        CHECK(array.copy_to(out_int64, 2)   == true);
+        CHECK(out_int64[1]                  == -2);
+
+        bool out_bool[3] = {};
+        CHECK(array.copy_to(out_bool, 3)    == true);
+        CHECK(out_bool[1]                   == true);
+
+        // same type
+        int32_t out_int32[3] = {};
+        CHECK(array.copy_to(out_int32, 3)   == true);
+        CHECK(out_int32[2]                  == 3);
+
+        // too many elements requested
+        CHECK(array.copy_to(out.data(), 4)  == false);
+    }
+
+    SECTION("narrowing")
+    {
+        std::vector<int32_t> vec = {1, 200, 3};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        int8_t out[3];
+        CHECK(array.copy_to(out, 1)         == true);
+        CHECK(out[0]                        == 1);
+        CHECK(array.copy_to(out, 3)         == false);
+
+        uint8_t out_unsigned[3];
+        CHECK(array.copy_to(out_unsigned, 3) == true);
+        CHECK(out_unsigned[1]               == 200);
+
+        vec[0] = -1;
+        CHECK(array.copy_to(out_unsigned, 3) == false);
+    }
+
+    SECTION("non contiguous arrays")
+    {
+        std::list<float> list = {1.5f, 2.5f};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+        double out[2] = {};
+        CHECK(array.copy_to(out, 2)         == true);
+        CHECK(out[1]                        == 2.5);
+
+        std::vector<bool> vec = {true, false, true};
+        var = &vec;
+        array = var.create_array_view();
+        int out_int[3] = {};
+        CHECK(array.copy_to(out_int, 3)     == true);
+        CHECK(out_int[0]                    == 1);
+        CHECK(out_int[1]                    == 0);
+    }
+
+    SECTION("per element fallback")
+    {
+        std::vector<std::string> vec = {"12", "23"};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+        int out[2] = {};
+        CHECK(array.copy_to(out, 2)         == true);
+        CHECK(out[1]                        == 23);
+
+        vec[1] = "no number";
+        CHECK(array.copy_to(out, 2)         == false);
+
+        std::vector<array_test_enum> enum_vec = {array_test_enum::second};
+        var = &enum_vec;
+        array = var.create_array_view();
+        CHECK(array.copy_to(out, 1)         == true);
+        CHECK(out[0]                        == 2);
+    }
+
+    SECTION("invalid target type")
+    {
+        std::vector<int> vec = {1, 2};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+        std::string out[2];
+        CHECK(array.convert_to(type::get<std::string>(), out, 2) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::slice", "[variant_array_view]")
+{
+    SECTION("invalid")
+    {
+        variant_array_view array;
+        CHECK(array.slice(0, 0).is_valid() == false);
+
+        std::vector<int> vec = {1, 2, 3};
+        variant var = &vec;
+        array = var.create_array_view();
+        CHECK(array.slice(2, 1).is_valid() == false);
+        CHECK(array.slice(0, 4).is_valid() == false);
+        CHECK(array.slice(3, 3).is_valid() == true);
+        CHECK(array.slice(3, 3).get_size() == 0);
+    }
+
+    SECTION("contiguous array")
+    {
+        std::vector<int> vec = {1, 2, 3, 4, 5, 6};
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+        variant_array_view slice = array.slice(2, 5);
+
+        REQUIRE(slice.is_valid()        == true);
+        CHECK(slice.get_size()          == 3);
+        CHECK(slice.is_dynamic()        == false);
+        CHECK(slice.get_type()          == array.get_type());
+        CHECK(slice.get_data<int>()     == vec.data() + 2);
+        CHECK(slice.get_value(0).get_value<int>() == 3);
+        CHECK(slice.get_value(3).is_valid()       == false);
+
+        CHECK(slice.set_value(1, 40)    == true);
+        CHECK(vec[3]                    == 40);
+        CHECK(slice.set_value(3, 40)    == false);
+        CHECK(vec[5]                    == 6);
+
+        // the size of a slice is fixed
+        CHECK(slice.set_size(10)        == false);
+        CHECK(slice.insert_value(0, 1)  == false);
+        CHECK(slice.remove_value(0)     == false);
+
+        double out[3] = {};
+        CHECK(slice.copy_to(out, 3)     == true);
+        CHECK(out[0]                    == 3.0);
+        CHECK(out[2]                    == 5.0);
+        CHECK(slice.copy_to(out, 4)     == false);
+
+        // a slice of a slice
+        variant_array_view sub_slice = slice.slice(1, 3);
+        CHECK(sub_slice.get_size()      == 2);
+        CHECK(sub_slice.get_value(0).get_value<int>() == 40);
+        CHECK(sub_slice.get_data<int>() == vec.data() + 3);
+
+        variant_array_view copy = slice;
+        slice = variant_array_view();
+        CHECK(copy.get_value(2).get_value<int>() == 5);
+    }
+
+    SECTION("node based array")
+    {
+        std::list<int> list = {1, 2, 3, 4, 5};
+        variant var = &list;
+        variant_array_view array = var.create_array_view();
+        variant_array_view slice = array.slice(1, 4);
+
+        REQUIRE(slice.get_size()        == 3);
+        CHECK(slice.get_data()          == nullptr);
+
+        std::vector<int> values;
+        for (const auto& ref : slice)
+            values.push_back(ref.get_value<int>());
+        CHECK(values == std::vector<int>({2, 3, 4}));
+
+        auto itr = slice.begin();
+        ++itr;
+        CHECK(slice.set_value(itr, 30)  == true);
+        CHECK(slice.insert_value(itr, 1) == slice.end());
+        CHECK(list == std::list<int>({1, 2, 30, 4, 5}));
+
+        CHECK(std::distance(slice.rbegin(), slice.rend()) == 3);
+        CHECK((*slice.rbegin()).get_value<int>() == 4);
+    }
+
+    SECTION("multi dimensional array")
+    {
+        int obj[4][2] = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+        variant var = &obj;
+        variant_array_view array = var.create_array_view();
+        variant_array_view slice = array.slice(1, 3);
+
+        CHECK(slice.get_rank()                      == 2);
+        CHECK(slice.get_size(0)                     == 2);
+        CHECK(slice.get_value(1, 0).get_value<int>() == 5);
+        CHECK(slice.set_value(0, 1, 40)             == true);
+        CHECK(obj[1][1]                             == 40);
+
+        variant_ndarray_view nd_slice(slice);
+        CHECK(nd_slice.get_shape()                  == std::vector<std::size_t>({2, 2}));
+        CHECK(nd_slice.at(1, 1).get_value<int>()    == 6);
+        CHECK(nd_slice.at(2, 0).is_valid()          == false);
+        CHECK(nd_slice.get_flat_data<int>()         == &obj[1][0]);
+    }
+
+    SECTION("partitioning")
+    {
+        std::vector<int> vec(100, 0);
+        variant var = &vec;
+        variant_array_view array = var.create_array_view();
+
+        const std::size_t part_size = 25;
+        std::vector<variant_array_view> parts;
+        for (std::size_t begin = 0; begin < array.get_size(); begin += part_size)
+            parts.push_back(array.slice(begin, begin + part_size));
+
+        for (std::size_t part = 0; part < parts.size(); ++part)
+        {
+            for (auto itr = parts[part].begin(); itr != parts[part].end(); ++itr)
+                parts[part].set_value(itr, static_cast<int>(part));
+        }
+
+        CHECK(vec[0]    == 0);
+        CHECK(vec[24]   == 0);
+        CHECK(vec[25]   == 1);
+        CHECK(vec[99]   == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
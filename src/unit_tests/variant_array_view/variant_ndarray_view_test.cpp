@@ -0,0 +1,190 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/variant_ndarray_view.h>
+
+#include <vector>
+#include <array>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ndarray_view::ctor", "[variant_ndarray_view]")
+{
+    SECTION("invalid")
+    {
+        variant_ndarray_view view;
+        CHECK(view.is_valid()           == false);
+        CHECK(view.is_regular()         == false);
+        CHECK(view.is_flat()            == false);
+        CHECK(view.get_shape().empty()  == true);
+        CHECK(view.get_element_count()  == 0);
+        CHECK(view.get_flat_data()      == nullptr);
+        CHECK(view.at(0).is_valid()     == false);
+        CHECK(view.set_at({0}, 1)       == false);
+    }
+
+    SECTION("from variant_array_view")
+    {
+        int obj[2][3] = {};
+        variant var = &obj;
+        variant_array_view array = var.create_array_view();
+
+        variant_ndarray_view view(array);
+        CHECK(view.is_valid()   == true);
+        CHECK(view.get_rank()   == 2);
+        CHECK(view.get_type()   == array.get_type());
+
+        variant_ndarray_view moved_view(var.create_array_view());
+        CHECK(moved_view.is_valid() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ndarray_view::get_shape", "[variant_ndarray_view]")
+{
+    SECTION("raw array")
+    {
+        static float image[8][6][4] = {};
+        variant var = &image;
+        variant_ndarray_view view(var.create_array_view());
+
+        REQUIRE(view.is_regular()       == true);
+        REQUIRE(view.is_flat()          == true);
+        CHECK(view.get_shape()          == std::vector<std::size_t>({8, 6, 4}));
+        CHECK(view.get_shape(3)         == 0);
+        CHECK(view.get_stride(0)        == sizeof(float) * 6 * 4);
+        CHECK(view.get_stride(1)        == sizeof(float) * 4);
+        CHECK(view.get_stride(2)        == sizeof(float));
+        CHECK(view.get_stride(3)        == 0);
+        CHECK(view.get_stride()         == sizeof(float) * 6 * 4);
+        CHECK(view.get_value_type()     == type::get<float>());
+        CHECK(view.get_element_count()  == 8 * 6 * 4);
+        CHECK(view.get_flat_data()      == &image[0][0][0]);
+        CHECK(view.get_flat_data<float>() == &image[0][0][0]);
+        CHECK(view.get_flat_data<int>() == nullptr);
+    }
+
+    SECTION("std::vector<std::array>")
+    {
+        std::vector<std::array<int, 3>> vec(5);
+        variant var = &vec;
+        variant_ndarray_view view(var.create_array_view());
+
+        REQUIRE(view.is_regular()       == true);
+        CHECK(view.get_shape()          == std::vector<std::size_t>({5, 3}));
+        CHECK(view.get_element_count()  == 15);
+        if (sizeof(std::array<int, 3>) == sizeof(int) * 3)
+        {
+            CHECK(view.is_flat()        == true);
+            CHECK(view.get_flat_data<int>() == vec[0].data());
+        }
+
+        vec.resize(7);
+        CHECK(view.get_shape(0)         == 7);
+        CHECK(view.get_element_count()  == 21);
+    }
+
+    SECTION("jagged array")
+    {
+        std::vector<std::vector<int>> vec = {{1, 2}, {3}};
+        variant var = &vec;
+        variant_ndarray_view view(var.create_array_view());
+
+        CHECK(view.is_regular()         == false);
+        CHECK(view.is_flat()            == false);
+        CHECK(view.get_shape()          == std::vector<std::size_t>({2, 0}));
+        CHECK(view.get_stride(0)        == 0);
+        CHECK(view.get_element_count()  == 0);
+        CHECK(view.get_flat_data()      == nullptr);
+        CHECK(view.get_value_type()     == type::get<int>());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ndarray_view::at", "[variant_ndarray_view]")
+{
+    SECTION("raw array")
+    {
+        int obj[2][3][4] = {};
+        obj[1][2][3] = 42;
+        variant var = &obj;
+        variant_ndarray_view view(var.create_array_view());
+
+        CHECK(view.at(1, 2, 3).get_value<int>()   == 42);
+        CHECK(view.at({1, 2, 3}).get_value<int>() == 42);
+        CHECK(view.at(0, 0, 0).get_value<int>()   == 0);
+
+        // wrong index count
+        CHECK(view.at(1, 2).is_valid()            == false);
+        CHECK(view.at({1, 2, 3, 0}).is_valid()    == false);
+        // out of range
+        CHECK(view.at(2, 0, 0).is_valid()         == false);
+        CHECK(view.at(1, 3, 0).is_valid()         == false);
+        CHECK(view.at(1, 2, 4).is_valid()         == false);
+
+        CHECK(view.set_at({0, 1, 2}, 23)          == true);
+        CHECK(obj[0][1][2]                        == 23);
+        CHECK(view.set_at({0, 1, 2}, 23.0)        == false);
+        CHECK(view.set_at({0, 1}, 23)             == false);
+        CHECK(view.set_at({0, 1, 4}, 23)          == false);
+    }
+
+    SECTION("jagged array")
+    {
+        std::vector<std::vector<bool>> vec = {{true, false}, {false}};
+        variant var = &vec;
+        variant_ndarray_view view(var.create_array_view());
+
+        CHECK(view.at(0, 1).get_value<bool>()     == false);
+        CHECK(view.at(1, 1).is_valid()            == false);
+
+        CHECK(view.set_at({1, 0}, true)           == true);
+        CHECK(vec[1][0]                           == true);
+    }
+
+    SECTION("const array")
+    {
+        const std::array<std::array<int, 2>, 2> arr = {{{{1, 2}}, {{3, 4}}}};
+        variant var = &arr;
+        variant_ndarray_view view(var.create_array_view());
+
+        CHECK(view.at(1, 0).get_value<int>()      == 3);
+        CHECK(view.set_at({1, 0}, 5)              == false);
+        CHECK(arr[1][0]                           == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
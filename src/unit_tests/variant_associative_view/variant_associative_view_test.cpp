@@ -0,0 +1,309 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::ctor", "[variant_associative_view]")
+{
+    SECTION("empty")
+    {
+        variant_associative_view a;
+        CHECK(a.is_valid() == false);
+        CHECK(static_cast<bool>(a) == false);
+        CHECK(a.get_size() == 0);
+        CHECK(a.begin() == a.end());
+
+        variant_associative_view b(a);
+        CHECK(b.is_valid() == false);
+    }
+
+    SECTION("valid")
+    {
+        variant var = std::map<int, std::string>{ {1, "one"} };
+        REQUIRE(var.is_associative_container() == true);
+        CHECK(var.is_array() == false);
+
+        variant_associative_view a = var.create_associative_view();
+        CHECK(a.is_valid() == true);
+
+        variant_associative_view b(a);
+        CHECK(b.is_valid() == true);
+        CHECK(b.get_size() == 1);
+
+        variant_associative_view c(std::move(b));
+        CHECK(c.is_valid() == true);
+
+        variant_associative_view d;
+        d = c;
+        CHECK(d.is_valid() == true);
+        CHECK(d.get_type() == type::get(std::map<int, std::string>()));
+    }
+
+    SECTION("no associative container")
+    {
+        variant var = std::vector<int>(2, 0);
+        CHECK(var.is_associative_container() == false);
+        CHECK(var.create_associative_view().is_valid() == false);
+
+        var = 23;
+        CHECK(var.is_associative_container() == false);
+        CHECK(var.create_associative_view().is_valid() == false);
+
+        var = variant();
+        CHECK(var.is_associative_container() == false);
+        CHECK(var.create_associative_view().is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::get_type", "[variant_associative_view]")
+{
+    SECTION("std::map")
+    {
+        std::map<std::string, int> obj;
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+        CHECK(view.get_type()           == type::get(obj));
+        CHECK(view.get_key_type()       == type::get<std::string>());
+        CHECK(view.get_value_type()     == type::get<int>());
+        CHECK(view.is_key_only_type()   == false);
+    }
+
+    SECTION("std::set")
+    {
+        std::set<int> obj;
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+        CHECK(view.get_type()           == type::get(obj));
+        CHECK(view.get_key_type()       == type::get<int>());
+        CHECK(view.get_value_type().is_valid() == false);
+        CHECK(view.is_key_only_type()   == true);
+    }
+
+    SECTION("wrapper type")
+    {
+        std::unordered_map<int, int> obj = { {1, 2} };
+        variant var = std::ref(obj);
+        REQUIRE(var.is_associative_container() == true);
+        variant_associative_view view = var.create_associative_view();
+        CHECK(view.get_type() == type::get(obj));
+        CHECK(view.get_size() == 1);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::const_iterator", "[variant_associative_view]")
+{
+    SECTION("std::map")
+    {
+        std::map<std::string, int> obj = { {"a", 1}, {"b", 2}, {"c", 3} };
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+
+        std::vector<std::string> keys;
+        int sum = 0;
+        for (auto itr = view.begin(); itr != view.end(); ++itr)
+        {
+            keys.push_back(itr.get_key().get_value<std::string>());
+            sum += itr.get_value().get_value<int>();
+        }
+        CHECK(keys == std::vector<std::string>({"a", "b", "c"}));
+        CHECK(sum == 6);
+
+        // no copy of the key or the value is done
+        auto itr = view.begin();
+        CHECK(&itr.get_key().get_value<std::string>() == &obj.begin()->first);
+        CHECK(&itr.get_value().get_value<int>() == &obj.begin()->second);
+
+        auto pair = *itr;
+        CHECK(pair.first.get_value<std::string>() == "a");
+        CHECK(pair.second.get_value<int>() == 1);
+
+        auto itr_2 = itr++;
+        CHECK(itr_2 == view.begin());
+        CHECK(itr != view.begin());
+    }
+
+    SECTION("std::unordered_set")
+    {
+        std::unordered_set<int> obj = { 1, 2, 3 };
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+
+        int sum = 0;
+        std::size_t count = 0;
+        for (const auto& item : view)
+        {
+            sum += item.first.get_value<int>();
+            CHECK(item.second.is_valid() == false);
+            ++count;
+        }
+        CHECK(sum == 6);
+        CHECK(count == view.get_size());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::find", "[variant_associative_view]")
+{
+    std::unordered_map<std::string, int> obj = { {"width", 800}, {"height", 600} };
+    variant var = &obj;
+    variant_associative_view view = var.create_associative_view();
+
+    auto itr = view.find(std::string("height"));
+    REQUIRE(itr != view.end());
+    CHECK(itr.get_value().get_value<int>() == 600);
+    CHECK(&itr.get_value().get_value<int>() == &obj["height"]);
+
+    CHECK(view.find(std::string("depth")) == view.end());
+    // the key type has to match exactly
+    CHECK(view.find(23) == view.end());
+
+    variant_associative_view invalid;
+    CHECK(invalid.find(std::string("width")) == invalid.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::insert", "[variant_associative_view]")
+{
+    SECTION("std::map")
+    {
+        std::map<int, std::string> obj;
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+
+        auto ret = view.insert(1, std::string("one"));
+        CHECK(ret.second == true);
+        REQUIRE(ret.first != view.end());
+        CHECK(ret.first.get_value().get_value<std::string>() == "one");
+        CHECK(obj.at(1) == "one");
+
+        ret = view.insert(1, std::string("uno"));
+        CHECK(ret.second == false);
+        CHECK(ret.first.get_value().get_value<std::string>() == "one");
+
+        // wrong types
+        CHECK(view.insert(2, 42).second == false);
+        CHECK(view.insert(2).second == false);
+        CHECK(view.insert(2).first == view.end());
+        CHECK(obj.size() == 1);
+    }
+
+    SECTION("std::multimap")
+    {
+        std::multimap<int, int> obj;
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+        CHECK(view.insert(1, 1).second == true);
+        CHECK(view.insert(1, 2).second == true);
+        CHECK(obj.count(1) == 2);
+    }
+
+    SECTION("std::set")
+    {
+        std::set<std::string> obj;
+        variant var = &obj;
+        variant_associative_view view = var.create_associative_view();
+
+        auto ret = view.insert(std::string("one"));
+        CHECK(ret.second == true);
+        CHECK(ret.first.get_key().get_value<std::string>() == "one");
+        CHECK(view.insert(std::string("one")).second == false);
+        CHECK(view.insert(std::string("two"), 2).second == false);
+        CHECK(obj == std::set<std::string>({"one"}));
+    }
+
+    SECTION("insert_range")
+    {
+        std::map<int, int> obj = { {1, 1} };
+        std::map<int, int> other = { {1, 10}, {2, 20}, {3, 30} };
+        variant var = &obj;
+        variant var_other = &other;
+        variant_associative_view view = var.create_associative_view();
+
+        CHECK(view.insert_range(var_other.create_associative_view()) == true);
+        const std::map<int, int> expected = { {1, 1}, {2, 20}, {3, 30} };
+        CHECK(obj == expected);
+
+        std::unordered_map<int, int> other_type = { {4, 40} };
+        variant var_other_type = &other_type;
+        CHECK(view.insert_range(var_other_type.create_associative_view()) == false);
+        CHECK(view.insert_range(variant_associative_view()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::erase", "[variant_associative_view]")
+{
+    std::multiset<int> obj = { 1, 2, 2, 3 };
+    variant var = &obj;
+    variant_associative_view view = var.create_associative_view();
+
+    CHECK(view.erase(2) == 2);
+    CHECK(view.erase(4) == 0);
+    CHECK(view.erase(std::string("1")) == 0);
+    CHECK(obj == std::multiset<int>({1, 3}));
+
+    CHECK(view.clear() == true);
+    CHECK(obj.empty() == true);
+    CHECK(view.get_size() == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view - via variant_ref", "[variant_associative_view]")
+{
+    std::map<std::string, int> obj = { {"a", 1} };
+    variant_ref ref(obj);
+    REQUIRE(ref.is_associative_container() == true);
+
+    variant_associative_view view = ref.create_associative_view();
+    view.insert(std::string("b"), 2);
+    CHECK(obj.size() == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
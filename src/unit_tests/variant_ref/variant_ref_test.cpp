@@ -0,0 +1,235 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2016 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+
+#include <catch/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct variant_ref_test
+{
+    variant_ref_test() : text("hello world"), numbers({1, 2, 3}) {}
+
+    const std::string& get_text() const { return text; }
+    int get_answer() const { return 42; }
+
+    std::string         text;
+    std::vector<int>    numbers;
+};
+
+static std::string g_variant_ref_text = "global text";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<variant_ref_test>("variant_ref_test")
+        .property("text", &variant_ref_test::text)
+        .property("numbers", &variant_ref_test::numbers)
+        .property_readonly("get_text", &variant_ref_test::get_text)
+        .property_readonly("get_answer", &variant_ref_test::get_answer)
+        ;
+
+    registration::property("g_variant_ref_text", &g_variant_ref_text);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref::ctor", "[variant_ref]")
+{
+    SECTION("empty")
+    {
+        variant_ref ref;
+        CHECK(ref.is_valid() == false);
+        CHECK(static_cast<bool>(ref) == false);
+        CHECK(ref.get_type().is_valid() == false);
+    }
+
+    SECTION("refers to object")
+    {
+        std::string text = "hello";
+        variant_ref ref = text;
+        CHECK(ref.is_valid() == true);
+        CHECK(ref.is_type<std::string>() == true);
+        CHECK(ref.get_type() == type::get<std::string>());
+        CHECK(&ref.get_value<std::string>() == &text);
+
+        text = "world";
+        CHECK(ref.get_value<std::string>() == "world");
+    }
+
+    SECTION("copy refers to same object")
+    {
+        int value = 23;
+        variant_ref ref = value;
+        variant_ref ref_copy = ref;
+        CHECK(&ref_copy.get_value<int>() == &value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref::convert", "[variant_ref]")
+{
+    SECTION("arithmetic")
+    {
+        int value = 42;
+        variant_ref ref = value;
+        bool ok = false;
+        CHECK(ref.convert<std::string>(&ok) == "42");
+        CHECK(ok == true);
+        CHECK(ref.to_string() == "42");
+        CHECK(ref.can_convert<double>() == true);
+
+        variant var = ref.convert(type::get<double>(), &ok);
+        CHECK(ok == true);
+        CHECK(var.is_type<double>() == true);
+        CHECK(var.get_value<double>() == 42.0);
+    }
+
+    SECTION("string")
+    {
+        const std::string text = "23";
+        variant_ref ref = text;
+        int result = 0;
+        CHECK(ref.convert(result) == true);
+        CHECK(result == 23);
+    }
+
+    SECTION("same type returns a copy")
+    {
+        std::string text = "hello";
+        variant_ref ref = text;
+        bool ok = false;
+        variant var = ref.convert(type::get<std::string>(), &ok);
+        CHECK(ok == true);
+        text = "world";
+        CHECK(var.get_value<std::string>() == "hello");
+    }
+
+    SECTION("to_variant")
+    {
+        std::vector<int> vec = {1, 2, 3};
+        variant_ref ref = vec;
+        variant var = ref.to_variant();
+        vec.clear();
+        REQUIRE(var.is_type<std::vector<int>>() == true);
+        CHECK(var.get_value<std::vector<int>>().size() == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref::compare", "[variant_ref]")
+{
+    int a = 12;
+    int b = 12;
+    double c = 12.5;
+    std::string d = "12";
+
+    CHECK(variant_ref(a) == variant_ref(b));
+    CHECK(variant_ref(a) != variant_ref(c));
+    CHECK(variant_ref(a) < variant_ref(c));
+    CHECK(variant_ref(d) == variant_ref(a));
+    CHECK(variant_ref(a) == variant(12));
+    CHECK(variant_ref(a) != variant(13));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_ref::create_array_view", "[variant_ref]")
+{
+    std::vector<int> vec = {1, 2, 3};
+    variant_ref ref = vec;
+    REQUIRE(ref.is_array() == true);
+
+    variant_array_view view = ref.create_array_view();
+    REQUIRE(view.is_valid() == true);
+    CHECK(view.get_size() == 3);
+    CHECK(view.get_value(1).to_int() == 2);
+
+    // the view writes directly into the referenced object
+    CHECK(view.set_value(1, 42) == true);
+    CHECK(vec[1] == 42);
+
+    int value = 0;
+    CHECK(variant_ref(value).create_array_view().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property::get_ref", "[variant_ref]")
+{
+    variant_ref_test obj;
+    type t = type::get(obj);
+
+    SECTION("member object")
+    {
+        variant_ref ref = t.get_property("text").get_ref(obj);
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &obj.text);
+
+        ref = t.get_property("numbers").get_ref(obj);
+        REQUIRE(ref.is_type<std::vector<int>>() == true);
+        CHECK(&ref.get_value<std::vector<int>>() == &obj.numbers);
+    }
+
+    SECTION("getter returns reference")
+    {
+        variant_ref ref = t.get_property("get_text").get_ref(obj);
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &obj.text);
+    }
+
+    SECTION("getter returns value")
+    {
+        variant_ref ref = t.get_property("get_answer").get_ref(obj);
+        REQUIRE(ref.is_type<int>() == true);
+        CHECK(ref.get_value<int>() == 42);
+    }
+
+    SECTION("global object")
+    {
+        variant_ref ref = type::get_global_property("g_variant_ref_text").get_ref(instance());
+        REQUIRE(ref.is_type<std::string>() == true);
+        CHECK(&ref.get_value<std::string>() == &g_variant_ref_text);
+    }
+
+    SECTION("invalid instance")
+    {
+        int invalid = 0;
+        CHECK(t.get_property("text").get_ref(invalid).is_valid() == false);
+        CHECK(t.get_property("not_existing").get_ref(obj).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////